@@ -0,0 +1,140 @@
+/*
+    Quick Search Plugin for DeaDBeeF audio player
+    Copyright (C) 2014 Christian Boxdörfer <christian.boxdoerfer@posteo.de>
+
+    This program is free software; you can redistribute it and/or
+    modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation; either version 2
+    of the License, or (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+*/
+
+// Micro-benchmark of the matching kernels in match.c: matches a set of
+// queries against synthetic, folded metadata values with every
+// implementation the cpu supports and checks that they all agree with the
+// scalar one.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "../match.h"
+#include "../fold.h"
+
+#define VALUE_COUNT 200000
+#define ROUNDS 5
+
+static const char *words[] = {
+    "the", "Night", "of", "LOVE", "Metallica", "master", "Puppets", "Symphony",
+    "no.", "5", "in", "C", "minor", "Allegro", "con", "brio", "Live", "at",
+    "Wembley", "Remastered", "2011", "feat.", "Orchestra", "Berliner",
+    "Philharmoniker", "Björk", "Homogenic", "Motörhead", "Ace", "Spades",
+};
+
+static const char *queries[] = {
+    "a", "th", "live", "tallic", "remastered 2011", "philharmoniker",
+    "xyz", "björk", "symphony no. 5 in c minor",
+};
+
+static double
+now_ms (void)
+{
+    struct timespec ts;
+    clock_gettime (CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e3 + ts.tv_nsec / 1e6;
+}
+
+static char *
+make_value (int min_words, int max_words)
+{
+    char buf[2048] = "";
+    int n = min_words + rand () % (max_words - min_words + 1);
+    for (int i = 0; i < n; i++) {
+        if (i) {
+            strcat (buf, " ");
+        }
+        strcat (buf, words[rand () % (sizeof (words) / sizeof (words[0]))]);
+    }
+    // the index matches against folded values
+    qs_fold (buf, strlen (buf), buf, sizeof (buf));
+    return strdup (buf);
+}
+
+// matches all queries against count values of min_words to max_words words
+static void
+run (int count, int min_words, int max_words)
+{
+    static const char *impls[] = { "scalar", "sse2", "sse4.2", "avx2" };
+    const int query_count = sizeof (queries) / sizeof (queries[0]);
+
+    srand (1);
+    char **values = malloc (count * sizeof (char *));
+    int *lens = malloc (count * sizeof (int));
+    long bytes = 0;
+    for (int i = 0; i < count; i++) {
+        values[i] = make_value (min_words, max_words);
+        lens[i] = strlen (values[i]);
+        bytes += lens[i];
+    }
+    printf ("%d values of %d-%d words, %ld bytes, %d queries, %d rounds\n",
+            count, min_words, max_words, bytes, query_count, ROUNDS);
+
+    int expected[sizeof (queries) / sizeof (queries[0])];
+    double scalar_ms = 0;
+    for (int k = 0; k < (int)(sizeof (impls) / sizeof (impls[0])); k++) {
+        if (qs_match_set_impl (impls[k]) < 0) {
+            printf ("%-8s not supported\n", impls[k]);
+            continue;
+        }
+        int mismatch = 0;
+        double start = now_ms ();
+        for (int r = 0; r < ROUNDS; r++) {
+            for (int q = 0; q < query_count; q++) {
+                char query[256];
+                int qlen = qs_fold (queries[q], strlen (queries[q]), query, sizeof (query));
+                int hits = 0;
+                for (int i = 0; i < count; i++) {
+                    hits += qs_match (values[i], lens[i], query, qlen);
+                }
+                if (k == 0 && r == 0) {
+                    expected[q] = hits;
+                }
+                else if (hits != expected[q]) {
+                    mismatch = 1;
+                }
+            }
+        }
+        double ms = now_ms () - start;
+        if (k == 0) {
+            scalar_ms = ms;
+        }
+        printf ("%-8s %8.1f ms %6.2f GB/s %5.2fx%s\n", impls[k], ms,
+                bytes * (double)ROUNDS * query_count / (ms * 1e6), scalar_ms / ms,
+                mismatch ? "  RESULTS DIFFER" : "");
+    }
+
+    for (int i = 0; i < count; i++) {
+        free (values[i]);
+    }
+    free (values);
+    free (lens);
+}
+
+int
+main (void)
+{
+    // typical tags
+    run (VALUE_COUNT, 2, 10);
+    // long values like comments or lyrics
+    run (VALUE_COUNT / 10, 50, 150);
+    return 0;
+}
@@ -0,0 +1,471 @@
+/*
+    Quick Search Plugin for DeaDBeeF audio player
+    Copyright (C) 2014 Christian Boxdörfer <christian.boxdoerfer@posteo.de>
+
+    This program is free software; you can redistribute it and/or
+    modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation; either version 2
+    of the License, or (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+*/
+
+// Search latency benchmark: builds synthetic libraries against a stub of the
+// player (stub_deadbeef.c), replays the keystroke sequences of
+// keystrokes.txt and reports per keystroke latency, throughput and peak RSS
+// for every search mode. Each library size and mode runs in a process of its
+// own, so the RSS doesn't include what earlier runs left behind.
+//
+// usage: bench_search [-k keystrokes.txt] [-m scan,index,worker,idle] sizes...
+
+#include <math.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+#include <glib.h>
+
+#include "stub_deadbeef.h"
+#include "../search_index.h"
+#include "../search_worker.h"
+#include "../idle_search.h"
+
+DB_functions_t *deadbeef;
+
+#define MAX_KEYSTROKES 4096
+
+static const char *real_artists[] = {
+    "The Beatles", "Metallica", "Björk", "Queen", "ABBA", "Motörhead",
+    "Sigur Rós", "Daft Punk", "Radiohead", "Miles Davis", "Johann Sebastian Bach",
+    "Beyoncé", "Mötley Crüe", "Led Zeppelin", "Pink Floyd", "Nirvana",
+    "Kraftwerk", "Édith Piaf", "Bob Marley", "The Rolling Stones",
+};
+
+static const char *genres[] = {
+    "Rock", "Pop", "Electronic", "Jazz", "Classical", "Hip-Hop", "Metal",
+    "Folk", "Soundtrack", "Blues", "Indie", "Ambient", "Punk", "Reggae",
+    "Country", "Soul", "Funk", "Techno", "Alternative", "Chanson",
+};
+
+// ordered by how often they show up in titles
+static const char *title_words[] = {
+    "the", "love", "you", "of", "me", "my", "in", "night", "heart", "time",
+    "a", "world", "dream", "live", "light", "baby", "fire", "day", "home",
+    "rain", "blue", "road", "soul", "dance", "girl", "remastered", "version",
+    "remix", "feat.", "song", "no.", "part", "minor", "major", "symphony",
+    "café", "über", "señorita", "naïve", "déjà", "vu",
+};
+
+static const char *syllables[] = {
+    "ka", "ro", "mi", "sen", "dar", "vel", "tor", "lin", "bra", "shi", "mon",
+    "el", "ar", "zu", "qui", "ne", "ost", "ry", "ga", "pho", "len", "tis",
+    "ö", "é", "and", "ber", "cro", "dun", "fey", "gul",
+};
+
+#define COUNT(a) ((int)(sizeof (a) / sizeof ((a)[0])))
+
+static double
+now_ms (void)
+{
+    struct timespec ts;
+    clock_gettime (CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e3 + ts.tv_nsec / 1e6;
+}
+
+// the idle search only needs these three from glib, the benchmark runs the
+// idle callbacks itself
+static GSourceFunc idle_fn;
+
+guint
+g_idle_add (GSourceFunc function, gpointer data)
+{
+    idle_fn = function;
+    return 1;
+}
+
+gboolean
+g_source_remove (guint tag)
+{
+    idle_fn = NULL;
+    return TRUE;
+}
+
+gint64
+g_get_monotonic_time (void)
+{
+    return (gint64)(now_ms () * 1000);
+}
+
+static char *
+make_word (int capital)
+{
+    char buf[64] = "";
+    int n = 2 + rand () % 3;
+    for (int i = 0; i < n; i++) {
+        strcat (buf, syllables[rand () % COUNT (syllables)]);
+    }
+    if (capital && buf[0] >= 'a' && buf[0] <= 'z') {
+        buf[0] -= 'a' - 'A';
+    }
+    return strdup (buf);
+}
+
+// zipf distributed index below n, cdf holds the n cumulative weights
+static int
+zipf (const double *cdf, int n)
+{
+    double r = (double)rand () / RAND_MAX * cdf[n - 1];
+    int lo = 0;
+    int hi = n - 1;
+    while (lo < hi) {
+        int mid = (lo + hi) / 2;
+        if (cdf[mid] < r) {
+            lo = mid + 1;
+        }
+        else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+static double *
+zipf_cdf (int n, double s)
+{
+    double *cdf = malloc (n * sizeof (double));
+    double sum = 0;
+    for (int i = 0; i < n; i++) {
+        sum += 1 / pow (i + 1, s);
+        cdf[i] = sum;
+    }
+    return cdf;
+}
+
+static char *
+make_title (const double *word_cdf)
+{
+    char buf[256] = "";
+    int n = 1 + rand () % 5;
+    for (int i = 0; i < n; i++) {
+        if (i) {
+            strcat (buf, " ");
+        }
+        // every third word is a rare one
+        char *word = rand () % 3 ? strdup (title_words[zipf (word_cdf, COUNT (title_words))]) : make_word (0);
+        if (!i && word[0] >= 'a' && word[0] <= 'z') {
+            word[0] -= 'a' - 'A';
+        }
+        strcat (buf, word);
+        free (word);
+    }
+    return strdup (buf);
+}
+
+// fills a playlist with albums of artists whose share of the library
+// follows a zipf distribution, like real collections do
+static ddb_playlist_t *
+make_library (int track_count)
+{
+    srand (1);
+    int artist_count = track_count / 12 > 50 ? track_count / 12 : 50;
+    char **artists = malloc (artist_count * sizeof (char *));
+    const char **artist_genres = malloc (artist_count * sizeof (char *));
+    int *artist_years = malloc (artist_count * sizeof (int));
+    for (int i = 0; i < artist_count; i++) {
+        if (i < COUNT (real_artists)) {
+            artists[i] = strdup (real_artists[i]);
+        }
+        else {
+            char buf[256];
+            char *a = make_word (1);
+            char *b = make_word (1);
+            int kind = rand () % 10;
+            snprintf (buf, sizeof (buf), kind == 0 ? "The %s" : kind < 5 ? "%s" : "%s %s", a, b);
+            free (a);
+            free (b);
+            artists[i] = strdup (buf);
+        }
+        artist_genres[i] = genres[rand () % COUNT (genres)];
+        artist_years[i] = 1955 + rand () % 65;
+    }
+    char *years[100];
+    for (int i = 0; i < 100; i++) {
+        char buf[8];
+        snprintf (buf, sizeof (buf), "%d", 1950 + i);
+        years[i] = strdup (buf);
+    }
+    char *numbers[32];
+    for (int i = 0; i < 32; i++) {
+        char buf[8];
+        snprintf (buf, sizeof (buf), "%d", i + 1);
+        numbers[i] = strdup (buf);
+    }
+    double *artist_cdf = zipf_cdf (artist_count, 0.8);
+    double *word_cdf = zipf_cdf (COUNT (title_words), 1.1);
+
+    ddb_playlist_t *plt = stub_plt_new (track_count);
+    int count = 0;
+    while (count < track_count) {
+        int a = zipf (artist_cdf, artist_count);
+        int compilation = rand () % 20 == 0;
+        char *album;
+        if (rand () % 10 == 0) {
+            char *word = make_word (1);
+            album = malloc (strlen (word) + 16);
+            sprintf (album, "Live at %s", word);
+            free (word);
+        }
+        else {
+            album = make_title (word_cdf);
+        }
+        const char *year = years[(artist_years[a] - 1950 + rand () % 20) % 75];
+        int tracks = 8 + rand () % 7;
+        for (int t = 0; t < tracks && count < track_count; t++, count++) {
+            int artist = compilation ? zipf (artist_cdf, artist_count) : a;
+            char *title = make_title (word_cdf);
+            char *uri = malloc (strlen (artists[artist]) + strlen (album) + strlen (title) + 32);
+            sprintf (uri, "/music/%s/%s/%02d %s.flac", artists[artist], album, t + 1, title);
+            DB_playItem_t *it = stub_track_new (plt, 8);
+            stub_track_add_meta (it, "artist", artists[artist]);
+            stub_track_add_meta (it, "title", title);
+            stub_track_add_meta (it, "album", album);
+            if (compilation) {
+                stub_track_add_meta (it, "album artist", "Various Artists");
+            }
+            stub_track_add_meta (it, "genre", artist_genres[artist]);
+            stub_track_add_meta (it, "year", year);
+            stub_track_add_meta (it, "tracknumber", numbers[t]);
+            stub_track_add_meta (it, ":URI", uri);
+        }
+    }
+    free (artist_cdf);
+    free (word_cdf);
+    return plt;
+}
+
+// returns the texts of the search field after every keystroke
+static int
+load_keystrokes (const char *path, char **texts, int max)
+{
+    FILE *fp = fopen (path, "r");
+    if (!fp) {
+        return -1;
+    }
+    int count = 0;
+    char line[1024];
+    while (fgets (line, sizeof (line), fp) && count < max) {
+        line[strcspn (line, "\n")] = 0;
+        if (line[0] == '#' || !line[0]) {
+            continue;
+        }
+        char text[1024];
+        int len = 0;
+        for (int i = 0; line[i] && count < max; i++) {
+            if (line[i] == '<') {
+                // a whole utf-8 character
+                while (len > 0 && ((unsigned char)text[--len] & 0xc0) == 0x80) {
+                }
+            }
+            else {
+                text[len++] = line[i];
+                // the rest of a multi-byte character comes with the same key
+                if (((unsigned char)line[i + 1] & 0xc0) == 0x80) {
+                    continue;
+                }
+            }
+            text[len] = 0;
+            texts[count++] = strdup (text);
+        }
+        // the field gets cleared before the next query
+        if (count < max) {
+            texts[count++] = strdup ("");
+        }
+    }
+    fclose (fp);
+    return count;
+}
+
+static pthread_mutex_t done_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t done_cond = PTHREAD_COND_INITIALIZER;
+static int done_generation;
+
+static void
+worker_done (int generation, void *user_data)
+{
+    pthread_mutex_lock (&done_mutex);
+    done_generation = generation;
+    pthread_cond_broadcast (&done_cond);
+    pthread_mutex_unlock (&done_mutex);
+}
+
+static int idle_done;
+
+static void
+idle_progress (int generation, int done, void *user_data)
+{
+    idle_done = done;
+}
+
+static double max_slice_ms;
+
+// runs one search in the given mode, returns its duration
+static double
+search (const char *mode, ddb_playlist_t *plt, const char *text)
+{
+    double start = now_ms ();
+    if (!strcmp (mode, "scan")) {
+        deadbeef->pl_lock ();
+        deadbeef->plt_search_process (plt, text);
+        deadbeef->pl_unlock ();
+    }
+    else if (!strcmp (mode, "index")) {
+        qs_index_search (plt, text);
+    }
+    else if (!strcmp (mode, "worker")) {
+        ddb_playlist_t **plts = malloc (sizeof (ddb_playlist_t *));
+        plts[0] = plt;
+        int generation = qs_worker_submit (text, plts, 1);
+        pthread_mutex_lock (&done_mutex);
+        while (done_generation != generation) {
+            pthread_cond_wait (&done_cond, &done_mutex);
+        }
+        pthread_mutex_unlock (&done_mutex);
+    }
+    else {
+        ddb_playlist_t **plts = malloc (sizeof (ddb_playlist_t *));
+        plts[0] = plt;
+        idle_done = 0;
+        qs_idle_submit (text, plts, 1, idle_progress, NULL);
+        while (!idle_done && idle_fn) {
+            double slice_start = now_ms ();
+            if (!idle_fn (NULL)) {
+                idle_fn = NULL;
+            }
+            double slice = now_ms () - slice_start;
+            if (slice > max_slice_ms) {
+                max_slice_ms = slice;
+            }
+        }
+    }
+    return now_ms () - start;
+}
+
+static int
+cmp_double (const void *a, const void *b)
+{
+    double x = *(const double *)a;
+    double y = *(const double *)b;
+    return x < y ? -1 : x > y;
+}
+
+static double
+peak_rss_mb (void)
+{
+    struct rusage usage;
+    getrusage (RUSAGE_SELF, &usage);
+    return usage.ru_maxrss / 1024.0;
+}
+
+static void
+run (int track_count, const char *mode, char **texts, int text_count)
+{
+    deadbeef = stub_init ();
+    double start = now_ms ();
+    ddb_playlist_t *plt = make_library (track_count);
+    double library_ms = now_ms () - start;
+    double library_rss = peak_rss_mb ();
+    if (!strcmp (mode, "worker")) {
+        qs_worker_set_threads (0);
+        qs_worker_start (worker_done, NULL);
+    }
+
+    // the first search builds the index
+    double cold = search (mode, plt, "a");
+    double *latencies = malloc (text_count * sizeof (double));
+    double total = 0;
+    for (int i = 0; i < text_count; i++) {
+        latencies[i] = search (mode, plt, texts[i]);
+        total += latencies[i];
+    }
+    qsort (latencies, text_count, sizeof (double), cmp_double);
+    char slice[32] = "-";
+    if (!strcmp (mode, "idle")) {
+        snprintf (slice, sizeof (slice), "%.1f", max_slice_ms);
+    }
+    // a scan doesn't build an index
+    char index_mb[32] = "-";
+    if (strcmp (mode, "scan")) {
+        snprintf (index_mb, sizeof (index_mb), "%.1f", qs_index_memory () / (1024.0 * 1024.0));
+    }
+    printf ("%8d %-7s %9.1f %8.2f %8.2f %8.2f %9.0f %8s %8s %8.0f %8.0f   (library %.0f ms)\n",
+            track_count, mode, cold, latencies[text_count / 2], latencies[text_count * 99 / 100],
+            latencies[text_count - 1], text_count / (total / 1e3), slice, index_mb,
+            library_rss, peak_rss_mb (), library_ms);
+    fflush (stdout);
+    free (latencies);
+    if (!strcmp (mode, "worker")) {
+        qs_worker_stop ();
+    }
+}
+
+int
+main (int argc, char **argv)
+{
+    const char *keystrokes = "bench/keystrokes.txt";
+    char modes[256] = "scan,index,worker,idle";
+    int opt;
+    while ((opt = getopt (argc, argv, "k:m:")) != -1) {
+        if (opt == 'k') {
+            keystrokes = optarg;
+        }
+        else if (opt == 'm') {
+            snprintf (modes, sizeof (modes), "%s", optarg);
+        }
+        else {
+            fprintf (stderr, "usage: %s [-k keystrokes] [-m scan,index,worker,idle] sizes...\n", argv[0]);
+            return 1;
+        }
+    }
+    static char *texts[MAX_KEYSTROKES];
+    int text_count = load_keystrokes (keystrokes, texts, MAX_KEYSTROKES);
+    if (text_count <= 0) {
+        fprintf (stderr, "no keystrokes in %s\n", keystrokes);
+        return 1;
+    }
+
+    printf ("%d keystrokes from %s, latencies in ms, index and rss in MB\n", text_count, keystrokes);
+    printf ("%8s %-7s %9s %8s %8s %8s %9s %8s %8s %8s %8s\n",
+            "tracks", "mode", "cold", "p50", "p99", "max", "keys/s", "slice", "index", "rss lib", "rss peak");
+    for (int i = optind; i < argc || i == optind; i++) {
+        int track_count = i < argc ? atoi (argv[i]) : 100000;
+        char list[256];
+        snprintf (list, sizeof (list), "%s", modes);
+        for (char *mode = strtok (list, ","); mode; mode = strtok (NULL, ",")) {
+            if (strcmp (mode, "scan") && strcmp (mode, "index") && strcmp (mode, "worker") && strcmp (mode, "idle")) {
+                fprintf (stderr, "unknown mode %s\n", mode);
+                return 1;
+            }
+            // the child would print what's still buffered once more
+            fflush (stdout);
+            pid_t pid = fork ();
+            if (pid == 0) {
+                run (track_count, mode, texts, text_count);
+                _exit (0);
+            }
+            int status;
+            waitpid (pid, &status, 0);
+        }
+    }
+    return 0;
+}
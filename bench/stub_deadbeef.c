@@ -0,0 +1,402 @@
+/*
+    Quick Search Plugin for DeaDBeeF audio player
+    Copyright (C) 2014 Christian Boxdörfer <christian.boxdoerfer@posteo.de>
+
+    This program is free software; you can redistribute it and/or
+    modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation; either version 2
+    of the License, or (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+*/
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "stub_deadbeef.h"
+
+typedef struct stub_plt_s stub_plt_t;
+
+// the metadata lives in the same block as the track
+typedef struct {
+    stub_plt_t *plt;
+    int idx;
+    int selected;
+    int meta_count;
+    DB_metaInfo_t meta[];
+} stub_track_t;
+
+struct stub_plt_s {
+    stub_track_t **tracks;
+    int count;
+    int alloc;
+    int mod_idx;
+};
+
+static stub_plt_t **plts;
+static int plt_count;
+static pthread_mutex_t pl_mutex;
+
+static void
+stub_pl_lock (void)
+{
+    pthread_mutex_lock (&pl_mutex);
+}
+
+static void
+stub_pl_unlock (void)
+{
+    pthread_mutex_unlock (&pl_mutex);
+}
+
+static ddb_playlist_t *
+stub_plt_get_for_idx (int idx)
+{
+    return idx >= 0 && idx < plt_count ? (ddb_playlist_t *)plts[idx] : NULL;
+}
+
+static int
+stub_plt_get_idx (ddb_playlist_t *plt)
+{
+    for (int i = 0; i < plt_count; i++) {
+        if (plts[i] == (stub_plt_t *)plt) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static int
+stub_plt_get_count (void)
+{
+    return plt_count;
+}
+
+// playlists and tracks live until the end of the process
+static void
+stub_plt_ref (ddb_playlist_t *plt)
+{
+}
+
+static void
+stub_item_ref (DB_playItem_t *it)
+{
+}
+
+static int
+stub_plt_get_item_count (ddb_playlist_t *plt, int iter)
+{
+    return ((stub_plt_t *)plt)->count;
+}
+
+static DB_playItem_t *
+stub_plt_get_first (ddb_playlist_t *plt, int iter)
+{
+    stub_plt_t *p = (stub_plt_t *)plt;
+    return p->count ? (DB_playItem_t *)p->tracks[0] : NULL;
+}
+
+static DB_playItem_t *
+stub_pl_get_next (DB_playItem_t *it, int iter)
+{
+    stub_track_t *t = (stub_track_t *)it;
+    return t->idx + 1 < t->plt->count ? (DB_playItem_t *)t->plt->tracks[t->idx + 1] : NULL;
+}
+
+static int
+stub_pl_is_selected (DB_playItem_t *it)
+{
+    return ((stub_track_t *)it)->selected;
+}
+
+static void
+stub_pl_set_selected (DB_playItem_t *it, int sel)
+{
+    ((stub_track_t *)it)->selected = sel;
+}
+
+static void
+stub_plt_deselect_all (ddb_playlist_t *plt)
+{
+    stub_plt_t *p = (stub_plt_t *)plt;
+    for (int i = 0; i < p->count; i++) {
+        p->tracks[i]->selected = 0;
+    }
+}
+
+static void
+stub_plt_search_process (ddb_playlist_t *plt, const char *text)
+{
+    stub_plt_t *p = (stub_plt_t *)plt;
+    for (int i = 0; i < p->count; i++) {
+        stub_track_t *t = p->tracks[i];
+        t->selected = 0;
+        for (int m = 0; *text && !t->selected && m < t->meta_count; m++) {
+            const char *value = t->meta[m].value;
+            if (t->meta[m].key[0] == ':') {
+                // like the player, only the file name of the uri counts
+                if (strcmp (t->meta[m].key, ":URI")) {
+                    continue;
+                }
+                if (strrchr (value, '/')) {
+                    value = strrchr (value, '/') + 1;
+                }
+            }
+            // like the player, every value of a multi-value field counts
+            const char *end = t->meta[m].value + t->meta[m].valuesize;
+            for (const char *v = value; v < end && !t->selected; v += strlen (v) + 1) {
+                t->selected = strcasestr (v, text) != NULL;
+            }
+        }
+    }
+}
+
+static DB_metaInfo_t *
+stub_pl_get_metadata_head (DB_playItem_t *it)
+{
+    stub_track_t *t = (stub_track_t *)it;
+    return t->meta_count ? &t->meta[0] : NULL;
+}
+
+static const char *
+stub_pl_find_meta (DB_playItem_t *it, const char *key)
+{
+    stub_track_t *t = (stub_track_t *)it;
+    for (int m = 0; m < t->meta_count; m++) {
+        if (!strcasecmp (t->meta[m].key, key)) {
+            return t->meta[m].value;
+        }
+    }
+    return NULL;
+}
+
+static int
+stub_plt_get_modification_idx (ddb_playlist_t *plt)
+{
+    return ((stub_plt_t *)plt)->mod_idx;
+}
+
+typedef struct {
+    void (*fn) (void *ctx);
+    void *ctx;
+} stub_thread_t;
+
+static void *
+thread_main (void *arg)
+{
+    stub_thread_t t = *(stub_thread_t *)arg;
+    free (arg);
+    t.fn (t.ctx);
+    return NULL;
+}
+
+static intptr_t
+stub_thread_start (void (*fn) (void *ctx), void *ctx)
+{
+    stub_thread_t *t = malloc (sizeof (stub_thread_t));
+    pthread_t tid;
+    if (!t) {
+        return 0;
+    }
+    t->fn = fn;
+    t->ctx = ctx;
+    if (pthread_create (&tid, NULL, thread_main, t)) {
+        free (t);
+        return 0;
+    }
+    return (intptr_t)tid;
+}
+
+static int
+stub_thread_join (intptr_t tid)
+{
+    return pthread_join ((pthread_t)tid, NULL);
+}
+
+// the player's mutexes are recursive
+static uintptr_t
+stub_mutex_create (void)
+{
+    pthread_mutex_t *m = malloc (sizeof (pthread_mutex_t));
+    pthread_mutexattr_t attr;
+    pthread_mutexattr_init (&attr);
+    pthread_mutexattr_settype (&attr, PTHREAD_MUTEX_RECURSIVE);
+    pthread_mutex_init (m, &attr);
+    pthread_mutexattr_destroy (&attr);
+    return (uintptr_t)m;
+}
+
+static void
+stub_mutex_free (uintptr_t m)
+{
+    pthread_mutex_destroy ((pthread_mutex_t *)m);
+    free ((void *)m);
+}
+
+static int
+stub_mutex_lock (uintptr_t m)
+{
+    return pthread_mutex_lock ((pthread_mutex_t *)m);
+}
+
+static int
+stub_mutex_unlock (uintptr_t m)
+{
+    return pthread_mutex_unlock ((pthread_mutex_t *)m);
+}
+
+static uintptr_t
+stub_cond_create (void)
+{
+    pthread_cond_t *c = malloc (sizeof (pthread_cond_t));
+    pthread_cond_init (c, NULL);
+    return (uintptr_t)c;
+}
+
+static void
+stub_cond_free (uintptr_t c)
+{
+    pthread_cond_destroy ((pthread_cond_t *)c);
+    free ((void *)c);
+}
+
+static int
+stub_cond_wait (uintptr_t c, uintptr_t m)
+{
+    return pthread_cond_wait ((pthread_cond_t *)c, (pthread_mutex_t *)m);
+}
+
+static int
+stub_cond_signal (uintptr_t c)
+{
+    return pthread_cond_signal ((pthread_cond_t *)c);
+}
+
+static int
+stub_cond_broadcast (uintptr_t c)
+{
+    return pthread_cond_broadcast ((pthread_cond_t *)c);
+}
+
+static DB_functions_t api = {
+    .pl_lock = stub_pl_lock,
+    .pl_unlock = stub_pl_unlock,
+    .plt_get_for_idx = stub_plt_get_for_idx,
+    .plt_get_idx = stub_plt_get_idx,
+    .plt_get_count = stub_plt_get_count,
+    .plt_ref = stub_plt_ref,
+    .plt_unref = stub_plt_ref,
+    .plt_get_item_count = stub_plt_get_item_count,
+    .plt_get_first = stub_plt_get_first,
+    .pl_get_next = stub_pl_get_next,
+    .pl_item_ref = stub_item_ref,
+    .pl_item_unref = stub_item_ref,
+    .pl_is_selected = stub_pl_is_selected,
+    .pl_set_selected = stub_pl_set_selected,
+    .plt_deselect_all = stub_plt_deselect_all,
+    .plt_search_process = stub_plt_search_process,
+    .pl_get_metadata_head = stub_pl_get_metadata_head,
+    .pl_find_meta = stub_pl_find_meta,
+    .plt_get_modification_idx = stub_plt_get_modification_idx,
+    .thread_start = stub_thread_start,
+    .thread_join = stub_thread_join,
+    .mutex_create = stub_mutex_create,
+    .mutex_free = stub_mutex_free,
+    .mutex_lock = stub_mutex_lock,
+    .mutex_unlock = stub_mutex_unlock,
+    .cond_create = stub_cond_create,
+    .cond_free = stub_cond_free,
+    .cond_wait = stub_cond_wait,
+    .cond_signal = stub_cond_signal,
+    .cond_broadcast = stub_cond_broadcast,
+};
+
+DB_functions_t *
+stub_init (void)
+{
+    pthread_mutexattr_t attr;
+    pthread_mutexattr_init (&attr);
+    pthread_mutexattr_settype (&attr, PTHREAD_MUTEX_RECURSIVE);
+    pthread_mutex_init (&pl_mutex, &attr);
+    pthread_mutexattr_destroy (&attr);
+    return &api;
+}
+
+ddb_playlist_t *
+stub_plt_new (int reserve)
+{
+    stub_plt_t *p = calloc (1, sizeof (stub_plt_t));
+    stub_plt_t **new_plts = realloc (plts, (plt_count + 1) * sizeof (stub_plt_t *));
+    if (!p || !new_plts) {
+        abort ();
+    }
+    plts = new_plts;
+    plts[plt_count++] = p;
+    p->alloc = reserve > 0 ? reserve : 16;
+    p->tracks = malloc (p->alloc * sizeof (stub_track_t *));
+    if (!p->tracks) {
+        abort ();
+    }
+    return (ddb_playlist_t *)p;
+}
+
+DB_playItem_t *
+stub_track_new (ddb_playlist_t *plt, int meta_count)
+{
+    stub_plt_t *p = (stub_plt_t *)plt;
+    if (p->count == p->alloc) {
+        p->alloc *= 2;
+        p->tracks = realloc (p->tracks, p->alloc * sizeof (stub_track_t *));
+    }
+    stub_track_t *t = malloc (sizeof (stub_track_t) + meta_count * sizeof (DB_metaInfo_t));
+    if (!p->tracks || !t) {
+        abort ();
+    }
+    t->plt = p;
+    t->idx = p->count;
+    t->selected = 0;
+    t->meta_count = 0;
+    p->tracks[p->count++] = t;
+    p->mod_idx++;
+    return (DB_playItem_t *)t;
+}
+
+void
+stub_track_add_meta (DB_playItem_t *it, const char *key, const char *value)
+{
+    stub_track_add_meta_values (it, key, value, strlen (value) + 1);
+}
+
+void
+stub_track_add_meta_values (DB_playItem_t *it, const char *key, const char *values, int size)
+{
+    stub_track_t *t = (stub_track_t *)it;
+    DB_metaInfo_t *m = &t->meta[t->meta_count];
+    memset (m, 0, sizeof (DB_metaInfo_t));
+    m->key = key;
+    m->value = values;
+    m->valuesize = size;
+    if (t->meta_count) {
+        t->meta[t->meta_count - 1].next = m;
+    }
+    t->meta_count++;
+}
+
+int
+stub_plt_sel_count (ddb_playlist_t *plt)
+{
+    stub_plt_t *p = (stub_plt_t *)plt;
+    int n = 0;
+    for (int i = 0; i < p->count; i++) {
+        n += p->tracks[i]->selected;
+    }
+    return n;
+}
@@ -0,0 +1,51 @@
+/*
+    Quick Search Plugin for DeaDBeeF audio player
+    Copyright (C) 2014 Christian Boxdörfer <christian.boxdoerfer@posteo.de>
+
+    This program is free software; you can redistribute it and/or
+    modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation; either version 2
+    of the License, or (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+*/
+
+#ifndef __QS_STUB_DEADBEEF_H
+#define __QS_STUB_DEADBEEF_H
+
+#include <deadbeef/deadbeef.h>
+
+// Just enough of the player for the search code: in-memory playlists of
+// tracks with metadata, pl_lock, threads and a plt_search_process doing a
+// case insensitive substring search like the player's.
+
+DB_functions_t *
+stub_init (void);
+
+ddb_playlist_t *
+stub_plt_new (int reserve);
+
+DB_playItem_t *
+stub_track_new (ddb_playlist_t *plt, int meta_count);
+
+// the strings aren't copied, they have to outlive the track like the
+// player's interned metadata
+void
+stub_track_add_meta (DB_playItem_t *it, const char *key, const char *value);
+
+// adds a field holding several 0-separated values, size covers all of them
+// including the last terminator
+void
+stub_track_add_meta_values (DB_playItem_t *it, const char *key, const char *values, int size);
+
+int
+stub_plt_sel_count (ddb_playlist_t *plt);
+
+#endif
@@ -0,0 +1,84 @@
+/*
+    Quick Search Plugin for DeaDBeeF audio player
+    Copyright (C) 2014 Christian Boxdörfer <christian.boxdoerfer@posteo.de>
+
+    This program is free software; you can redistribute it and/or
+    modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation; either version 2
+    of the License, or (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+*/
+
+#include "quick_search.h"
+#include "change_notify.h"
+#include "trace_event.h"
+
+static int pending = 0;
+static int sent = 0;
+
+void
+qs_notify_begin (void)
+{
+    sent = 0;
+}
+
+void
+qs_notify_add (int changes)
+{
+    pending |= changes;
+}
+
+static void
+send_changed (int p1)
+{
+    deadbeef->sendmessage (DB_EV_PLAYLISTCHANGED, 0, p1, 0);
+    qs_trace_instant ("DB_EV_PLAYLISTCHANGED", NULL, "p1", p1);
+    sent++;
+}
+
+int
+qs_notify_flush (void)
+{
+    int changes = pending;
+    int before = sent;
+    pending = 0;
+#if (DDB_API_LEVEL >= 8)
+    // a content change refreshes the playlists and the search window
+    // completely, the selection included
+    if (changes & QS_CHANGE_CONTENT) {
+        send_changed (DDB_PLAYLIST_CHANGE_CONTENT);
+    }
+    else {
+        if (changes & QS_CHANGE_SELECTION) {
+            send_changed (DDB_PLAYLIST_CHANGE_SELECTION);
+        }
+        if (changes & QS_CHANGE_SEARCHRESULT) {
+            send_changed (DDB_PLAYLIST_CHANGE_SEARCHRESULT);
+        }
+    }
+    if (changes & QS_CHANGE_FOCUS) {
+        deadbeef->sendmessage (DB_EV_FOCUS_SELECTION, 0, PL_MAIN, 0);
+        qs_trace_instant ("DB_EV_FOCUS_SELECTION", NULL, NULL, 0);
+        sent++;
+    }
+#else
+    if (changes) {
+        send_changed (0);
+    }
+#endif
+    return sent - before;
+}
+
+int
+qs_notify_count (void)
+{
+    return sent;
+}
@@ -0,0 +1,51 @@
+/*
+    Quick Search Plugin for DeaDBeeF audio player
+    Copyright (C) 2014 Christian Boxdörfer <christian.boxdoerfer@posteo.de>
+
+    This program is free software; you can redistribute it and/or
+    modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation; either version 2
+    of the License, or (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+*/
+
+#ifndef __QS_CHANGE_NOTIFY_H
+#define __QS_CHANGE_NOTIFY_H
+
+// Collects the playlist changes a search makes and sends the fewest events
+// covering them, every one of which makes the playlist widgets redraw.
+// Main loop only.
+
+enum {
+    QS_CHANGE_SELECTION = 1,
+    QS_CHANGE_SEARCHRESULT = 2,
+    QS_CHANGE_CONTENT = 4,
+    // scroll the current playlist to the selection
+    QS_CHANGE_FOCUS = 8,
+};
+
+// starts counting the events of a new search. Changes not sent yet are
+// kept, the new search sends them along with its own.
+void
+qs_notify_begin (void);
+
+void
+qs_notify_add (int changes);
+
+// sends the collected changes, returns the number of events sent
+int
+qs_notify_flush (void);
+
+// returns the number of events sent since qs_notify_begin
+int
+qs_notify_count (void);
+
+#endif
@@ -0,0 +1,301 @@
+/*
+    Quick Search Plugin for DeaDBeeF audio player
+    Copyright (C) 2014 Christian Boxdörfer <christian.boxdoerfer@posteo.de>
+
+    This program is free software; you can redistribute it and/or
+    modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation; either version 2
+    of the License, or (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+*/
+
+#include <stdint.h>
+#include <string.h>
+
+#include "fold.h"
+#include "fold_table.h"
+
+#define COUNT(a) ((int)(sizeof (a) / sizeof ((a)[0])))
+
+int
+qs_utf8_decode (const char *s, uint32_t *cp)
+{
+    const unsigned char *u = (const unsigned char *)s;
+    if (u[0] < 0x80) {
+        *cp = u[0];
+        return 1;
+    }
+    if ((u[0] & 0xe0) == 0xc0 && (u[1] & 0xc0) == 0x80) {
+        *cp = ((u[0] & 0x1f) << 6) | (u[1] & 0x3f);
+        return 2;
+    }
+    if ((u[0] & 0xf0) == 0xe0 && (u[1] & 0xc0) == 0x80 && (u[2] & 0xc0) == 0x80) {
+        *cp = ((u[0] & 0x0f) << 12) | ((u[1] & 0x3f) << 6) | (u[2] & 0x3f);
+        return 3;
+    }
+    if ((u[0] & 0xf8) == 0xf0 && (u[1] & 0xc0) == 0x80 && (u[2] & 0xc0) == 0x80 && (u[3] & 0xc0) == 0x80) {
+        *cp = ((u[0] & 0x07) << 18) | ((u[1] & 0x3f) << 12) | ((u[2] & 0x3f) << 6) | (u[3] & 0x3f);
+        return 4;
+    }
+    // invalid sequence, pass the byte through
+    *cp = u[0];
+    return 1;
+}
+
+int
+qs_utf8_encode (uint32_t cp, char *out)
+{
+    if (cp < 0x80) {
+        out[0] = cp;
+        return 1;
+    }
+    if (cp < 0x800) {
+        out[0] = 0xc0 | (cp >> 6);
+        out[1] = 0x80 | (cp & 0x3f);
+        return 2;
+    }
+    if (cp < 0x10000) {
+        out[0] = 0xe0 | (cp >> 12);
+        out[1] = 0x80 | ((cp >> 6) & 0x3f);
+        out[2] = 0x80 | (cp & 0x3f);
+        return 3;
+    }
+    out[0] = 0xf0 | (cp >> 18);
+    out[1] = 0x80 | ((cp >> 12) & 0x3f);
+    out[2] = 0x80 | ((cp >> 6) & 0x3f);
+    out[3] = 0x80 | (cp & 0x3f);
+    return 4;
+}
+
+// base letters of latin-1 0xc0-0xff and latin extended-a 0x100-0x17f,
+// '.' marks letters which aren't stripped
+static const char latin1_base[] =
+    "aaaaaa.ceeeeiiii.nooooo.ouuuuy.."
+    "aaaaaa.ceeeeiiii.nooooo.ouuuuy.y";
+static const char latin_ext_a_base[] =
+    "aaaaaaccccccccddddeeeeeeeeeegggggggghhhhiiiiiiiiii..jjkk."
+    "llllllllllnnnnnn...oooooo..rrrrrrsssssssstttttt"
+    "uuuuuuuuuuuuwwyyyzzzzzzs";
+
+// strips the diacritics of greek and cyrillic lower case letters
+static uint32_t
+strip_lower (uint32_t cp)
+{
+    switch (cp) {
+    case 0x3ac:
+        return 0x3b1;
+    case 0x3ad:
+        return 0x3b5;
+    case 0x3ae:
+        return 0x3b7;
+    case 0x3af:
+    case 0x390:
+    case 0x3ca:
+        return 0x3b9;
+    case 0x3cc:
+        return 0x3bf;
+    case 0x3cd:
+    case 0x3b0:
+    case 0x3cb:
+        return 0x3c5;
+    case 0x3ce:
+        return 0x3c9;
+    case 0x3c2:
+        // final sigma
+        return 0x3c3;
+    case 0x450:
+    case 0x451:
+        return 0x435;
+    case 0x453:
+        return 0x433;
+    case 0x457:
+        return 0x456;
+    case 0x45c:
+        return 0x43a;
+    case 0x439:
+    case 0x45d:
+        return 0x438;
+    case 0x45e:
+        return 0x443;
+    }
+    return cp;
+}
+
+uint32_t
+qs_fold_char (uint32_t cp)
+{
+    if (cp < 0x80) {
+        if (cp >= 'A' && cp <= 'Z') {
+            return cp + 0x20;
+        }
+        return cp;
+    }
+    // combining diacritical marks, as found in decomposed text
+    if (cp >= 0x300 && cp <= 0x36f) {
+        return 0;
+    }
+    // fullwidth forms of ascii characters
+    if (cp >= 0xff01 && cp <= 0xff5e) {
+        return qs_fold_char (cp - 0xfee0);
+    }
+    if (cp >= 0xc0 && cp <= 0xff && latin1_base[cp - 0xc0] != '.') {
+        return latin1_base[cp - 0xc0];
+    }
+    if (cp >= 0x100 && cp <= 0x17f && latin_ext_a_base[cp - 0x100] != '.') {
+        return latin_ext_a_base[cp - 0x100];
+    }
+    // latin-1 supplement
+    if (cp >= 0xc0 && cp <= 0xde && cp != 0xd7) {
+        return cp + 0x20;
+    }
+    // latin extended-a, pairs of upper and lower case letters
+    if ((cp >= 0x100 && cp <= 0x137) || (cp >= 0x14a && cp <= 0x177)) {
+        return cp | 1;
+    }
+    if ((cp >= 0x139 && cp <= 0x148) || (cp >= 0x179 && cp <= 0x17e)) {
+        return (cp & 1) ? cp + 1 : cp;
+    }
+    // greek
+    if (cp >= 0x391 && cp <= 0x3ab && cp != 0x3a2) {
+        return strip_lower (cp + 0x20);
+    }
+    switch (cp) {
+    case 0x386:
+        return 0x3b1;
+    case 0x388:
+    case 0x389:
+    case 0x38a:
+        return strip_lower (cp + 0x25);
+    case 0x38c:
+        return 0x3bf;
+    case 0x38e:
+    case 0x38f:
+        return strip_lower (cp + 0x3f);
+    }
+    // cyrillic
+    if (cp >= 0x410 && cp <= 0x42f) {
+        return strip_lower (cp + 0x20);
+    }
+    if (cp >= 0x400 && cp <= 0x40f) {
+        return strip_lower (cp + 0x50);
+    }
+    uint32_t lower = strip_lower (cp);
+    if (lower != cp || cp < 0x180) {
+        return lower;
+    }
+    // everything else is looked up in the table generated from the unicode
+    // data
+    int lo = 0;
+    int hi = COUNT (fold_chars);
+    while (lo < hi) {
+        int mid = (lo + hi) / 2;
+        if (fold_chars[mid][0] < cp) {
+            lo = mid + 1;
+        }
+        else {
+            hi = mid;
+        }
+    }
+    if (lo < COUNT (fold_chars) && fold_chars[lo][0] == cp) {
+        // the base letter can still have a case or diacritic handled above,
+        // like the o of U+01FF LATIN SMALL LETTER O WITH STROKE AND ACUTE
+        return fold_chars[lo][1] ? qs_fold_char (fold_chars[lo][1]) : 0;
+    }
+    return cp;
+}
+
+// returns what cp folds to if that's several characters, or NULL
+static const char *
+fold_text (uint32_t cp)
+{
+    int lo = 0;
+    int hi = COUNT (fold_texts);
+    while (lo < hi) {
+        int mid = (lo + hi) / 2;
+        if (fold_texts[mid].cp < cp) {
+            lo = mid + 1;
+        }
+        else {
+            hi = mid;
+        }
+    }
+    return lo < COUNT (fold_texts) && fold_texts[lo].cp == cp ? fold_texts[lo].text : NULL;
+}
+
+int
+qs_is_word_char (uint32_t cp)
+{
+    if (cp >= 0x80) {
+        return 1;
+    }
+    return (cp >= 'a' && cp <= 'z') || (cp >= 'A' && cp <= 'Z') || (cp >= '0' && cp <= '9');
+}
+
+int
+qs_fold (const char *in, int len, char *out, int size)
+{
+    int i = 0;
+    int o = 0;
+    while (i < len && in[i]) {
+        unsigned char c = in[i];
+        if (c < 0x80) {
+            // ascii fast path
+            if (o + 1 >= size) {
+                break;
+            }
+            out[o++] = (c >= 'A' && c <= 'Z') ? c + 0x20 : c;
+            i++;
+            continue;
+        }
+        uint32_t cp;
+        int n = qs_utf8_decode (in + i, &cp);
+        if (i + n > len) {
+            break;
+        }
+        char buf[4];
+        int l;
+        if (n == 1) {
+            // not utf-8, encoding the byte as a character would take more
+            // space than it did
+            buf[0] = c;
+            l = 1;
+        }
+        else if (cp >= 0xfb00 && cp <= 0xfb06) {
+            // latin ligatures
+            static const char *ligatures[] = { "ff", "fi", "fl", "ffi", "ffl", "st", "st" };
+            l = strlen (ligatures[cp - 0xfb00]);
+            memcpy (buf, ligatures[cp - 0xfb00], l);
+        }
+        else {
+            uint32_t folded = qs_fold_char (cp);
+            const char *text = folded == cp && cp >= 0x180 ? fold_text (cp) : NULL;
+            if (text) {
+                // never longer than the character, see tools/gen_fold_table.py
+                l = strlen (text);
+                memcpy (buf, text, l);
+            }
+            else {
+                l = folded ? qs_utf8_encode (folded, buf) : 0;
+            }
+        }
+        if (o + l >= size) {
+            break;
+        }
+        for (int k = 0; k < l; k++) {
+            out[o++] = buf[k];
+        }
+        i += n;
+    }
+    if (size > 0) {
+        out[o] = 0;
+    }
+    return o;
+}
@@ -0,0 +1,52 @@
+/*
+    Quick Search Plugin for DeaDBeeF audio player
+    Copyright (C) 2014 Christian Boxdörfer <christian.boxdoerfer@posteo.de>
+
+    This program is free software; you can redistribute it and/or
+    modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation; either version 2
+    of the License, or (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+*/
+
+#ifndef __QS_FOLD_H
+#define __QS_FOLD_H
+
+#include <stdint.h>
+
+// decodes the utf-8 character at s, returns its size in bytes
+int
+qs_utf8_decode (const char *s, uint32_t *cp);
+
+// encodes cp into out (at least 4 bytes), returns the number of bytes written
+int
+qs_utf8_encode (uint32_t cp, char *out);
+
+// returns the lower case version of cp without diacritics, or 0 for
+// combining marks which are dropped
+uint32_t
+qs_fold_char (uint32_t cp);
+
+int
+qs_is_word_char (uint32_t cp);
+
+// writes the case folded, 0-terminated version of the first len bytes of in
+// to out and returns its length. Diacritics are stripped and compatibility
+// characters (fullwidth forms, ligatures) replaced, roughly like NFKD
+// normalization followed by removing the combining marks. Beyond latin,
+// greek and cyrillic the mappings come from fold_table.h, which is
+// generated by tools/gen_fold_table.py. Bytes which aren't valid utf-8 are
+// copied as they are and no character folds to a longer encoding, so the
+// result is never longer than the input.
+int
+qs_fold (const char *in, int len, char *out, int size);
+
+#endif
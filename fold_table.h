@@ -0,0 +1,5024 @@
+// generated by tools/gen_fold_table.py from the Unicode 14.0.0 data, don't edit
+
+#ifndef __QS_FOLD_TABLE_H
+#define __QS_FOLD_TABLE_H
+
+// characters folding to a single character, 0 for marks which are dropped
+static const uint32_t fold_chars[][2] = {
+    { 0x181, 0x253 },
+    { 0x182, 0x183 },
+    { 0x184, 0x185 },
+    { 0x186, 0x254 },
+    { 0x187, 0x188 },
+    { 0x189, 0x256 },
+    { 0x18a, 0x257 },
+    { 0x18b, 0x18c },
+    { 0x18e, 0x1dd },
+    { 0x18f, 0x259 },
+    { 0x190, 0x25b },
+    { 0x191, 0x192 },
+    { 0x193, 0x260 },
+    { 0x194, 0x263 },
+    { 0x196, 0x269 },
+    { 0x197, 0x268 },
+    { 0x198, 0x199 },
+    { 0x19c, 0x26f },
+    { 0x19d, 0x272 },
+    { 0x19f, 0x275 },
+    { 0x1a0, 0x6f },
+    { 0x1a1, 0x6f },
+    { 0x1a2, 0x1a3 },
+    { 0x1a4, 0x1a5 },
+    { 0x1a6, 0x280 },
+    { 0x1a7, 0x1a8 },
+    { 0x1a9, 0x283 },
+    { 0x1ac, 0x1ad },
+    { 0x1ae, 0x288 },
+    { 0x1af, 0x75 },
+    { 0x1b0, 0x75 },
+    { 0x1b1, 0x28a },
+    { 0x1b2, 0x28b },
+    { 0x1b3, 0x1b4 },
+    { 0x1b5, 0x1b6 },
+    { 0x1b7, 0x292 },
+    { 0x1b8, 0x1b9 },
+    { 0x1bc, 0x1bd },
+    { 0x1cd, 0x61 },
+    { 0x1ce, 0x61 },
+    { 0x1cf, 0x69 },
+    { 0x1d0, 0x69 },
+    { 0x1d1, 0x6f },
+    { 0x1d2, 0x6f },
+    { 0x1d3, 0x75 },
+    { 0x1d4, 0x75 },
+    { 0x1d5, 0x75 },
+    { 0x1d6, 0x75 },
+    { 0x1d7, 0x75 },
+    { 0x1d8, 0x75 },
+    { 0x1d9, 0x75 },
+    { 0x1da, 0x75 },
+    { 0x1db, 0x75 },
+    { 0x1dc, 0x75 },
+    { 0x1de, 0x61 },
+    { 0x1df, 0x61 },
+    { 0x1e0, 0x61 },
+    { 0x1e1, 0x61 },
+    { 0x1e2, 0xe6 },
+    { 0x1e3, 0xe6 },
+    { 0x1e4, 0x1e5 },
+    { 0x1e6, 0x67 },
+    { 0x1e7, 0x67 },
+    { 0x1e8, 0x6b },
+    { 0x1e9, 0x6b },
+    { 0x1ea, 0x6f },
+    { 0x1eb, 0x6f },
+    { 0x1ec, 0x6f },
+    { 0x1ed, 0x6f },
+    { 0x1ee, 0x292 },
+    { 0x1ef, 0x292 },
+    { 0x1f0, 0x6a },
+    { 0x1f4, 0x67 },
+    { 0x1f5, 0x67 },
+    { 0x1f6, 0x195 },
+    { 0x1f7, 0x1bf },
+    { 0x1f8, 0x6e },
+    { 0x1f9, 0x6e },
+    { 0x1fa, 0x61 },
+    { 0x1fb, 0x61 },
+    { 0x1fc, 0xe6 },
+    { 0x1fd, 0xe6 },
+    { 0x1fe, 0xf8 },
+    { 0x1ff, 0xf8 },
+    { 0x200, 0x61 },
+    { 0x201, 0x61 },
+    { 0x202, 0x61 },
+    { 0x203, 0x61 },
+    { 0x204, 0x65 },
+    { 0x205, 0x65 },
+    { 0x206, 0x65 },
+    { 0x207, 0x65 },
+    { 0x208, 0x69 },
+    { 0x209, 0x69 },
+    { 0x20a, 0x69 },
+    { 0x20b, 0x69 },
+    { 0x20c, 0x6f },
+    { 0x20d, 0x6f },
+    { 0x20e, 0x6f },
+    { 0x20f, 0x6f },
+    { 0x210, 0x72 },
+    { 0x211, 0x72 },
+    { 0x212, 0x72 },
+    { 0x213, 0x72 },
+    { 0x214, 0x75 },
+    { 0x215, 0x75 },
+    { 0x216, 0x75 },
+    { 0x217, 0x75 },
+    { 0x218, 0x73 },
+    { 0x219, 0x73 },
+    { 0x21a, 0x74 },
+    { 0x21b, 0x74 },
+    { 0x21c, 0x21d },
+    { 0x21e, 0x68 },
+    { 0x21f, 0x68 },
+    { 0x220, 0x19e },
+    { 0x222, 0x223 },
+    { 0x224, 0x225 },
+    { 0x226, 0x61 },
+    { 0x227, 0x61 },
+    { 0x228, 0x65 },
+    { 0x229, 0x65 },
+    { 0x22a, 0x6f },
+    { 0x22b, 0x6f },
+    { 0x22c, 0x6f },
+    { 0x22d, 0x6f },
+    { 0x22e, 0x6f },
+    { 0x22f, 0x6f },
+    { 0x230, 0x6f },
+    { 0x231, 0x6f },
+    { 0x232, 0x79 },
+    { 0x233, 0x79 },
+    { 0x23a, 0x61 },
+    { 0x23b, 0x23c },
+    { 0x23d, 0x19a },
+    { 0x23e, 0x74 },
+    { 0x241, 0x242 },
+    { 0x243, 0x180 },
+    { 0x244, 0x289 },
+    { 0x245, 0x28c },
+    { 0x246, 0x247 },
+    { 0x248, 0x249 },
+    { 0x24a, 0x24b },
+    { 0x24c, 0x24d },
+    { 0x24e, 0x24f },
+    { 0x2b0, 0x68 },
+    { 0x2b1, 0x266 },
+    { 0x2b2, 0x6a },
+    { 0x2b3, 0x72 },
+    { 0x2b4, 0x279 },
+    { 0x2b5, 0x27b },
+    { 0x2b6, 0x281 },
+    { 0x2b7, 0x77 },
+    { 0x2b8, 0x79 },
+    { 0x2d8, 0x20 },
+    { 0x2d9, 0x20 },
+    { 0x2da, 0x20 },
+    { 0x2db, 0x20 },
+    { 0x2dc, 0x20 },
+    { 0x2dd, 0x20 },
+    { 0x2e0, 0x263 },
+    { 0x2e1, 0x6c },
+    { 0x2e2, 0x73 },
+    { 0x2e3, 0x78 },
+    { 0x2e4, 0x295 },
+    { 0x370, 0x371 },
+    { 0x372, 0x373 },
+    { 0x374, 0x2b9 },
+    { 0x376, 0x377 },
+    { 0x37a, 0x20 },
+    { 0x37e, 0x3b },
+    { 0x37f, 0x3f3 },
+    { 0x384, 0x20 },
+    { 0x385, 0x20 },
+    { 0x386, 0x3b1 },
+    { 0x387, 0xb7 },
+    { 0x388, 0x3b5 },
+    { 0x389, 0x3b7 },
+    { 0x38a, 0x3b9 },
+    { 0x38c, 0x3bf },
+    { 0x38e, 0x3c5 },
+    { 0x38f, 0x3c9 },
+    { 0x390, 0x3b9 },
+    { 0x391, 0x3b1 },
+    { 0x392, 0x3b2 },
+    { 0x393, 0x3b3 },
+    { 0x394, 0x3b4 },
+    { 0x395, 0x3b5 },
+    { 0x396, 0x3b6 },
+    { 0x397, 0x3b7 },
+    { 0x398, 0x3b8 },
+    { 0x399, 0x3b9 },
+    { 0x39a, 0x3ba },
+    { 0x39b, 0x3bb },
+    { 0x39c, 0x3bc },
+    { 0x39d, 0x3bd },
+    { 0x39e, 0x3be },
+    { 0x39f, 0x3bf },
+    { 0x3a0, 0x3c0 },
+    { 0x3a1, 0x3c1 },
+    { 0x3a3, 0x3c3 },
+    { 0x3a4, 0x3c4 },
+    { 0x3a5, 0x3c5 },
+    { 0x3a6, 0x3c6 },
+    { 0x3a7, 0x3c7 },
+    { 0x3a8, 0x3c8 },
+    { 0x3a9, 0x3c9 },
+    { 0x3aa, 0x3b9 },
+    { 0x3ab, 0x3c5 },
+    { 0x3ac, 0x3b1 },
+    { 0x3ad, 0x3b5 },
+    { 0x3ae, 0x3b7 },
+    { 0x3af, 0x3b9 },
+    { 0x3b0, 0x3c5 },
+    { 0x3ca, 0x3b9 },
+    { 0x3cb, 0x3c5 },
+    { 0x3cc, 0x3bf },
+    { 0x3cd, 0x3c5 },
+    { 0x3ce, 0x3c9 },
+    { 0x3cf, 0x3d7 },
+    { 0x3d0, 0x3b2 },
+    { 0x3d1, 0x3b8 },
+    { 0x3d2, 0x3c5 },
+    { 0x3d3, 0x3c5 },
+    { 0x3d4, 0x3c5 },
+    { 0x3d5, 0x3c6 },
+    { 0x3d6, 0x3c0 },
+    { 0x3d8, 0x3d9 },
+    { 0x3da, 0x3db },
+    { 0x3dc, 0x3dd },
+    { 0x3de, 0x3df },
+    { 0x3e0, 0x3e1 },
+    { 0x3e2, 0x3e3 },
+    { 0x3e4, 0x3e5 },
+    { 0x3e6, 0x3e7 },
+    { 0x3e8, 0x3e9 },
+    { 0x3ea, 0x3eb },
+    { 0x3ec, 0x3ed },
+    { 0x3ee, 0x3ef },
+    { 0x3f0, 0x3ba },
+    { 0x3f1, 0x3c1 },
+    { 0x3f2, 0x3c2 },
+    { 0x3f4, 0x3b8 },
+    { 0x3f5, 0x3b5 },
+    { 0x3f7, 0x3f8 },
+    { 0x3f9, 0x3c3 },
+    { 0x3fa, 0x3fb },
+    { 0x3fd, 0x37b },
+    { 0x3fe, 0x37c },
+    { 0x3ff, 0x37d },
+    { 0x400, 0x435 },
+    { 0x401, 0x435 },
+    { 0x402, 0x452 },
+    { 0x403, 0x433 },
+    { 0x404, 0x454 },
+    { 0x405, 0x455 },
+    { 0x406, 0x456 },
+    { 0x407, 0x456 },
+    { 0x408, 0x458 },
+    { 0x409, 0x459 },
+    { 0x40a, 0x45a },
+    { 0x40b, 0x45b },
+    { 0x40c, 0x43a },
+    { 0x40d, 0x438 },
+    { 0x40e, 0x443 },
+    { 0x40f, 0x45f },
+    { 0x410, 0x430 },
+    { 0x411, 0x431 },
+    { 0x412, 0x432 },
+    { 0x413, 0x433 },
+    { 0x414, 0x434 },
+    { 0x415, 0x435 },
+    { 0x416, 0x436 },
+    { 0x417, 0x437 },
+    { 0x418, 0x438 },
+    { 0x419, 0x438 },
+    { 0x41a, 0x43a },
+    { 0x41b, 0x43b },
+    { 0x41c, 0x43c },
+    { 0x41d, 0x43d },
+    { 0x41e, 0x43e },
+    { 0x41f, 0x43f },
+    { 0x420, 0x440 },
+    { 0x421, 0x441 },
+    { 0x422, 0x442 },
+    { 0x423, 0x443 },
+    { 0x424, 0x444 },
+    { 0x425, 0x445 },
+    { 0x426, 0x446 },
+    { 0x427, 0x447 },
+    { 0x428, 0x448 },
+    { 0x429, 0x449 },
+    { 0x42a, 0x44a },
+    { 0x42b, 0x44b },
+    { 0x42c, 0x44c },
+    { 0x42d, 0x44d },
+    { 0x42e, 0x44e },
+    { 0x42f, 0x44f },
+    { 0x439, 0x438 },
+    { 0x450, 0x435 },
+    { 0x451, 0x435 },
+    { 0x453, 0x433 },
+    { 0x457, 0x456 },
+    { 0x45c, 0x43a },
+    { 0x45d, 0x438 },
+    { 0x45e, 0x443 },
+    { 0x460, 0x461 },
+    { 0x462, 0x463 },
+    { 0x464, 0x465 },
+    { 0x466, 0x467 },
+    { 0x468, 0x469 },
+    { 0x46a, 0x46b },
+    { 0x46c, 0x46d },
+    { 0x46e, 0x46f },
+    { 0x470, 0x471 },
+    { 0x472, 0x473 },
+    { 0x474, 0x475 },
+    { 0x476, 0x475 },
+    { 0x477, 0x475 },
+    { 0x478, 0x479 },
+    { 0x47a, 0x47b },
+    { 0x47c, 0x47d },
+    { 0x47e, 0x47f },
+    { 0x480, 0x481 },
+    { 0x48a, 0x48b },
+    { 0x48c, 0x48d },
+    { 0x48e, 0x48f },
+    { 0x490, 0x491 },
+    { 0x492, 0x493 },
+    { 0x494, 0x495 },
+    { 0x496, 0x497 },
+    { 0x498, 0x499 },
+    { 0x49a, 0x49b },
+    { 0x49c, 0x49d },
+    { 0x49e, 0x49f },
+    { 0x4a0, 0x4a1 },
+    { 0x4a2, 0x4a3 },
+    { 0x4a4, 0x4a5 },
+    { 0x4a6, 0x4a7 },
+    { 0x4a8, 0x4a9 },
+    { 0x4aa, 0x4ab },
+    { 0x4ac, 0x4ad },
+    { 0x4ae, 0x4af },
+    { 0x4b0, 0x4b1 },
+    { 0x4b2, 0x4b3 },
+    { 0x4b4, 0x4b5 },
+    { 0x4b6, 0x4b7 },
+    { 0x4b8, 0x4b9 },
+    { 0x4ba, 0x4bb },
+    { 0x4bc, 0x4bd },
+    { 0x4be, 0x4bf },
+    { 0x4c0, 0x4cf },
+    { 0x4c1, 0x436 },
+    { 0x4c2, 0x436 },
+    { 0x4c3, 0x4c4 },
+    { 0x4c5, 0x4c6 },
+    { 0x4c7, 0x4c8 },
+    { 0x4c9, 0x4ca },
+    { 0x4cb, 0x4cc },
+    { 0x4cd, 0x4ce },
+    { 0x4d0, 0x430 },
+    { 0x4d1, 0x430 },
+    { 0x4d2, 0x430 },
+    { 0x4d3, 0x430 },
+    { 0x4d4, 0x4d5 },
+    { 0x4d6, 0x435 },
+    { 0x4d7, 0x435 },
+    { 0x4d8, 0x4d9 },
+    { 0x4da, 0x4d9 },
+    { 0x4db, 0x4d9 },
+    { 0x4dc, 0x436 },
+    { 0x4dd, 0x436 },
+    { 0x4de, 0x437 },
+    { 0x4df, 0x437 },
+    { 0x4e0, 0x4e1 },
+    { 0x4e2, 0x438 },
+    { 0x4e3, 0x438 },
+    { 0x4e4, 0x438 },
+    { 0x4e5, 0x438 },
+    { 0x4e6, 0x43e },
+    { 0x4e7, 0x43e },
+    { 0x4e8, 0x4e9 },
+    { 0x4ea, 0x4e9 },
+    { 0x4eb, 0x4e9 },
+    { 0x4ec, 0x44d },
+    { 0x4ed, 0x44d },
+    { 0x4ee, 0x443 },
+    { 0x4ef, 0x443 },
+    { 0x4f0, 0x443 },
+    { 0x4f1, 0x443 },
+    { 0x4f2, 0x443 },
+    { 0x4f3, 0x443 },
+    { 0x4f4, 0x447 },
+    { 0x4f5, 0x447 },
+    { 0x4f6, 0x4f7 },
+    { 0x4f8, 0x44b },
+    { 0x4f9, 0x44b },
+    { 0x4fa, 0x4fb },
+    { 0x4fc, 0x4fd },
+    { 0x4fe, 0x4ff },
+    { 0x500, 0x501 },
+    { 0x502, 0x503 },
+    { 0x504, 0x505 },
+    { 0x506, 0x507 },
+    { 0x508, 0x509 },
+    { 0x50a, 0x50b },
+    { 0x50c, 0x50d },
+    { 0x50e, 0x50f },
+    { 0x510, 0x511 },
+    { 0x512, 0x513 },
+    { 0x514, 0x515 },
+    { 0x516, 0x517 },
+    { 0x518, 0x519 },
+    { 0x51a, 0x51b },
+    { 0x51c, 0x51d },
+    { 0x51e, 0x51f },
+    { 0x520, 0x521 },
+    { 0x522, 0x523 },
+    { 0x524, 0x525 },
+    { 0x526, 0x527 },
+    { 0x528, 0x529 },
+    { 0x52a, 0x52b },
+    { 0x52c, 0x52d },
+    { 0x52e, 0x52f },
+    { 0x531, 0x561 },
+    { 0x532, 0x562 },
+    { 0x533, 0x563 },
+    { 0x534, 0x564 },
+    { 0x535, 0x565 },
+    { 0x536, 0x566 },
+    { 0x537, 0x567 },
+    { 0x538, 0x568 },
+    { 0x539, 0x569 },
+    { 0x53a, 0x56a },
+    { 0x53b, 0x56b },
+    { 0x53c, 0x56c },
+    { 0x53d, 0x56d },
+    { 0x53e, 0x56e },
+    { 0x53f, 0x56f },
+    { 0x540, 0x570 },
+    { 0x541, 0x571 },
+    { 0x542, 0x572 },
+    { 0x543, 0x573 },
+    { 0x544, 0x574 },
+    { 0x545, 0x575 },
+    { 0x546, 0x576 },
+    { 0x547, 0x577 },
+    { 0x548, 0x578 },
+    { 0x549, 0x579 },
+    { 0x54a, 0x57a },
+    { 0x54b, 0x57b },
+    { 0x54c, 0x57c },
+    { 0x54d, 0x57d },
+    { 0x54e, 0x57e },
+    { 0x54f, 0x57f },
+    { 0x550, 0x580 },
+    { 0x551, 0x581 },
+    { 0x552, 0x582 },
+    { 0x553, 0x583 },
+    { 0x554, 0x584 },
+    { 0x555, 0x585 },
+    { 0x556, 0x586 },
+    { 0xf0c, 0xf0b },
+    { 0x10a0, 0x2d00 },
+    { 0x10a1, 0x2d01 },
+    { 0x10a2, 0x2d02 },
+    { 0x10a3, 0x2d03 },
+    { 0x10a4, 0x2d04 },
+    { 0x10a5, 0x2d05 },
+    { 0x10a6, 0x2d06 },
+    { 0x10a7, 0x2d07 },
+    { 0x10a8, 0x2d08 },
+    { 0x10a9, 0x2d09 },
+    { 0x10aa, 0x2d0a },
+    { 0x10ab, 0x2d0b },
+    { 0x10ac, 0x2d0c },
+    { 0x10ad, 0x2d0d },
+    { 0x10ae, 0x2d0e },
+    { 0x10af, 0x2d0f },
+    { 0x10b0, 0x2d10 },
+    { 0x10b1, 0x2d11 },
+    { 0x10b2, 0x2d12 },
+    { 0x10b3, 0x2d13 },
+    { 0x10b4, 0x2d14 },
+    { 0x10b5, 0x2d15 },
+    { 0x10b6, 0x2d16 },
+    { 0x10b7, 0x2d17 },
+    { 0x10b8, 0x2d18 },
+    { 0x10b9, 0x2d19 },
+    { 0x10ba, 0x2d1a },
+    { 0x10bb, 0x2d1b },
+    { 0x10bc, 0x2d1c },
+    { 0x10bd, 0x2d1d },
+    { 0x10be, 0x2d1e },
+    { 0x10bf, 0x2d1f },
+    { 0x10c0, 0x2d20 },
+    { 0x10c1, 0x2d21 },
+    { 0x10c2, 0x2d22 },
+    { 0x10c3, 0x2d23 },
+    { 0x10c4, 0x2d24 },
+    { 0x10c5, 0x2d25 },
+    { 0x10c7, 0x2d27 },
+    { 0x10cd, 0x2d2d },
+    { 0x10fc, 0x10dc },
+    { 0x13a0, 0xab70 },
+    { 0x13a1, 0xab71 },
+    { 0x13a2, 0xab72 },
+    { 0x13a3, 0xab73 },
+    { 0x13a4, 0xab74 },
+    { 0x13a5, 0xab75 },
+    { 0x13a6, 0xab76 },
+    { 0x13a7, 0xab77 },
+    { 0x13a8, 0xab78 },
+    { 0x13a9, 0xab79 },
+    { 0x13aa, 0xab7a },
+    { 0x13ab, 0xab7b },
+    { 0x13ac, 0xab7c },
+    { 0x13ad, 0xab7d },
+    { 0x13ae, 0xab7e },
+    { 0x13af, 0xab7f },
+    { 0x13b0, 0xab80 },
+    { 0x13b1, 0xab81 },
+    { 0x13b2, 0xab82 },
+    { 0x13b3, 0xab83 },
+    { 0x13b4, 0xab84 },
+    { 0x13b5, 0xab85 },
+    { 0x13b6, 0xab86 },
+    { 0x13b7, 0xab87 },
+    { 0x13b8, 0xab88 },
+    { 0x13b9, 0xab89 },
+    { 0x13ba, 0xab8a },
+    { 0x13bb, 0xab8b },
+    { 0x13bc, 0xab8c },
+    { 0x13bd, 0xab8d },
+    { 0x13be, 0xab8e },
+    { 0x13bf, 0xab8f },
+    { 0x13c0, 0xab90 },
+    { 0x13c1, 0xab91 },
+    { 0x13c2, 0xab92 },
+    { 0x13c3, 0xab93 },
+    { 0x13c4, 0xab94 },
+    { 0x13c5, 0xab95 },
+    { 0x13c6, 0xab96 },
+    { 0x13c7, 0xab97 },
+    { 0x13c8, 0xab98 },
+    { 0x13c9, 0xab99 },
+    { 0x13ca, 0xab9a },
+    { 0x13cb, 0xab9b },
+    { 0x13cc, 0xab9c },
+    { 0x13cd, 0xab9d },
+    { 0x13ce, 0xab9e },
+    { 0x13cf, 0xab9f },
+    { 0x13d0, 0xaba0 },
+    { 0x13d1, 0xaba1 },
+    { 0x13d2, 0xaba2 },
+    { 0x13d3, 0xaba3 },
+    { 0x13d4, 0xaba4 },
+    { 0x13d5, 0xaba5 },
+    { 0x13d6, 0xaba6 },
+    { 0x13d7, 0xaba7 },
+    { 0x13d8, 0xaba8 },
+    { 0x13d9, 0xaba9 },
+    { 0x13da, 0xabaa },
+    { 0x13db, 0xabab },
+    { 0x13dc, 0xabac },
+    { 0x13dd, 0xabad },
+    { 0x13de, 0xabae },
+    { 0x13df, 0xabaf },
+    { 0x13e0, 0xabb0 },
+    { 0x13e1, 0xabb1 },
+    { 0x13e2, 0xabb2 },
+    { 0x13e3, 0xabb3 },
+    { 0x13e4, 0xabb4 },
+    { 0x13e5, 0xabb5 },
+    { 0x13e6, 0xabb6 },
+    { 0x13e7, 0xabb7 },
+    { 0x13e8, 0xabb8 },
+    { 0x13e9, 0xabb9 },
+    { 0x13ea, 0xabba },
+    { 0x13eb, 0xabbb },
+    { 0x13ec, 0xabbc },
+    { 0x13ed, 0xabbd },
+    { 0x13ee, 0xabbe },
+    { 0x13ef, 0xabbf },
+    { 0x13f0, 0x13f8 },
+    { 0x13f1, 0x13f9 },
+    { 0x13f2, 0x13fa },
+    { 0x13f3, 0x13fb },
+    { 0x13f4, 0x13fc },
+    { 0x13f5, 0x13fd },
+    { 0x1ab0, 0x0 },
+    { 0x1ab1, 0x0 },
+    { 0x1ab2, 0x0 },
+    { 0x1ab3, 0x0 },
+    { 0x1ab4, 0x0 },
+    { 0x1ab5, 0x0 },
+    { 0x1ab6, 0x0 },
+    { 0x1ab7, 0x0 },
+    { 0x1ab8, 0x0 },
+    { 0x1ab9, 0x0 },
+    { 0x1aba, 0x0 },
+    { 0x1abb, 0x0 },
+    { 0x1abc, 0x0 },
+    { 0x1abd, 0x0 },
+    { 0x1abf, 0x0 },
+    { 0x1ac0, 0x0 },
+    { 0x1ac1, 0x0 },
+    { 0x1ac2, 0x0 },
+    { 0x1ac3, 0x0 },
+    { 0x1ac4, 0x0 },
+    { 0x1ac5, 0x0 },
+    { 0x1ac6, 0x0 },
+    { 0x1ac7, 0x0 },
+    { 0x1ac8, 0x0 },
+    { 0x1ac9, 0x0 },
+    { 0x1aca, 0x0 },
+    { 0x1acb, 0x0 },
+    { 0x1acc, 0x0 },
+    { 0x1acd, 0x0 },
+    { 0x1ace, 0x0 },
+    { 0x1c90, 0x10d0 },
+    { 0x1c91, 0x10d1 },
+    { 0x1c92, 0x10d2 },
+    { 0x1c93, 0x10d3 },
+    { 0x1c94, 0x10d4 },
+    { 0x1c95, 0x10d5 },
+    { 0x1c96, 0x10d6 },
+    { 0x1c97, 0x10d7 },
+    { 0x1c98, 0x10d8 },
+    { 0x1c99, 0x10d9 },
+    { 0x1c9a, 0x10da },
+    { 0x1c9b, 0x10db },
+    { 0x1c9c, 0x10dc },
+    { 0x1c9d, 0x10dd },
+    { 0x1c9e, 0x10de },
+    { 0x1c9f, 0x10df },
+    { 0x1ca0, 0x10e0 },
+    { 0x1ca1, 0x10e1 },
+    { 0x1ca2, 0x10e2 },
+    { 0x1ca3, 0x10e3 },
+    { 0x1ca4, 0x10e4 },
+    { 0x1ca5, 0x10e5 },
+    { 0x1ca6, 0x10e6 },
+    { 0x1ca7, 0x10e7 },
+    { 0x1ca8, 0x10e8 },
+    { 0x1ca9, 0x10e9 },
+    { 0x1caa, 0x10ea },
+    { 0x1cab, 0x10eb },
+    { 0x1cac, 0x10ec },
+    { 0x1cad, 0x10ed },
+    { 0x1cae, 0x10ee },
+    { 0x1caf, 0x10ef },
+    { 0x1cb0, 0x10f0 },
+    { 0x1cb1, 0x10f1 },
+    { 0x1cb2, 0x10f2 },
+    { 0x1cb3, 0x10f3 },
+    { 0x1cb4, 0x10f4 },
+    { 0x1cb5, 0x10f5 },
+    { 0x1cb6, 0x10f6 },
+    { 0x1cb7, 0x10f7 },
+    { 0x1cb8, 0x10f8 },
+    { 0x1cb9, 0x10f9 },
+    { 0x1cba, 0x10fa },
+    { 0x1cbd, 0x10fd },
+    { 0x1cbe, 0x10fe },
+    { 0x1cbf, 0x10ff },
+    { 0x1d2c, 0x61 },
+    { 0x1d2d, 0xe6 },
+    { 0x1d2e, 0x62 },
+    { 0x1d30, 0x64 },
+    { 0x1d31, 0x65 },
+    { 0x1d32, 0x1dd },
+    { 0x1d33, 0x67 },
+    { 0x1d34, 0x68 },
+    { 0x1d35, 0x69 },
+    { 0x1d36, 0x6a },
+    { 0x1d37, 0x6b },
+    { 0x1d38, 0x6c },
+    { 0x1d39, 0x6d },
+    { 0x1d3a, 0x6e },
+    { 0x1d3c, 0x6f },
+    { 0x1d3d, 0x223 },
+    { 0x1d3e, 0x70 },
+    { 0x1d3f, 0x72 },
+    { 0x1d40, 0x74 },
+    { 0x1d41, 0x75 },
+    { 0x1d42, 0x77 },
+    { 0x1d43, 0x61 },
+    { 0x1d44, 0x250 },
+    { 0x1d45, 0x251 },
+    { 0x1d46, 0x1d02 },
+    { 0x1d47, 0x62 },
+    { 0x1d48, 0x64 },
+    { 0x1d49, 0x65 },
+    { 0x1d4a, 0x259 },
+    { 0x1d4b, 0x25b },
+    { 0x1d4c, 0x25c },
+    { 0x1d4d, 0x67 },
+    { 0x1d4f, 0x6b },
+    { 0x1d50, 0x6d },
+    { 0x1d51, 0x14b },
+    { 0x1d52, 0x6f },
+    { 0x1d53, 0x254 },
+    { 0x1d54, 0x1d16 },
+    { 0x1d55, 0x1d17 },
+    { 0x1d56, 0x70 },
+    { 0x1d57, 0x74 },
+    { 0x1d58, 0x75 },
+    { 0x1d59, 0x1d1d },
+    { 0x1d5a, 0x26f },
+    { 0x1d5b, 0x76 },
+    { 0x1d5c, 0x1d25 },
+    { 0x1d5d, 0x3b2 },
+    { 0x1d5e, 0x3b3 },
+    { 0x1d5f, 0x3b4 },
+    { 0x1d60, 0x3c6 },
+    { 0x1d61, 0x3c7 },
+    { 0x1d62, 0x69 },
+    { 0x1d63, 0x72 },
+    { 0x1d64, 0x75 },
+    { 0x1d65, 0x76 },
+    { 0x1d66, 0x3b2 },
+    { 0x1d67, 0x3b3 },
+    { 0x1d68, 0x3c1 },
+    { 0x1d69, 0x3c6 },
+    { 0x1d6a, 0x3c7 },
+    { 0x1d78, 0x43d },
+    { 0x1d9b, 0x252 },
+    { 0x1d9c, 0x63 },
+    { 0x1d9d, 0x255 },
+    { 0x1d9e, 0xf0 },
+    { 0x1d9f, 0x25c },
+    { 0x1da0, 0x66 },
+    { 0x1da1, 0x25f },
+    { 0x1da2, 0x261 },
+    { 0x1da3, 0x265 },
+    { 0x1da4, 0x268 },
+    { 0x1da5, 0x269 },
+    { 0x1da6, 0x26a },
+    { 0x1da7, 0x1d7b },
+    { 0x1da8, 0x29d },
+    { 0x1da9, 0x26d },
+    { 0x1daa, 0x1d85 },
+    { 0x1dab, 0x29f },
+    { 0x1dac, 0x271 },
+    { 0x1dad, 0x270 },
+    { 0x1dae, 0x272 },
+    { 0x1daf, 0x273 },
+    { 0x1db0, 0x274 },
+    { 0x1db1, 0x275 },
+    { 0x1db2, 0x278 },
+    { 0x1db3, 0x282 },
+    { 0x1db4, 0x283 },
+    { 0x1db5, 0x1ab },
+    { 0x1db6, 0x289 },
+    { 0x1db7, 0x28a },
+    { 0x1db8, 0x1d1c },
+    { 0x1db9, 0x28b },
+    { 0x1dba, 0x28c },
+    { 0x1dbb, 0x7a },
+    { 0x1dbc, 0x290 },
+    { 0x1dbd, 0x291 },
+    { 0x1dbe, 0x292 },
+    { 0x1dbf, 0x3b8 },
+    { 0x1dc0, 0x0 },
+    { 0x1dc1, 0x0 },
+    { 0x1dc2, 0x0 },
+    { 0x1dc3, 0x0 },
+    { 0x1dc4, 0x0 },
+    { 0x1dc5, 0x0 },
+    { 0x1dc6, 0x0 },
+    { 0x1dc7, 0x0 },
+    { 0x1dc8, 0x0 },
+    { 0x1dc9, 0x0 },
+    { 0x1dca, 0x0 },
+    { 0x1dcb, 0x0 },
+    { 0x1dcc, 0x0 },
+    { 0x1dcd, 0x0 },
+    { 0x1dce, 0x0 },
+    { 0x1dcf, 0x0 },
+    { 0x1dd0, 0x0 },
+    { 0x1dd1, 0x0 },
+    { 0x1dd2, 0x0 },
+    { 0x1dd3, 0x0 },
+    { 0x1dd4, 0x0 },
+    { 0x1dd5, 0x0 },
+    { 0x1dd6, 0x0 },
+    { 0x1dd7, 0x0 },
+    { 0x1dd8, 0x0 },
+    { 0x1dd9, 0x0 },
+    { 0x1dda, 0x0 },
+    { 0x1ddb, 0x0 },
+    { 0x1ddc, 0x0 },
+    { 0x1ddd, 0x0 },
+    { 0x1dde, 0x0 },
+    { 0x1ddf, 0x0 },
+    { 0x1de0, 0x0 },
+    { 0x1de1, 0x0 },
+    { 0x1de2, 0x0 },
+    { 0x1de3, 0x0 },
+    { 0x1de4, 0x0 },
+    { 0x1de5, 0x0 },
+    { 0x1de6, 0x0 },
+    { 0x1de7, 0x0 },
+    { 0x1de8, 0x0 },
+    { 0x1de9, 0x0 },
+    { 0x1dea, 0x0 },
+    { 0x1deb, 0x0 },
+    { 0x1dec, 0x0 },
+    { 0x1ded, 0x0 },
+    { 0x1dee, 0x0 },
+    { 0x1def, 0x0 },
+    { 0x1df0, 0x0 },
+    { 0x1df1, 0x0 },
+    { 0x1df2, 0x0 },
+    { 0x1df3, 0x0 },
+    { 0x1df4, 0x0 },
+    { 0x1df5, 0x0 },
+    { 0x1df6, 0x0 },
+    { 0x1df7, 0x0 },
+    { 0x1df8, 0x0 },
+    { 0x1df9, 0x0 },
+    { 0x1dfa, 0x0 },
+    { 0x1dfb, 0x0 },
+    { 0x1dfc, 0x0 },
+    { 0x1dfd, 0x0 },
+    { 0x1dfe, 0x0 },
+    { 0x1dff, 0x0 },
+    { 0x1e00, 0x61 },
+    { 0x1e01, 0x61 },
+    { 0x1e02, 0x62 },
+    { 0x1e03, 0x62 },
+    { 0x1e04, 0x62 },
+    { 0x1e05, 0x62 },
+    { 0x1e06, 0x62 },
+    { 0x1e07, 0x62 },
+    { 0x1e08, 0x63 },
+    { 0x1e09, 0x63 },
+    { 0x1e0a, 0x64 },
+    { 0x1e0b, 0x64 },
+    { 0x1e0c, 0x64 },
+    { 0x1e0d, 0x64 },
+    { 0x1e0e, 0x64 },
+    { 0x1e0f, 0x64 },
+    { 0x1e10, 0x64 },
+    { 0x1e11, 0x64 },
+    { 0x1e12, 0x64 },
+    { 0x1e13, 0x64 },
+    { 0x1e14, 0x65 },
+    { 0x1e15, 0x65 },
+    { 0x1e16, 0x65 },
+    { 0x1e17, 0x65 },
+    { 0x1e18, 0x65 },
+    { 0x1e19, 0x65 },
+    { 0x1e1a, 0x65 },
+    { 0x1e1b, 0x65 },
+    { 0x1e1c, 0x65 },
+    { 0x1e1d, 0x65 },
+    { 0x1e1e, 0x66 },
+    { 0x1e1f, 0x66 },
+    { 0x1e20, 0x67 },
+    { 0x1e21, 0x67 },
+    { 0x1e22, 0x68 },
+    { 0x1e23, 0x68 },
+    { 0x1e24, 0x68 },
+    { 0x1e25, 0x68 },
+    { 0x1e26, 0x68 },
+    { 0x1e27, 0x68 },
+    { 0x1e28, 0x68 },
+    { 0x1e29, 0x68 },
+    { 0x1e2a, 0x68 },
+    { 0x1e2b, 0x68 },
+    { 0x1e2c, 0x69 },
+    { 0x1e2d, 0x69 },
+    { 0x1e2e, 0x69 },
+    { 0x1e2f, 0x69 },
+    { 0x1e30, 0x6b },
+    { 0x1e31, 0x6b },
+    { 0x1e32, 0x6b },
+    { 0x1e33, 0x6b },
+    { 0x1e34, 0x6b },
+    { 0x1e35, 0x6b },
+    { 0x1e36, 0x6c },
+    { 0x1e37, 0x6c },
+    { 0x1e38, 0x6c },
+    { 0x1e39, 0x6c },
+    { 0x1e3a, 0x6c },
+    { 0x1e3b, 0x6c },
+    { 0x1e3c, 0x6c },
+    { 0x1e3d, 0x6c },
+    { 0x1e3e, 0x6d },
+    { 0x1e3f, 0x6d },
+    { 0x1e40, 0x6d },
+    { 0x1e41, 0x6d },
+    { 0x1e42, 0x6d },
+    { 0x1e43, 0x6d },
+    { 0x1e44, 0x6e },
+    { 0x1e45, 0x6e },
+    { 0x1e46, 0x6e },
+    { 0x1e47, 0x6e },
+    { 0x1e48, 0x6e },
+    { 0x1e49, 0x6e },
+    { 0x1e4a, 0x6e },
+    { 0x1e4b, 0x6e },
+    { 0x1e4c, 0x6f },
+    { 0x1e4d, 0x6f },
+    { 0x1e4e, 0x6f },
+    { 0x1e4f, 0x6f },
+    { 0x1e50, 0x6f },
+    { 0x1e51, 0x6f },
+    { 0x1e52, 0x6f },
+    { 0x1e53, 0x6f },
+    { 0x1e54, 0x70 },
+    { 0x1e55, 0x70 },
+    { 0x1e56, 0x70 },
+    { 0x1e57, 0x70 },
+    { 0x1e58, 0x72 },
+    { 0x1e59, 0x72 },
+    { 0x1e5a, 0x72 },
+    { 0x1e5b, 0x72 },
+    { 0x1e5c, 0x72 },
+    { 0x1e5d, 0x72 },
+    { 0x1e5e, 0x72 },
+    { 0x1e5f, 0x72 },
+    { 0x1e60, 0x73 },
+    { 0x1e61, 0x73 },
+    { 0x1e62, 0x73 },
+    { 0x1e63, 0x73 },
+    { 0x1e64, 0x73 },
+    { 0x1e65, 0x73 },
+    { 0x1e66, 0x73 },
+    { 0x1e67, 0x73 },
+    { 0x1e68, 0x73 },
+    { 0x1e69, 0x73 },
+    { 0x1e6a, 0x74 },
+    { 0x1e6b, 0x74 },
+    { 0x1e6c, 0x74 },
+    { 0x1e6d, 0x74 },
+    { 0x1e6e, 0x74 },
+    { 0x1e6f, 0x74 },
+    { 0x1e70, 0x74 },
+    { 0x1e71, 0x74 },
+    { 0x1e72, 0x75 },
+    { 0x1e73, 0x75 },
+    { 0x1e74, 0x75 },
+    { 0x1e75, 0x75 },
+    { 0x1e76, 0x75 },
+    { 0x1e77, 0x75 },
+    { 0x1e78, 0x75 },
+    { 0x1e79, 0x75 },
+    { 0x1e7a, 0x75 },
+    { 0x1e7b, 0x75 },
+    { 0x1e7c, 0x76 },
+    { 0x1e7d, 0x76 },
+    { 0x1e7e, 0x76 },
+    { 0x1e7f, 0x76 },
+    { 0x1e80, 0x77 },
+    { 0x1e81, 0x77 },
+    { 0x1e82, 0x77 },
+    { 0x1e83, 0x77 },
+    { 0x1e84, 0x77 },
+    { 0x1e85, 0x77 },
+    { 0x1e86, 0x77 },
+    { 0x1e87, 0x77 },
+    { 0x1e88, 0x77 },
+    { 0x1e89, 0x77 },
+    { 0x1e8a, 0x78 },
+    { 0x1e8b, 0x78 },
+    { 0x1e8c, 0x78 },
+    { 0x1e8d, 0x78 },
+    { 0x1e8e, 0x79 },
+    { 0x1e8f, 0x79 },
+    { 0x1e90, 0x7a },
+    { 0x1e91, 0x7a },
+    { 0x1e92, 0x7a },
+    { 0x1e93, 0x7a },
+    { 0x1e94, 0x7a },
+    { 0x1e95, 0x7a },
+    { 0x1e96, 0x68 },
+    { 0x1e97, 0x74 },
+    { 0x1e98, 0x77 },
+    { 0x1e99, 0x79 },
+    { 0x1e9b, 0x73 },
+    { 0x1e9e, 0xdf },
+    { 0x1ea0, 0x61 },
+    { 0x1ea1, 0x61 },
+    { 0x1ea2, 0x61 },
+    { 0x1ea3, 0x61 },
+    { 0x1ea4, 0x61 },
+    { 0x1ea5, 0x61 },
+    { 0x1ea6, 0x61 },
+    { 0x1ea7, 0x61 },
+    { 0x1ea8, 0x61 },
+    { 0x1ea9, 0x61 },
+    { 0x1eaa, 0x61 },
+    { 0x1eab, 0x61 },
+    { 0x1eac, 0x61 },
+    { 0x1ead, 0x61 },
+    { 0x1eae, 0x61 },
+    { 0x1eaf, 0x61 },
+    { 0x1eb0, 0x61 },
+    { 0x1eb1, 0x61 },
+    { 0x1eb2, 0x61 },
+    { 0x1eb3, 0x61 },
+    { 0x1eb4, 0x61 },
+    { 0x1eb5, 0x61 },
+    { 0x1eb6, 0x61 },
+    { 0x1eb7, 0x61 },
+    { 0x1eb8, 0x65 },
+    { 0x1eb9, 0x65 },
+    { 0x1eba, 0x65 },
+    { 0x1ebb, 0x65 },
+    { 0x1ebc, 0x65 },
+    { 0x1ebd, 0x65 },
+    { 0x1ebe, 0x65 },
+    { 0x1ebf, 0x65 },
+    { 0x1ec0, 0x65 },
+    { 0x1ec1, 0x65 },
+    { 0x1ec2, 0x65 },
+    { 0x1ec3, 0x65 },
+    { 0x1ec4, 0x65 },
+    { 0x1ec5, 0x65 },
+    { 0x1ec6, 0x65 },
+    { 0x1ec7, 0x65 },
+    { 0x1ec8, 0x69 },
+    { 0x1ec9, 0x69 },
+    { 0x1eca, 0x69 },
+    { 0x1ecb, 0x69 },
+    { 0x1ecc, 0x6f },
+    { 0x1ecd, 0x6f },
+    { 0x1ece, 0x6f },
+    { 0x1ecf, 0x6f },
+    { 0x1ed0, 0x6f },
+    { 0x1ed1, 0x6f },
+    { 0x1ed2, 0x6f },
+    { 0x1ed3, 0x6f },
+    { 0x1ed4, 0x6f },
+    { 0x1ed5, 0x6f },
+    { 0x1ed6, 0x6f },
+    { 0x1ed7, 0x6f },
+    { 0x1ed8, 0x6f },
+    { 0x1ed9, 0x6f },
+    { 0x1eda, 0x6f },
+    { 0x1edb, 0x6f },
+    { 0x1edc, 0x6f },
+    { 0x1edd, 0x6f },
+    { 0x1ede, 0x6f },
+    { 0x1edf, 0x6f },
+    { 0x1ee0, 0x6f },
+    { 0x1ee1, 0x6f },
+    { 0x1ee2, 0x6f },
+    { 0x1ee3, 0x6f },
+    { 0x1ee4, 0x75 },
+    { 0x1ee5, 0x75 },
+    { 0x1ee6, 0x75 },
+    { 0x1ee7, 0x75 },
+    { 0x1ee8, 0x75 },
+    { 0x1ee9, 0x75 },
+    { 0x1eea, 0x75 },
+    { 0x1eeb, 0x75 },
+    { 0x1eec, 0x75 },
+    { 0x1eed, 0x75 },
+    { 0x1eee, 0x75 },
+    { 0x1eef, 0x75 },
+    { 0x1ef0, 0x75 },
+    { 0x1ef1, 0x75 },
+    { 0x1ef2, 0x79 },
+    { 0x1ef3, 0x79 },
+    { 0x1ef4, 0x79 },
+    { 0x1ef5, 0x79 },
+    { 0x1ef6, 0x79 },
+    { 0x1ef7, 0x79 },
+    { 0x1ef8, 0x79 },
+    { 0x1ef9, 0x79 },
+    { 0x1efa, 0x1efb },
+    { 0x1efc, 0x1efd },
+    { 0x1efe, 0x1eff },
+    { 0x1f00, 0x3b1 },
+    { 0x1f01, 0x3b1 },
+    { 0x1f02, 0x3b1 },
+    { 0x1f03, 0x3b1 },
+    { 0x1f04, 0x3b1 },
+    { 0x1f05, 0x3b1 },
+    { 0x1f06, 0x3b1 },
+    { 0x1f07, 0x3b1 },
+    { 0x1f08, 0x3b1 },
+    { 0x1f09, 0x3b1 },
+    { 0x1f0a, 0x3b1 },
+    { 0x1f0b, 0x3b1 },
+    { 0x1f0c, 0x3b1 },
+    { 0x1f0d, 0x3b1 },
+    { 0x1f0e, 0x3b1 },
+    { 0x1f0f, 0x3b1 },
+    { 0x1f10, 0x3b5 },
+    { 0x1f11, 0x3b5 },
+    { 0x1f12, 0x3b5 },
+    { 0x1f13, 0x3b5 },
+    { 0x1f14, 0x3b5 },
+    { 0x1f15, 0x3b5 },
+    { 0x1f18, 0x3b5 },
+    { 0x1f19, 0x3b5 },
+    { 0x1f1a, 0x3b5 },
+    { 0x1f1b, 0x3b5 },
+    { 0x1f1c, 0x3b5 },
+    { 0x1f1d, 0x3b5 },
+    { 0x1f20, 0x3b7 },
+    { 0x1f21, 0x3b7 },
+    { 0x1f22, 0x3b7 },
+    { 0x1f23, 0x3b7 },
+    { 0x1f24, 0x3b7 },
+    { 0x1f25, 0x3b7 },
+    { 0x1f26, 0x3b7 },
+    { 0x1f27, 0x3b7 },
+    { 0x1f28, 0x3b7 },
+    { 0x1f29, 0x3b7 },
+    { 0x1f2a, 0x3b7 },
+    { 0x1f2b, 0x3b7 },
+    { 0x1f2c, 0x3b7 },
+    { 0x1f2d, 0x3b7 },
+    { 0x1f2e, 0x3b7 },
+    { 0x1f2f, 0x3b7 },
+    { 0x1f30, 0x3b9 },
+    { 0x1f31, 0x3b9 },
+    { 0x1f32, 0x3b9 },
+    { 0x1f33, 0x3b9 },
+    { 0x1f34, 0x3b9 },
+    { 0x1f35, 0x3b9 },
+    { 0x1f36, 0x3b9 },
+    { 0x1f37, 0x3b9 },
+    { 0x1f38, 0x3b9 },
+    { 0x1f39, 0x3b9 },
+    { 0x1f3a, 0x3b9 },
+    { 0x1f3b, 0x3b9 },
+    { 0x1f3c, 0x3b9 },
+    { 0x1f3d, 0x3b9 },
+    { 0x1f3e, 0x3b9 },
+    { 0x1f3f, 0x3b9 },
+    { 0x1f40, 0x3bf },
+    { 0x1f41, 0x3bf },
+    { 0x1f42, 0x3bf },
+    { 0x1f43, 0x3bf },
+    { 0x1f44, 0x3bf },
+    { 0x1f45, 0x3bf },
+    { 0x1f48, 0x3bf },
+    { 0x1f49, 0x3bf },
+    { 0x1f4a, 0x3bf },
+    { 0x1f4b, 0x3bf },
+    { 0x1f4c, 0x3bf },
+    { 0x1f4d, 0x3bf },
+    { 0x1f50, 0x3c5 },
+    { 0x1f51, 0x3c5 },
+    { 0x1f52, 0x3c5 },
+    { 0x1f53, 0x3c5 },
+    { 0x1f54, 0x3c5 },
+    { 0x1f55, 0x3c5 },
+    { 0x1f56, 0x3c5 },
+    { 0x1f57, 0x3c5 },
+    { 0x1f59, 0x3c5 },
+    { 0x1f5b, 0x3c5 },
+    { 0x1f5d, 0x3c5 },
+    { 0x1f5f, 0x3c5 },
+    { 0x1f60, 0x3c9 },
+    { 0x1f61, 0x3c9 },
+    { 0x1f62, 0x3c9 },
+    { 0x1f63, 0x3c9 },
+    { 0x1f64, 0x3c9 },
+    { 0x1f65, 0x3c9 },
+    { 0x1f66, 0x3c9 },
+    { 0x1f67, 0x3c9 },
+    { 0x1f68, 0x3c9 },
+    { 0x1f69, 0x3c9 },
+    { 0x1f6a, 0x3c9 },
+    { 0x1f6b, 0x3c9 },
+    { 0x1f6c, 0x3c9 },
+    { 0x1f6d, 0x3c9 },
+    { 0x1f6e, 0x3c9 },
+    { 0x1f6f, 0x3c9 },
+    { 0x1f70, 0x3b1 },
+    { 0x1f71, 0x3b1 },
+    { 0x1f72, 0x3b5 },
+    { 0x1f73, 0x3b5 },
+    { 0x1f74, 0x3b7 },
+    { 0x1f75, 0x3b7 },
+    { 0x1f76, 0x3b9 },
+    { 0x1f77, 0x3b9 },
+    { 0x1f78, 0x3bf },
+    { 0x1f79, 0x3bf },
+    { 0x1f7a, 0x3c5 },
+    { 0x1f7b, 0x3c5 },
+    { 0x1f7c, 0x3c9 },
+    { 0x1f7d, 0x3c9 },
+    { 0x1f80, 0x3b1 },
+    { 0x1f81, 0x3b1 },
+    { 0x1f82, 0x3b1 },
+    { 0x1f83, 0x3b1 },
+    { 0x1f84, 0x3b1 },
+    { 0x1f85, 0x3b1 },
+    { 0x1f86, 0x3b1 },
+    { 0x1f87, 0x3b1 },
+    { 0x1f88, 0x3b1 },
+    { 0x1f89, 0x3b1 },
+    { 0x1f8a, 0x3b1 },
+    { 0x1f8b, 0x3b1 },
+    { 0x1f8c, 0x3b1 },
+    { 0x1f8d, 0x3b1 },
+    { 0x1f8e, 0x3b1 },
+    { 0x1f8f, 0x3b1 },
+    { 0x1f90, 0x3b7 },
+    { 0x1f91, 0x3b7 },
+    { 0x1f92, 0x3b7 },
+    { 0x1f93, 0x3b7 },
+    { 0x1f94, 0x3b7 },
+    { 0x1f95, 0x3b7 },
+    { 0x1f96, 0x3b7 },
+    { 0x1f97, 0x3b7 },
+    { 0x1f98, 0x3b7 },
+    { 0x1f99, 0x3b7 },
+    { 0x1f9a, 0x3b7 },
+    { 0x1f9b, 0x3b7 },
+    { 0x1f9c, 0x3b7 },
+    { 0x1f9d, 0x3b7 },
+    { 0x1f9e, 0x3b7 },
+    { 0x1f9f, 0x3b7 },
+    { 0x1fa0, 0x3c9 },
+    { 0x1fa1, 0x3c9 },
+    { 0x1fa2, 0x3c9 },
+    { 0x1fa3, 0x3c9 },
+    { 0x1fa4, 0x3c9 },
+    { 0x1fa5, 0x3c9 },
+    { 0x1fa6, 0x3c9 },
+    { 0x1fa7, 0x3c9 },
+    { 0x1fa8, 0x3c9 },
+    { 0x1fa9, 0x3c9 },
+    { 0x1faa, 0x3c9 },
+    { 0x1fab, 0x3c9 },
+    { 0x1fac, 0x3c9 },
+    { 0x1fad, 0x3c9 },
+    { 0x1fae, 0x3c9 },
+    { 0x1faf, 0x3c9 },
+    { 0x1fb0, 0x3b1 },
+    { 0x1fb1, 0x3b1 },
+    { 0x1fb2, 0x3b1 },
+    { 0x1fb3, 0x3b1 },
+    { 0x1fb4, 0x3b1 },
+    { 0x1fb6, 0x3b1 },
+    { 0x1fb7, 0x3b1 },
+    { 0x1fb8, 0x3b1 },
+    { 0x1fb9, 0x3b1 },
+    { 0x1fba, 0x3b1 },
+    { 0x1fbb, 0x3b1 },
+    { 0x1fbc, 0x3b1 },
+    { 0x1fbd, 0x20 },
+    { 0x1fbe, 0x3b9 },
+    { 0x1fbf, 0x20 },
+    { 0x1fc0, 0x20 },
+    { 0x1fc1, 0x20 },
+    { 0x1fc2, 0x3b7 },
+    { 0x1fc3, 0x3b7 },
+    { 0x1fc4, 0x3b7 },
+    { 0x1fc6, 0x3b7 },
+    { 0x1fc7, 0x3b7 },
+    { 0x1fc8, 0x3b5 },
+    { 0x1fc9, 0x3b5 },
+    { 0x1fca, 0x3b7 },
+    { 0x1fcb, 0x3b7 },
+    { 0x1fcc, 0x3b7 },
+    { 0x1fcd, 0x20 },
+    { 0x1fce, 0x20 },
+    { 0x1fcf, 0x20 },
+    { 0x1fd0, 0x3b9 },
+    { 0x1fd1, 0x3b9 },
+    { 0x1fd2, 0x3b9 },
+    { 0x1fd3, 0x3b9 },
+    { 0x1fd6, 0x3b9 },
+    { 0x1fd7, 0x3b9 },
+    { 0x1fd8, 0x3b9 },
+    { 0x1fd9, 0x3b9 },
+    { 0x1fda, 0x3b9 },
+    { 0x1fdb, 0x3b9 },
+    { 0x1fdd, 0x20 },
+    { 0x1fde, 0x20 },
+    { 0x1fdf, 0x20 },
+    { 0x1fe0, 0x3c5 },
+    { 0x1fe1, 0x3c5 },
+    { 0x1fe2, 0x3c5 },
+    { 0x1fe3, 0x3c5 },
+    { 0x1fe4, 0x3c1 },
+    { 0x1fe5, 0x3c1 },
+    { 0x1fe6, 0x3c5 },
+    { 0x1fe7, 0x3c5 },
+    { 0x1fe8, 0x3c5 },
+    { 0x1fe9, 0x3c5 },
+    { 0x1fea, 0x3c5 },
+    { 0x1feb, 0x3c5 },
+    { 0x1fec, 0x3c1 },
+    { 0x1fed, 0x20 },
+    { 0x1fee, 0x20 },
+    { 0x1fef, 0x60 },
+    { 0x1ff2, 0x3c9 },
+    { 0x1ff3, 0x3c9 },
+    { 0x1ff4, 0x3c9 },
+    { 0x1ff6, 0x3c9 },
+    { 0x1ff7, 0x3c9 },
+    { 0x1ff8, 0x3bf },
+    { 0x1ff9, 0x3bf },
+    { 0x1ffa, 0x3c9 },
+    { 0x1ffb, 0x3c9 },
+    { 0x1ffc, 0x3c9 },
+    { 0x1ffd, 0x20 },
+    { 0x1ffe, 0x20 },
+    { 0x2000, 0x20 },
+    { 0x2001, 0x20 },
+    { 0x2002, 0x20 },
+    { 0x2003, 0x20 },
+    { 0x2004, 0x20 },
+    { 0x2005, 0x20 },
+    { 0x2006, 0x20 },
+    { 0x2007, 0x20 },
+    { 0x2008, 0x20 },
+    { 0x2009, 0x20 },
+    { 0x200a, 0x20 },
+    { 0x2011, 0x2010 },
+    { 0x2017, 0x20 },
+    { 0x2024, 0x2e },
+    { 0x202f, 0x20 },
+    { 0x203e, 0x20 },
+    { 0x205f, 0x20 },
+    { 0x2070, 0x30 },
+    { 0x2071, 0x69 },
+    { 0x2074, 0x34 },
+    { 0x2075, 0x35 },
+    { 0x2076, 0x36 },
+    { 0x2077, 0x37 },
+    { 0x2078, 0x38 },
+    { 0x2079, 0x39 },
+    { 0x207a, 0x2b },
+    { 0x207b, 0x2212 },
+    { 0x207c, 0x3d },
+    { 0x207d, 0x28 },
+    { 0x207e, 0x29 },
+    { 0x207f, 0x6e },
+    { 0x2080, 0x30 },
+    { 0x2081, 0x31 },
+    { 0x2082, 0x32 },
+    { 0x2083, 0x33 },
+    { 0x2084, 0x34 },
+    { 0x2085, 0x35 },
+    { 0x2086, 0x36 },
+    { 0x2087, 0x37 },
+    { 0x2088, 0x38 },
+    { 0x2089, 0x39 },
+    { 0x208a, 0x2b },
+    { 0x208b, 0x2212 },
+    { 0x208c, 0x3d },
+    { 0x208d, 0x28 },
+    { 0x208e, 0x29 },
+    { 0x2090, 0x61 },
+    { 0x2091, 0x65 },
+    { 0x2092, 0x6f },
+    { 0x2093, 0x78 },
+    { 0x2094, 0x259 },
+    { 0x2095, 0x68 },
+    { 0x2096, 0x6b },
+    { 0x2097, 0x6c },
+    { 0x2098, 0x6d },
+    { 0x2099, 0x6e },
+    { 0x209a, 0x70 },
+    { 0x209b, 0x73 },
+    { 0x209c, 0x74 },
+    { 0x20d0, 0x0 },
+    { 0x20d1, 0x0 },
+    { 0x20d2, 0x0 },
+    { 0x20d3, 0x0 },
+    { 0x20d4, 0x0 },
+    { 0x20d5, 0x0 },
+    { 0x20d6, 0x0 },
+    { 0x20d7, 0x0 },
+    { 0x20d8, 0x0 },
+    { 0x20d9, 0x0 },
+    { 0x20da, 0x0 },
+    { 0x20db, 0x0 },
+    { 0x20dc, 0x0 },
+    { 0x20e1, 0x0 },
+    { 0x20e5, 0x0 },
+    { 0x20e6, 0x0 },
+    { 0x20e7, 0x0 },
+    { 0x20e8, 0x0 },
+    { 0x20e9, 0x0 },
+    { 0x20ea, 0x0 },
+    { 0x20eb, 0x0 },
+    { 0x20ec, 0x0 },
+    { 0x20ed, 0x0 },
+    { 0x20ee, 0x0 },
+    { 0x20ef, 0x0 },
+    { 0x20f0, 0x0 },
+    { 0x2102, 0x63 },
+    { 0x2107, 0x25b },
+    { 0x210a, 0x67 },
+    { 0x210b, 0x68 },
+    { 0x210c, 0x68 },
+    { 0x210d, 0x68 },
+    { 0x210e, 0x68 },
+    { 0x210f, 0x127 },
+    { 0x2110, 0x69 },
+    { 0x2111, 0x69 },
+    { 0x2112, 0x6c },
+    { 0x2113, 0x6c },
+    { 0x2115, 0x6e },
+    { 0x2119, 0x70 },
+    { 0x211a, 0x71 },
+    { 0x211b, 0x72 },
+    { 0x211c, 0x72 },
+    { 0x211d, 0x72 },
+    { 0x2124, 0x7a },
+    { 0x2126, 0x3c9 },
+    { 0x2128, 0x7a },
+    { 0x212a, 0x6b },
+    { 0x212b, 0x61 },
+    { 0x212c, 0x62 },
+    { 0x212d, 0x63 },
+    { 0x212f, 0x65 },
+    { 0x2130, 0x65 },
+    { 0x2131, 0x66 },
+    { 0x2132, 0x214e },
+    { 0x2133, 0x6d },
+    { 0x2134, 0x6f },
+    { 0x2135, 0x5d0 },
+    { 0x2136, 0x5d1 },
+    { 0x2137, 0x5d2 },
+    { 0x2138, 0x5d3 },
+    { 0x2139, 0x69 },
+    { 0x213c, 0x3c0 },
+    { 0x213d, 0x3b3 },
+    { 0x213e, 0x3b3 },
+    { 0x213f, 0x3c0 },
+    { 0x2140, 0x2211 },
+    { 0x2145, 0x64 },
+    { 0x2146, 0x64 },
+    { 0x2147, 0x65 },
+    { 0x2148, 0x69 },
+    { 0x2149, 0x6a },
+    { 0x2160, 0x69 },
+    { 0x2164, 0x76 },
+    { 0x2167, 0x2177 },
+    { 0x2169, 0x78 },
+    { 0x216c, 0x6c },
+    { 0x216d, 0x63 },
+    { 0x216e, 0x64 },
+    { 0x216f, 0x6d },
+    { 0x2170, 0x69 },
+    { 0x2174, 0x76 },
+    { 0x2179, 0x78 },
+    { 0x217c, 0x6c },
+    { 0x217d, 0x63 },
+    { 0x217e, 0x64 },
+    { 0x217f, 0x6d },
+    { 0x2183, 0x2184 },
+    { 0x219a, 0x2190 },
+    { 0x219b, 0x2192 },
+    { 0x21ae, 0x2194 },
+    { 0x21cd, 0x21d0 },
+    { 0x21ce, 0x21d4 },
+    { 0x21cf, 0x21d2 },
+    { 0x2204, 0x2203 },
+    { 0x2209, 0x2208 },
+    { 0x220c, 0x220b },
+    { 0x2224, 0x2223 },
+    { 0x2226, 0x2225 },
+    { 0x2241, 0x223c },
+    { 0x2244, 0x2243 },
+    { 0x2247, 0x2245 },
+    { 0x2249, 0x2248 },
+    { 0x2260, 0x3d },
+    { 0x2262, 0x2261 },
+    { 0x226d, 0x224d },
+    { 0x226e, 0x3c },
+    { 0x226f, 0x3e },
+    { 0x2270, 0x2264 },
+    { 0x2271, 0x2265 },
+    { 0x2274, 0x2272 },
+    { 0x2275, 0x2273 },
+    { 0x2278, 0x2276 },
+    { 0x2279, 0x2277 },
+    { 0x2280, 0x227a },
+    { 0x2281, 0x227b },
+    { 0x2284, 0x2282 },
+    { 0x2285, 0x2283 },
+    { 0x2288, 0x2286 },
+    { 0x2289, 0x2287 },
+    { 0x22ac, 0x22a2 },
+    { 0x22ad, 0x22a8 },
+    { 0x22ae, 0x22a9 },
+    { 0x22af, 0x22ab },
+    { 0x22e0, 0x227c },
+    { 0x22e1, 0x227d },
+    { 0x22e2, 0x2291 },
+    { 0x22e3, 0x2292 },
+    { 0x22ea, 0x22b2 },
+    { 0x22eb, 0x22b3 },
+    { 0x22ec, 0x22b4 },
+    { 0x22ed, 0x22b5 },
+    { 0x2329, 0x3008 },
+    { 0x232a, 0x3009 },
+    { 0x2460, 0x31 },
+    { 0x2461, 0x32 },
+    { 0x2462, 0x33 },
+    { 0x2463, 0x34 },
+    { 0x2464, 0x35 },
+    { 0x2465, 0x36 },
+    { 0x2466, 0x37 },
+    { 0x2467, 0x38 },
+    { 0x2468, 0x39 },
+    { 0x24b6, 0x61 },
+    { 0x24b7, 0x62 },
+    { 0x24b8, 0x63 },
+    { 0x24b9, 0x64 },
+    { 0x24ba, 0x65 },
+    { 0x24bb, 0x66 },
+    { 0x24bc, 0x67 },
+    { 0x24bd, 0x68 },
+    { 0x24be, 0x69 },
+    { 0x24bf, 0x6a },
+    { 0x24c0, 0x6b },
+    { 0x24c1, 0x6c },
+    { 0x24c2, 0x6d },
+    { 0x24c3, 0x6e },
+    { 0x24c4, 0x6f },
+    { 0x24c5, 0x70 },
+    { 0x24c6, 0x71 },
+    { 0x24c7, 0x72 },
+    { 0x24c8, 0x73 },
+    { 0x24c9, 0x74 },
+    { 0x24ca, 0x75 },
+    { 0x24cb, 0x76 },
+    { 0x24cc, 0x77 },
+    { 0x24cd, 0x78 },
+    { 0x24ce, 0x79 },
+    { 0x24cf, 0x7a },
+    { 0x24d0, 0x61 },
+    { 0x24d1, 0x62 },
+    { 0x24d2, 0x63 },
+    { 0x24d3, 0x64 },
+    { 0x24d4, 0x65 },
+    { 0x24d5, 0x66 },
+    { 0x24d6, 0x67 },
+    { 0x24d7, 0x68 },
+    { 0x24d8, 0x69 },
+    { 0x24d9, 0x6a },
+    { 0x24da, 0x6b },
+    { 0x24db, 0x6c },
+    { 0x24dc, 0x6d },
+    { 0x24dd, 0x6e },
+    { 0x24de, 0x6f },
+    { 0x24df, 0x70 },
+    { 0x24e0, 0x71 },
+    { 0x24e1, 0x72 },
+    { 0x24e2, 0x73 },
+    { 0x24e3, 0x74 },
+    { 0x24e4, 0x75 },
+    { 0x24e5, 0x76 },
+    { 0x24e6, 0x77 },
+    { 0x24e7, 0x78 },
+    { 0x24e8, 0x79 },
+    { 0x24e9, 0x7a },
+    { 0x24ea, 0x30 },
+    { 0x2adc, 0x2add },
+    { 0x2c00, 0x2c30 },
+    { 0x2c01, 0x2c31 },
+    { 0x2c02, 0x2c32 },
+    { 0x2c03, 0x2c33 },
+    { 0x2c04, 0x2c34 },
+    { 0x2c05, 0x2c35 },
+    { 0x2c06, 0x2c36 },
+    { 0x2c07, 0x2c37 },
+    { 0x2c08, 0x2c38 },
+    { 0x2c09, 0x2c39 },
+    { 0x2c0a, 0x2c3a },
+    { 0x2c0b, 0x2c3b },
+    { 0x2c0c, 0x2c3c },
+    { 0x2c0d, 0x2c3d },
+    { 0x2c0e, 0x2c3e },
+    { 0x2c0f, 0x2c3f },
+    { 0x2c10, 0x2c40 },
+    { 0x2c11, 0x2c41 },
+    { 0x2c12, 0x2c42 },
+    { 0x2c13, 0x2c43 },
+    { 0x2c14, 0x2c44 },
+    { 0x2c15, 0x2c45 },
+    { 0x2c16, 0x2c46 },
+    { 0x2c17, 0x2c47 },
+    { 0x2c18, 0x2c48 },
+    { 0x2c19, 0x2c49 },
+    { 0x2c1a, 0x2c4a },
+    { 0x2c1b, 0x2c4b },
+    { 0x2c1c, 0x2c4c },
+    { 0x2c1d, 0x2c4d },
+    { 0x2c1e, 0x2c4e },
+    { 0x2c1f, 0x2c4f },
+    { 0x2c20, 0x2c50 },
+    { 0x2c21, 0x2c51 },
+    { 0x2c22, 0x2c52 },
+    { 0x2c23, 0x2c53 },
+    { 0x2c24, 0x2c54 },
+    { 0x2c25, 0x2c55 },
+    { 0x2c26, 0x2c56 },
+    { 0x2c27, 0x2c57 },
+    { 0x2c28, 0x2c58 },
+    { 0x2c29, 0x2c59 },
+    { 0x2c2a, 0x2c5a },
+    { 0x2c2b, 0x2c5b },
+    { 0x2c2c, 0x2c5c },
+    { 0x2c2d, 0x2c5d },
+    { 0x2c2e, 0x2c5e },
+    { 0x2c2f, 0x2c5f },
+    { 0x2c60, 0x2c61 },
+    { 0x2c62, 0x26b },
+    { 0x2c63, 0x1d7d },
+    { 0x2c64, 0x27d },
+    { 0x2c67, 0x2c68 },
+    { 0x2c69, 0x2c6a },
+    { 0x2c6b, 0x2c6c },
+    { 0x2c6d, 0x251 },
+    { 0x2c6e, 0x271 },
+    { 0x2c6f, 0x250 },
+    { 0x2c70, 0x252 },
+    { 0x2c72, 0x2c73 },
+    { 0x2c75, 0x2c76 },
+    { 0x2c7c, 0x6a },
+    { 0x2c7d, 0x76 },
+    { 0x2c7e, 0x23f },
+    { 0x2c7f, 0x240 },
+    { 0x2c80, 0x2c81 },
+    { 0x2c82, 0x2c83 },
+    { 0x2c84, 0x2c85 },
+    { 0x2c86, 0x2c87 },
+    { 0x2c88, 0x2c89 },
+    { 0x2c8a, 0x2c8b },
+    { 0x2c8c, 0x2c8d },
+    { 0x2c8e, 0x2c8f },
+    { 0x2c90, 0x2c91 },
+    { 0x2c92, 0x2c93 },
+    { 0x2c94, 0x2c95 },
+    { 0x2c96, 0x2c97 },
+    { 0x2c98, 0x2c99 },
+    { 0x2c9a, 0x2c9b },
+    { 0x2c9c, 0x2c9d },
+    { 0x2c9e, 0x2c9f },
+    { 0x2ca0, 0x2ca1 },
+    { 0x2ca2, 0x2ca3 },
+    { 0x2ca4, 0x2ca5 },
+    { 0x2ca6, 0x2ca7 },
+    { 0x2ca8, 0x2ca9 },
+    { 0x2caa, 0x2cab },
+    { 0x2cac, 0x2cad },
+    { 0x2cae, 0x2caf },
+    { 0x2cb0, 0x2cb1 },
+    { 0x2cb2, 0x2cb3 },
+    { 0x2cb4, 0x2cb5 },
+    { 0x2cb6, 0x2cb7 },
+    { 0x2cb8, 0x2cb9 },
+    { 0x2cba, 0x2cbb },
+    { 0x2cbc, 0x2cbd },
+    { 0x2cbe, 0x2cbf },
+    { 0x2cc0, 0x2cc1 },
+    { 0x2cc2, 0x2cc3 },
+    { 0x2cc4, 0x2cc5 },
+    { 0x2cc6, 0x2cc7 },
+    { 0x2cc8, 0x2cc9 },
+    { 0x2cca, 0x2ccb },
+    { 0x2ccc, 0x2ccd },
+    { 0x2cce, 0x2ccf },
+    { 0x2cd0, 0x2cd1 },
+    { 0x2cd2, 0x2cd3 },
+    { 0x2cd4, 0x2cd5 },
+    { 0x2cd6, 0x2cd7 },
+    { 0x2cd8, 0x2cd9 },
+    { 0x2cda, 0x2cdb },
+    { 0x2cdc, 0x2cdd },
+    { 0x2cde, 0x2cdf },
+    { 0x2ce0, 0x2ce1 },
+    { 0x2ce2, 0x2ce3 },
+    { 0x2ceb, 0x2cec },
+    { 0x2ced, 0x2cee },
+    { 0x2cf2, 0x2cf3 },
+    { 0x2d6f, 0x2d61 },
+    { 0x2e9f, 0x6bcd },
+    { 0x2ef3, 0x9f9f },
+    { 0x2f00, 0x4e00 },
+    { 0x2f01, 0x4e28 },
+    { 0x2f02, 0x4e36 },
+    { 0x2f03, 0x4e3f },
+    { 0x2f04, 0x4e59 },
+    { 0x2f05, 0x4e85 },
+    { 0x2f06, 0x4e8c },
+    { 0x2f07, 0x4ea0 },
+    { 0x2f08, 0x4eba },
+    { 0x2f09, 0x513f },
+    { 0x2f0a, 0x5165 },
+    { 0x2f0b, 0x516b },
+    { 0x2f0c, 0x5182 },
+    { 0x2f0d, 0x5196 },
+    { 0x2f0e, 0x51ab },
+    { 0x2f0f, 0x51e0 },
+    { 0x2f10, 0x51f5 },
+    { 0x2f11, 0x5200 },
+    { 0x2f12, 0x529b },
+    { 0x2f13, 0x52f9 },
+    { 0x2f14, 0x5315 },
+    { 0x2f15, 0x531a },
+    { 0x2f16, 0x5338 },
+    { 0x2f17, 0x5341 },
+    { 0x2f18, 0x535c },
+    { 0x2f19, 0x5369 },
+    { 0x2f1a, 0x5382 },
+    { 0x2f1b, 0x53b6 },
+    { 0x2f1c, 0x53c8 },
+    { 0x2f1d, 0x53e3 },
+    { 0x2f1e, 0x56d7 },
+    { 0x2f1f, 0x571f },
+    { 0x2f20, 0x58eb },
+    { 0x2f21, 0x5902 },
+    { 0x2f22, 0x590a },
+    { 0x2f23, 0x5915 },
+    { 0x2f24, 0x5927 },
+    { 0x2f25, 0x5973 },
+    { 0x2f26, 0x5b50 },
+    { 0x2f27, 0x5b80 },
+    { 0x2f28, 0x5bf8 },
+    { 0x2f29, 0x5c0f },
+    { 0x2f2a, 0x5c22 },
+    { 0x2f2b, 0x5c38 },
+    { 0x2f2c, 0x5c6e },
+    { 0x2f2d, 0x5c71 },
+    { 0x2f2e, 0x5ddb },
+    { 0x2f2f, 0x5de5 },
+    { 0x2f30, 0x5df1 },
+    { 0x2f31, 0x5dfe },
+    { 0x2f32, 0x5e72 },
+    { 0x2f33, 0x5e7a },
+    { 0x2f34, 0x5e7f },
+    { 0x2f35, 0x5ef4 },
+    { 0x2f36, 0x5efe },
+    { 0x2f37, 0x5f0b },
+    { 0x2f38, 0x5f13 },
+    { 0x2f39, 0x5f50 },
+    { 0x2f3a, 0x5f61 },
+    { 0x2f3b, 0x5f73 },
+    { 0x2f3c, 0x5fc3 },
+    { 0x2f3d, 0x6208 },
+    { 0x2f3e, 0x6236 },
+    { 0x2f3f, 0x624b },
+    { 0x2f40, 0x652f },
+    { 0x2f41, 0x6534 },
+    { 0x2f42, 0x6587 },
+    { 0x2f43, 0x6597 },
+    { 0x2f44, 0x65a4 },
+    { 0x2f45, 0x65b9 },
+    { 0x2f46, 0x65e0 },
+    { 0x2f47, 0x65e5 },
+    { 0x2f48, 0x66f0 },
+    { 0x2f49, 0x6708 },
+    { 0x2f4a, 0x6728 },
+    { 0x2f4b, 0x6b20 },
+    { 0x2f4c, 0x6b62 },
+    { 0x2f4d, 0x6b79 },
+    { 0x2f4e, 0x6bb3 },
+    { 0x2f4f, 0x6bcb },
+    { 0x2f50, 0x6bd4 },
+    { 0x2f51, 0x6bdb },
+    { 0x2f52, 0x6c0f },
+    { 0x2f53, 0x6c14 },
+    { 0x2f54, 0x6c34 },
+    { 0x2f55, 0x706b },
+    { 0x2f56, 0x722a },
+    { 0x2f57, 0x7236 },
+    { 0x2f58, 0x723b },
+    { 0x2f59, 0x723f },
+    { 0x2f5a, 0x7247 },
+    { 0x2f5b, 0x7259 },
+    { 0x2f5c, 0x725b },
+    { 0x2f5d, 0x72ac },
+    { 0x2f5e, 0x7384 },
+    { 0x2f5f, 0x7389 },
+    { 0x2f60, 0x74dc },
+    { 0x2f61, 0x74e6 },
+    { 0x2f62, 0x7518 },
+    { 0x2f63, 0x751f },
+    { 0x2f64, 0x7528 },
+    { 0x2f65, 0x7530 },
+    { 0x2f66, 0x758b },
+    { 0x2f67, 0x7592 },
+    { 0x2f68, 0x7676 },
+    { 0x2f69, 0x767d },
+    { 0x2f6a, 0x76ae },
+    { 0x2f6b, 0x76bf },
+    { 0x2f6c, 0x76ee },
+    { 0x2f6d, 0x77db },
+    { 0x2f6e, 0x77e2 },
+    { 0x2f6f, 0x77f3 },
+    { 0x2f70, 0x793a },
+    { 0x2f71, 0x79b8 },
+    { 0x2f72, 0x79be },
+    { 0x2f73, 0x7a74 },
+    { 0x2f74, 0x7acb },
+    { 0x2f75, 0x7af9 },
+    { 0x2f76, 0x7c73 },
+    { 0x2f77, 0x7cf8 },
+    { 0x2f78, 0x7f36 },
+    { 0x2f79, 0x7f51 },
+    { 0x2f7a, 0x7f8a },
+    { 0x2f7b, 0x7fbd },
+    { 0x2f7c, 0x8001 },
+    { 0x2f7d, 0x800c },
+    { 0x2f7e, 0x8012 },
+    { 0x2f7f, 0x8033 },
+    { 0x2f80, 0x807f },
+    { 0x2f81, 0x8089 },
+    { 0x2f82, 0x81e3 },
+    { 0x2f83, 0x81ea },
+    { 0x2f84, 0x81f3 },
+    { 0x2f85, 0x81fc },
+    { 0x2f86, 0x820c },
+    { 0x2f87, 0x821b },
+    { 0x2f88, 0x821f },
+    { 0x2f89, 0x826e },
+    { 0x2f8a, 0x8272 },
+    { 0x2f8b, 0x8278 },
+    { 0x2f8c, 0x864d },
+    { 0x2f8d, 0x866b },
+    { 0x2f8e, 0x8840 },
+    { 0x2f8f, 0x884c },
+    { 0x2f90, 0x8863 },
+    { 0x2f91, 0x897e },
+    { 0x2f92, 0x898b },
+    { 0x2f93, 0x89d2 },
+    { 0x2f94, 0x8a00 },
+    { 0x2f95, 0x8c37 },
+    { 0x2f96, 0x8c46 },
+    { 0x2f97, 0x8c55 },
+    { 0x2f98, 0x8c78 },
+    { 0x2f99, 0x8c9d },
+    { 0x2f9a, 0x8d64 },
+    { 0x2f9b, 0x8d70 },
+    { 0x2f9c, 0x8db3 },
+    { 0x2f9d, 0x8eab },
+    { 0x2f9e, 0x8eca },
+    { 0x2f9f, 0x8f9b },
+    { 0x2fa0, 0x8fb0 },
+    { 0x2fa1, 0x8fb5 },
+    { 0x2fa2, 0x9091 },
+    { 0x2fa3, 0x9149 },
+    { 0x2fa4, 0x91c6 },
+    { 0x2fa5, 0x91cc },
+    { 0x2fa6, 0x91d1 },
+    { 0x2fa7, 0x9577 },
+    { 0x2fa8, 0x9580 },
+    { 0x2fa9, 0x961c },
+    { 0x2faa, 0x96b6 },
+    { 0x2fab, 0x96b9 },
+    { 0x2fac, 0x96e8 },
+    { 0x2fad, 0x9751 },
+    { 0x2fae, 0x975e },
+    { 0x2faf, 0x9762 },
+    { 0x2fb0, 0x9769 },
+    { 0x2fb1, 0x97cb },
+    { 0x2fb2, 0x97ed },
+    { 0x2fb3, 0x97f3 },
+    { 0x2fb4, 0x9801 },
+    { 0x2fb5, 0x98a8 },
+    { 0x2fb6, 0x98db },
+    { 0x2fb7, 0x98df },
+    { 0x2fb8, 0x9996 },
+    { 0x2fb9, 0x9999 },
+    { 0x2fba, 0x99ac },
+    { 0x2fbb, 0x9aa8 },
+    { 0x2fbc, 0x9ad8 },
+    { 0x2fbd, 0x9adf },
+    { 0x2fbe, 0x9b25 },
+    { 0x2fbf, 0x9b2f },
+    { 0x2fc0, 0x9b32 },
+    { 0x2fc1, 0x9b3c },
+    { 0x2fc2, 0x9b5a },
+    { 0x2fc3, 0x9ce5 },
+    { 0x2fc4, 0x9e75 },
+    { 0x2fc5, 0x9e7f },
+    { 0x2fc6, 0x9ea5 },
+    { 0x2fc7, 0x9ebb },
+    { 0x2fc8, 0x9ec3 },
+    { 0x2fc9, 0x9ecd },
+    { 0x2fca, 0x9ed1 },
+    { 0x2fcb, 0x9ef9 },
+    { 0x2fcc, 0x9efd },
+    { 0x2fcd, 0x9f0e },
+    { 0x2fce, 0x9f13 },
+    { 0x2fcf, 0x9f20 },
+    { 0x2fd0, 0x9f3b },
+    { 0x2fd1, 0x9f4a },
+    { 0x2fd2, 0x9f52 },
+    { 0x2fd3, 0x9f8d },
+    { 0x2fd4, 0x9f9c },
+    { 0x2fd5, 0x9fa0 },
+    { 0x3000, 0x20 },
+    { 0x3036, 0x3012 },
+    { 0x3038, 0x5341 },
+    { 0x3039, 0x5344 },
+    { 0x303a, 0x5345 },
+    { 0x3131, 0x1100 },
+    { 0x3132, 0x1101 },
+    { 0x3133, 0x11aa },
+    { 0x3134, 0x1102 },
+    { 0x3135, 0x11ac },
+    { 0x3136, 0x11ad },
+    { 0x3137, 0x1103 },
+    { 0x3138, 0x1104 },
+    { 0x3139, 0x1105 },
+    { 0x313a, 0x11b0 },
+    { 0x313b, 0x11b1 },
+    { 0x313c, 0x11b2 },
+    { 0x313d, 0x11b3 },
+    { 0x313e, 0x11b4 },
+    { 0x313f, 0x11b5 },
+    { 0x3140, 0x111a },
+    { 0x3141, 0x1106 },
+    { 0x3142, 0x1107 },
+    { 0x3143, 0x1108 },
+    { 0x3144, 0x1121 },
+    { 0x3145, 0x1109 },
+    { 0x3146, 0x110a },
+    { 0x3147, 0x110b },
+    { 0x3148, 0x110c },
+    { 0x3149, 0x110d },
+    { 0x314a, 0x110e },
+    { 0x314b, 0x110f },
+    { 0x314c, 0x1110 },
+    { 0x314d, 0x1111 },
+    { 0x314e, 0x1112 },
+    { 0x314f, 0x1161 },
+    { 0x3150, 0x1162 },
+    { 0x3151, 0x1163 },
+    { 0x3152, 0x1164 },
+    { 0x3153, 0x1165 },
+    { 0x3154, 0x1166 },
+    { 0x3155, 0x1167 },
+    { 0x3156, 0x1168 },
+    { 0x3157, 0x1169 },
+    { 0x3158, 0x116a },
+    { 0x3159, 0x116b },
+    { 0x315a, 0x116c },
+    { 0x315b, 0x116d },
+    { 0x315c, 0x116e },
+    { 0x315d, 0x116f },
+    { 0x315e, 0x1170 },
+    { 0x315f, 0x1171 },
+    { 0x3160, 0x1172 },
+    { 0x3161, 0x1173 },
+    { 0x3162, 0x1174 },
+    { 0x3163, 0x1175 },
+    { 0x3164, 0x1160 },
+    { 0x3165, 0x1114 },
+    { 0x3166, 0x1115 },
+    { 0x3167, 0x11c7 },
+    { 0x3168, 0x11c8 },
+    { 0x3169, 0x11cc },
+    { 0x316a, 0x11ce },
+    { 0x316b, 0x11d3 },
+    { 0x316c, 0x11d7 },
+    { 0x316d, 0x11d9 },
+    { 0x316e, 0x111c },
+    { 0x316f, 0x11dd },
+    { 0x3170, 0x11df },
+    { 0x3171, 0x111d },
+    { 0x3172, 0x111e },
+    { 0x3173, 0x1120 },
+    { 0x3174, 0x1122 },
+    { 0x3175, 0x1123 },
+    { 0x3176, 0x1127 },
+    { 0x3177, 0x1129 },
+    { 0x3178, 0x112b },
+    { 0x3179, 0x112c },
+    { 0x317a, 0x112d },
+    { 0x317b, 0x112e },
+    { 0x317c, 0x112f },
+    { 0x317d, 0x1132 },
+    { 0x317e, 0x1136 },
+    { 0x317f, 0x1140 },
+    { 0x3180, 0x1147 },
+    { 0x3181, 0x114c },
+    { 0x3182, 0x11f1 },
+    { 0x3183, 0x11f2 },
+    { 0x3184, 0x1157 },
+    { 0x3185, 0x1158 },
+    { 0x3186, 0x1159 },
+    { 0x3187, 0x1184 },
+    { 0x3188, 0x1185 },
+    { 0x3189, 0x1188 },
+    { 0x318a, 0x1191 },
+    { 0x318b, 0x1192 },
+    { 0x318c, 0x1194 },
+    { 0x318d, 0x119e },
+    { 0x318e, 0x11a1 },
+    { 0x3192, 0x4e00 },
+    { 0x3193, 0x4e8c },
+    { 0x3194, 0x4e09 },
+    { 0x3195, 0x56db },
+    { 0x3196, 0x4e0a },
+    { 0x3197, 0x4e2d },
+    { 0x3198, 0x4e0b },
+    { 0x3199, 0x7532 },
+    { 0x319a, 0x4e59 },
+    { 0x319b, 0x4e19 },
+    { 0x319c, 0x4e01 },
+    { 0x319d, 0x5929 },
+    { 0x319e, 0x5730 },
+    { 0x319f, 0x4eba },
+    { 0x3244, 0x554f },
+    { 0x3245, 0x5e7c },
+    { 0x3246, 0x6587 },
+    { 0x3247, 0x7b8f },
+    { 0x3260, 0x1100 },
+    { 0x3261, 0x1102 },
+    { 0x3262, 0x1103 },
+    { 0x3263, 0x1105 },
+    { 0x3264, 0x1106 },
+    { 0x3265, 0x1107 },
+    { 0x3266, 0x1109 },
+    { 0x3267, 0x110b },
+    { 0x3268, 0x110c },
+    { 0x3269, 0x110e },
+    { 0x326a, 0x110f },
+    { 0x326b, 0x1110 },
+    { 0x326c, 0x1111 },
+    { 0x326d, 0x1112 },
+    { 0x3280, 0x4e00 },
+    { 0x3281, 0x4e8c },
+    { 0x3282, 0x4e09 },
+    { 0x3283, 0x56db },
+    { 0x3284, 0x4e94 },
+    { 0x3285, 0x516d },
+    { 0x3286, 0x4e03 },
+    { 0x3287, 0x516b },
+    { 0x3288, 0x4e5d },
+    { 0x3289, 0x5341 },
+    { 0x328a, 0x6708 },
+    { 0x328b, 0x706b },
+    { 0x328c, 0x6c34 },
+    { 0x328d, 0x6728 },
+    { 0x328e, 0x91d1 },
+    { 0x328f, 0x571f },
+    { 0x3290, 0x65e5 },
+    { 0x3291, 0x682a },
+    { 0x3292, 0x6709 },
+    { 0x3293, 0x793e },
+    { 0x3294, 0x540d },
+    { 0x3295, 0x7279 },
+    { 0x3296, 0x8ca1 },
+    { 0x3297, 0x795d },
+    { 0x3298, 0x52b4 },
+    { 0x3299, 0x79d8 },
+    { 0x329a, 0x7537 },
+    { 0x329b, 0x5973 },
+    { 0x329c, 0x9069 },
+    { 0x329d, 0x512a },
+    { 0x329e, 0x5370 },
+    { 0x329f, 0x6ce8 },
+    { 0x32a0, 0x9805 },
+    { 0x32a1, 0x4f11 },
+    { 0x32a2, 0x5199 },
+    { 0x32a3, 0x6b63 },
+    { 0x32a4, 0x4e0a },
+    { 0x32a5, 0x4e2d },
+    { 0x32a6, 0x4e0b },
+    { 0x32a7, 0x5de6 },
+    { 0x32a8, 0x53f3 },
+    { 0x32a9, 0x533b },
+    { 0x32aa, 0x5b97 },
+    { 0x32ab, 0x5b66 },
+    { 0x32ac, 0x76e3 },
+    { 0x32ad, 0x4f01 },
+    { 0x32ae, 0x8cc7 },
+    { 0x32af, 0x5354 },
+    { 0x32b0, 0x591c },
+    { 0x32d0, 0x30a2 },
+    { 0x32d1, 0x30a4 },
+    { 0x32d2, 0x30a6 },
+    { 0x32d3, 0x30a8 },
+    { 0x32d4, 0x30aa },
+    { 0x32d5, 0x30ab },
+    { 0x32d6, 0x30ad },
+    { 0x32d7, 0x30af },
+    { 0x32d8, 0x30b1 },
+    { 0x32d9, 0x30b3 },
+    { 0x32da, 0x30b5 },
+    { 0x32db, 0x30b7 },
+    { 0x32dc, 0x30b9 },
+    { 0x32dd, 0x30bb },
+    { 0x32de, 0x30bd },
+    { 0x32df, 0x30bf },
+    { 0x32e0, 0x30c1 },
+    { 0x32e1, 0x30c4 },
+    { 0x32e2, 0x30c6 },
+    { 0x32e3, 0x30c8 },
+    { 0x32e4, 0x30ca },
+    { 0x32e5, 0x30cb },
+    { 0x32e6, 0x30cc },
+    { 0x32e7, 0x30cd },
+    { 0x32e8, 0x30ce },
+    { 0x32e9, 0x30cf },
+    { 0x32ea, 0x30d2 },
+    { 0x32eb, 0x30d5 },
+    { 0x32ec, 0x30d8 },
+    { 0x32ed, 0x30db },
+    { 0x32ee, 0x30de },
+    { 0x32ef, 0x30df },
+    { 0x32f0, 0x30e0 },
+    { 0x32f1, 0x30e1 },
+    { 0x32f2, 0x30e2 },
+    { 0x32f3, 0x30e4 },
+    { 0x32f4, 0x30e6 },
+    { 0x32f5, 0x30e8 },
+    { 0x32f6, 0x30e9 },
+    { 0x32f7, 0x30ea },
+    { 0x32f8, 0x30eb },
+    { 0x32f9, 0x30ec },
+    { 0x32fa, 0x30ed },
+    { 0x32fb, 0x30ef },
+    { 0x32fc, 0x30f0 },
+    { 0x32fd, 0x30f1 },
+    { 0x32fe, 0x30f2 },
+    { 0xa640, 0xa641 },
+    { 0xa642, 0xa643 },
+    { 0xa644, 0xa645 },
+    { 0xa646, 0xa647 },
+    { 0xa648, 0xa649 },
+    { 0xa64a, 0xa64b },
+    { 0xa64c, 0xa64d },
+    { 0xa64e, 0xa64f },
+    { 0xa650, 0xa651 },
+    { 0xa652, 0xa653 },
+    { 0xa654, 0xa655 },
+    { 0xa656, 0xa657 },
+    { 0xa658, 0xa659 },
+    { 0xa65a, 0xa65b },
+    { 0xa65c, 0xa65d },
+    { 0xa65e, 0xa65f },
+    { 0xa660, 0xa661 },
+    { 0xa662, 0xa663 },
+    { 0xa664, 0xa665 },
+    { 0xa666, 0xa667 },
+    { 0xa668, 0xa669 },
+    { 0xa66a, 0xa66b },
+    { 0xa66c, 0xa66d },
+    { 0xa680, 0xa681 },
+    { 0xa682, 0xa683 },
+    { 0xa684, 0xa685 },
+    { 0xa686, 0xa687 },
+    { 0xa688, 0xa689 },
+    { 0xa68a, 0xa68b },
+    { 0xa68c, 0xa68d },
+    { 0xa68e, 0xa68f },
+    { 0xa690, 0xa691 },
+    { 0xa692, 0xa693 },
+    { 0xa694, 0xa695 },
+    { 0xa696, 0xa697 },
+    { 0xa698, 0xa699 },
+    { 0xa69a, 0xa69b },
+    { 0xa69c, 0x44a },
+    { 0xa69d, 0x44c },
+    { 0xa722, 0xa723 },
+    { 0xa724, 0xa725 },
+    { 0xa726, 0xa727 },
+    { 0xa728, 0xa729 },
+    { 0xa72a, 0xa72b },
+    { 0xa72c, 0xa72d },
+    { 0xa72e, 0xa72f },
+    { 0xa732, 0xa733 },
+    { 0xa734, 0xa735 },
+    { 0xa736, 0xa737 },
+    { 0xa738, 0xa739 },
+    { 0xa73a, 0xa73b },
+    { 0xa73c, 0xa73d },
+    { 0xa73e, 0xa73f },
+    { 0xa740, 0xa741 },
+    { 0xa742, 0xa743 },
+    { 0xa744, 0xa745 },
+    { 0xa746, 0xa747 },
+    { 0xa748, 0xa749 },
+    { 0xa74a, 0xa74b },
+    { 0xa74c, 0xa74d },
+    { 0xa74e, 0xa74f },
+    { 0xa750, 0xa751 },
+    { 0xa752, 0xa753 },
+    { 0xa754, 0xa755 },
+    { 0xa756, 0xa757 },
+    { 0xa758, 0xa759 },
+    { 0xa75a, 0xa75b },
+    { 0xa75c, 0xa75d },
+    { 0xa75e, 0xa75f },
+    { 0xa760, 0xa761 },
+    { 0xa762, 0xa763 },
+    { 0xa764, 0xa765 },
+    { 0xa766, 0xa767 },
+    { 0xa768, 0xa769 },
+    { 0xa76a, 0xa76b },
+    { 0xa76c, 0xa76d },
+    { 0xa76e, 0xa76f },
+    { 0xa770, 0xa76f },
+    { 0xa779, 0xa77a },
+    { 0xa77b, 0xa77c },
+    { 0xa77d, 0x1d79 },
+    { 0xa77e, 0xa77f },
+    { 0xa780, 0xa781 },
+    { 0xa782, 0xa783 },
+    { 0xa784, 0xa785 },
+    { 0xa786, 0xa787 },
+    { 0xa78b, 0xa78c },
+    { 0xa78d, 0x265 },
+    { 0xa790, 0xa791 },
+    { 0xa792, 0xa793 },
+    { 0xa796, 0xa797 },
+    { 0xa798, 0xa799 },
+    { 0xa79a, 0xa79b },
+    { 0xa79c, 0xa79d },
+    { 0xa79e, 0xa79f },
+    { 0xa7a0, 0xa7a1 },
+    { 0xa7a2, 0xa7a3 },
+    { 0xa7a4, 0xa7a5 },
+    { 0xa7a6, 0xa7a7 },
+    { 0xa7a8, 0xa7a9 },
+    { 0xa7aa, 0x266 },
+    { 0xa7ab, 0x25c },
+    { 0xa7ac, 0x261 },
+    { 0xa7ad, 0x26c },
+    { 0xa7ae, 0x26a },
+    { 0xa7b0, 0x29e },
+    { 0xa7b1, 0x287 },
+    { 0xa7b2, 0x29d },
+    { 0xa7b3, 0xab53 },
+    { 0xa7b4, 0xa7b5 },
+    { 0xa7b6, 0xa7b7 },
+    { 0xa7b8, 0xa7b9 },
+    { 0xa7ba, 0xa7bb },
+    { 0xa7bc, 0xa7bd },
+    { 0xa7be, 0xa7bf },
+    { 0xa7c0, 0xa7c1 },
+    { 0xa7c2, 0xa7c3 },
+    { 0xa7c4, 0xa794 },
+    { 0xa7c5, 0x282 },
+    { 0xa7c6, 0x1d8e },
+    { 0xa7c7, 0xa7c8 },
+    { 0xa7c9, 0xa7ca },
+    { 0xa7d0, 0xa7d1 },
+    { 0xa7d6, 0xa7d7 },
+    { 0xa7d8, 0xa7d9 },
+    { 0xa7f2, 0x63 },
+    { 0xa7f3, 0x66 },
+    { 0xa7f4, 0x71 },
+    { 0xa7f5, 0xa7f6 },
+    { 0xa7f8, 0x127 },
+    { 0xa7f9, 0x153 },
+    { 0xab5c, 0xa727 },
+    { 0xab5d, 0xab37 },
+    { 0xab5e, 0x26b },
+    { 0xab5f, 0xab52 },
+    { 0xab69, 0x28d },
+    { 0xf900, 0x8c48 },
+    { 0xf901, 0x66f4 },
+    { 0xf902, 0x8eca },
+    { 0xf903, 0x8cc8 },
+    { 0xf904, 0x6ed1 },
+    { 0xf905, 0x4e32 },
+    { 0xf906, 0x53e5 },
+    { 0xf907, 0x9f9c },
+    { 0xf908, 0x9f9c },
+    { 0xf909, 0x5951 },
+    { 0xf90a, 0x91d1 },
+    { 0xf90b, 0x5587 },
+    { 0xf90c, 0x5948 },
+    { 0xf90d, 0x61f6 },
+    { 0xf90e, 0x7669 },
+    { 0xf90f, 0x7f85 },
+    { 0xf910, 0x863f },
+    { 0xf911, 0x87ba },
+    { 0xf912, 0x88f8 },
+    { 0xf913, 0x908f },
+    { 0xf914, 0x6a02 },
+    { 0xf915, 0x6d1b },
+    { 0xf916, 0x70d9 },
+    { 0xf917, 0x73de },
+    { 0xf918, 0x843d },
+    { 0xf919, 0x916a },
+    { 0xf91a, 0x99f1 },
+    { 0xf91b, 0x4e82 },
+    { 0xf91c, 0x5375 },
+    { 0xf91d, 0x6b04 },
+    { 0xf91e, 0x721b },
+    { 0xf91f, 0x862d },
+    { 0xf920, 0x9e1e },
+    { 0xf921, 0x5d50 },
+    { 0xf922, 0x6feb },
+    { 0xf923, 0x85cd },
+    { 0xf924, 0x8964 },
+    { 0xf925, 0x62c9 },
+    { 0xf926, 0x81d8 },
+    { 0xf927, 0x881f },
+    { 0xf928, 0x5eca },
+    { 0xf929, 0x6717 },
+    { 0xf92a, 0x6d6a },
+    { 0xf92b, 0x72fc },
+    { 0xf92c, 0x90ce },
+    { 0xf92d, 0x4f86 },
+    { 0xf92e, 0x51b7 },
+    { 0xf92f, 0x52de },
+    { 0xf930, 0x64c4 },
+    { 0xf931, 0x6ad3 },
+    { 0xf932, 0x7210 },
+    { 0xf933, 0x76e7 },
+    { 0xf934, 0x8001 },
+    { 0xf935, 0x8606 },
+    { 0xf936, 0x865c },
+    { 0xf937, 0x8def },
+    { 0xf938, 0x9732 },
+    { 0xf939, 0x9b6f },
+    { 0xf93a, 0x9dfa },
+    { 0xf93b, 0x788c },
+    { 0xf93c, 0x797f },
+    { 0xf93d, 0x7da0 },
+    { 0xf93e, 0x83c9 },
+    { 0xf93f, 0x9304 },
+    { 0xf940, 0x9e7f },
+    { 0xf941, 0x8ad6 },
+    { 0xf942, 0x58df },
+    { 0xf943, 0x5f04 },
+    { 0xf944, 0x7c60 },
+    { 0xf945, 0x807e },
+    { 0xf946, 0x7262 },
+    { 0xf947, 0x78ca },
+    { 0xf948, 0x8cc2 },
+    { 0xf949, 0x96f7 },
+    { 0xf94a, 0x58d8 },
+    { 0xf94b, 0x5c62 },
+    { 0xf94c, 0x6a13 },
+    { 0xf94d, 0x6dda },
+    { 0xf94e, 0x6f0f },
+    { 0xf94f, 0x7d2f },
+    { 0xf950, 0x7e37 },
+    { 0xf951, 0x964b },
+    { 0xf952, 0x52d2 },
+    { 0xf953, 0x808b },
+    { 0xf954, 0x51dc },
+    { 0xf955, 0x51cc },
+    { 0xf956, 0x7a1c },
+    { 0xf957, 0x7dbe },
+    { 0xf958, 0x83f1 },
+    { 0xf959, 0x9675 },
+    { 0xf95a, 0x8b80 },
+    { 0xf95b, 0x62cf },
+    { 0xf95c, 0x6a02 },
+    { 0xf95d, 0x8afe },
+    { 0xf95e, 0x4e39 },
+    { 0xf95f, 0x5be7 },
+    { 0xf960, 0x6012 },
+    { 0xf961, 0x7387 },
+    { 0xf962, 0x7570 },
+    { 0xf963, 0x5317 },
+    { 0xf964, 0x78fb },
+    { 0xf965, 0x4fbf },
+    { 0xf966, 0x5fa9 },
+    { 0xf967, 0x4e0d },
+    { 0xf968, 0x6ccc },
+    { 0xf969, 0x6578 },
+    { 0xf96a, 0x7d22 },
+    { 0xf96b, 0x53c3 },
+    { 0xf96c, 0x585e },
+    { 0xf96d, 0x7701 },
+    { 0xf96e, 0x8449 },
+    { 0xf96f, 0x8aaa },
+    { 0xf970, 0x6bba },
+    { 0xf971, 0x8fb0 },
+    { 0xf972, 0x6c88 },
+    { 0xf973, 0x62fe },
+    { 0xf974, 0x82e5 },
+    { 0xf975, 0x63a0 },
+    { 0xf976, 0x7565 },
+    { 0xf977, 0x4eae },
+    { 0xf978, 0x5169 },
+    { 0xf979, 0x51c9 },
+    { 0xf97a, 0x6881 },
+    { 0xf97b, 0x7ce7 },
+    { 0xf97c, 0x826f },
+    { 0xf97d, 0x8ad2 },
+    { 0xf97e, 0x91cf },
+    { 0xf97f, 0x52f5 },
+    { 0xf980, 0x5442 },
+    { 0xf981, 0x5973 },
+    { 0xf982, 0x5eec },
+    { 0xf983, 0x65c5 },
+    { 0xf984, 0x6ffe },
+    { 0xf985, 0x792a },
+    { 0xf986, 0x95ad },
+    { 0xf987, 0x9a6a },
+    { 0xf988, 0x9e97 },
+    { 0xf989, 0x9ece },
+    { 0xf98a, 0x529b },
+    { 0xf98b, 0x66c6 },
+    { 0xf98c, 0x6b77 },
+    { 0xf98d, 0x8f62 },
+    { 0xf98e, 0x5e74 },
+    { 0xf98f, 0x6190 },
+    { 0xf990, 0x6200 },
+    { 0xf991, 0x649a },
+    { 0xf992, 0x6f23 },
+    { 0xf993, 0x7149 },
+    { 0xf994, 0x7489 },
+    { 0xf995, 0x79ca },
+    { 0xf996, 0x7df4 },
+    { 0xf997, 0x806f },
+    { 0xf998, 0x8f26 },
+    { 0xf999, 0x84ee },
+    { 0xf99a, 0x9023 },
+    { 0xf99b, 0x934a },
+    { 0xf99c, 0x5217 },
+    { 0xf99d, 0x52a3 },
+    { 0xf99e, 0x54bd },
+    { 0xf99f, 0x70c8 },
+    { 0xf9a0, 0x88c2 },
+    { 0xf9a1, 0x8aaa },
+    { 0xf9a2, 0x5ec9 },
+    { 0xf9a3, 0x5ff5 },
+    { 0xf9a4, 0x637b },
+    { 0xf9a5, 0x6bae },
+    { 0xf9a6, 0x7c3e },
+    { 0xf9a7, 0x7375 },
+    { 0xf9a8, 0x4ee4 },
+    { 0xf9a9, 0x56f9 },
+    { 0xf9aa, 0x5be7 },
+    { 0xf9ab, 0x5dba },
+    { 0xf9ac, 0x601c },
+    { 0xf9ad, 0x73b2 },
+    { 0xf9ae, 0x7469 },
+    { 0xf9af, 0x7f9a },
+    { 0xf9b0, 0x8046 },
+    { 0xf9b1, 0x9234 },
+    { 0xf9b2, 0x96f6 },
+    { 0xf9b3, 0x9748 },
+    { 0xf9b4, 0x9818 },
+    { 0xf9b5, 0x4f8b },
+    { 0xf9b6, 0x79ae },
+    { 0xf9b7, 0x91b4 },
+    { 0xf9b8, 0x96b8 },
+    { 0xf9b9, 0x60e1 },
+    { 0xf9ba, 0x4e86 },
+    { 0xf9bb, 0x50da },
+    { 0xf9bc, 0x5bee },
+    { 0xf9bd, 0x5c3f },
+    { 0xf9be, 0x6599 },
+    { 0xf9bf, 0x6a02 },
+    { 0xf9c0, 0x71ce },
+    { 0xf9c1, 0x7642 },
+    { 0xf9c2, 0x84fc },
+    { 0xf9c3, 0x907c },
+    { 0xf9c4, 0x9f8d },
+    { 0xf9c5, 0x6688 },
+    { 0xf9c6, 0x962e },
+    { 0xf9c7, 0x5289 },
+    { 0xf9c8, 0x677b },
+    { 0xf9c9, 0x67f3 },
+    { 0xf9ca, 0x6d41 },
+    { 0xf9cb, 0x6e9c },
+    { 0xf9cc, 0x7409 },
+    { 0xf9cd, 0x7559 },
+    { 0xf9ce, 0x786b },
+    { 0xf9cf, 0x7d10 },
+    { 0xf9d0, 0x985e },
+    { 0xf9d1, 0x516d },
+    { 0xf9d2, 0x622e },
+    { 0xf9d3, 0x9678 },
+    { 0xf9d4, 0x502b },
+    { 0xf9d5, 0x5d19 },
+    { 0xf9d6, 0x6dea },
+    { 0xf9d7, 0x8f2a },
+    { 0xf9d8, 0x5f8b },
+    { 0xf9d9, 0x6144 },
+    { 0xf9da, 0x6817 },
+    { 0xf9db, 0x7387 },
+    { 0xf9dc, 0x9686 },
+    { 0xf9dd, 0x5229 },
+    { 0xf9de, 0x540f },
+    { 0xf9df, 0x5c65 },
+    { 0xf9e0, 0x6613 },
+    { 0xf9e1, 0x674e },
+    { 0xf9e2, 0x68a8 },
+    { 0xf9e3, 0x6ce5 },
+    { 0xf9e4, 0x7406 },
+    { 0xf9e5, 0x75e2 },
+    { 0xf9e6, 0x7f79 },
+    { 0xf9e7, 0x88cf },
+    { 0xf9e8, 0x88e1 },
+    { 0xf9e9, 0x91cc },
+    { 0xf9ea, 0x96e2 },
+    { 0xf9eb, 0x533f },
+    { 0xf9ec, 0x6eba },
+    { 0xf9ed, 0x541d },
+    { 0xf9ee, 0x71d0 },
+    { 0xf9ef, 0x7498 },
+    { 0xf9f0, 0x85fa },
+    { 0xf9f1, 0x96a3 },
+    { 0xf9f2, 0x9c57 },
+    { 0xf9f3, 0x9e9f },
+    { 0xf9f4, 0x6797 },
+    { 0xf9f5, 0x6dcb },
+    { 0xf9f6, 0x81e8 },
+    { 0xf9f7, 0x7acb },
+    { 0xf9f8, 0x7b20 },
+    { 0xf9f9, 0x7c92 },
+    { 0xf9fa, 0x72c0 },
+    { 0xf9fb, 0x7099 },
+    { 0xf9fc, 0x8b58 },
+    { 0xf9fd, 0x4ec0 },
+    { 0xf9fe, 0x8336 },
+    { 0xf9ff, 0x523a },
+    { 0xfa00, 0x5207 },
+    { 0xfa01, 0x5ea6 },
+    { 0xfa02, 0x62d3 },
+    { 0xfa03, 0x7cd6 },
+    { 0xfa04, 0x5b85 },
+    { 0xfa05, 0x6d1e },
+    { 0xfa06, 0x66b4 },
+    { 0xfa07, 0x8f3b },
+    { 0xfa08, 0x884c },
+    { 0xfa09, 0x964d },
+    { 0xfa0a, 0x898b },
+    { 0xfa0b, 0x5ed3 },
+    { 0xfa0c, 0x5140 },
+    { 0xfa0d, 0x55c0 },
+    { 0xfa10, 0x585a },
+    { 0xfa12, 0x6674 },
+    { 0xfa15, 0x51de },
+    { 0xfa16, 0x732a },
+    { 0xfa17, 0x76ca },
+    { 0xfa18, 0x793c },
+    { 0xfa19, 0x795e },
+    { 0xfa1a, 0x7965 },
+    { 0xfa1b, 0x798f },
+    { 0xfa1c, 0x9756 },
+    { 0xfa1d, 0x7cbe },
+    { 0xfa1e, 0x7fbd },
+    { 0xfa20, 0x8612 },
+    { 0xfa22, 0x8af8 },
+    { 0xfa25, 0x9038 },
+    { 0xfa26, 0x90fd },
+    { 0xfa2a, 0x98ef },
+    { 0xfa2b, 0x98fc },
+    { 0xfa2c, 0x9928 },
+    { 0xfa2d, 0x9db4 },
+    { 0xfa2e, 0x90de },
+    { 0xfa2f, 0x96b7 },
+    { 0xfa30, 0x4fae },
+    { 0xfa31, 0x50e7 },
+    { 0xfa32, 0x514d },
+    { 0xfa33, 0x52c9 },
+    { 0xfa34, 0x52e4 },
+    { 0xfa35, 0x5351 },
+    { 0xfa36, 0x559d },
+    { 0xfa37, 0x5606 },
+    { 0xfa38, 0x5668 },
+    { 0xfa39, 0x5840 },
+    { 0xfa3a, 0x58a8 },
+    { 0xfa3b, 0x5c64 },
+    { 0xfa3c, 0x5c6e },
+    { 0xfa3d, 0x6094 },
+    { 0xfa3e, 0x6168 },
+    { 0xfa3f, 0x618e },
+    { 0xfa40, 0x61f2 },
+    { 0xfa41, 0x654f },
+    { 0xfa42, 0x65e2 },
+    { 0xfa43, 0x6691 },
+    { 0xfa44, 0x6885 },
+    { 0xfa45, 0x6d77 },
+    { 0xfa46, 0x6e1a },
+    { 0xfa47, 0x6f22 },
+    { 0xfa48, 0x716e },
+    { 0xfa49, 0x722b },
+    { 0xfa4a, 0x7422 },
+    { 0xfa4b, 0x7891 },
+    { 0xfa4c, 0x793e },
+    { 0xfa4d, 0x7949 },
+    { 0xfa4e, 0x7948 },
+    { 0xfa4f, 0x7950 },
+    { 0xfa50, 0x7956 },
+    { 0xfa51, 0x795d },
+    { 0xfa52, 0x798d },
+    { 0xfa53, 0x798e },
+    { 0xfa54, 0x7a40 },
+    { 0xfa55, 0x7a81 },
+    { 0xfa56, 0x7bc0 },
+    { 0xfa57, 0x7df4 },
+    { 0xfa58, 0x7e09 },
+    { 0xfa59, 0x7e41 },
+    { 0xfa5a, 0x7f72 },
+    { 0xfa5b, 0x8005 },
+    { 0xfa5c, 0x81ed },
+    { 0xfa5d, 0x8279 },
+    { 0xfa5e, 0x8279 },
+    { 0xfa5f, 0x8457 },
+    { 0xfa60, 0x8910 },
+    { 0xfa61, 0x8996 },
+    { 0xfa62, 0x8b01 },
+    { 0xfa63, 0x8b39 },
+    { 0xfa64, 0x8cd3 },
+    { 0xfa65, 0x8d08 },
+    { 0xfa66, 0x8fb6 },
+    { 0xfa67, 0x9038 },
+    { 0xfa68, 0x96e3 },
+    { 0xfa69, 0x97ff },
+    { 0xfa6a, 0x983b },
+    { 0xfa6b, 0x6075 },
+    { 0xfa6d, 0x8218 },
+    { 0xfa70, 0x4e26 },
+    { 0xfa71, 0x51b5 },
+    { 0xfa72, 0x5168 },
+    { 0xfa73, 0x4f80 },
+    { 0xfa74, 0x5145 },
+    { 0xfa75, 0x5180 },
+    { 0xfa76, 0x52c7 },
+    { 0xfa77, 0x52fa },
+    { 0xfa78, 0x559d },
+    { 0xfa79, 0x5555 },
+    { 0xfa7a, 0x5599 },
+    { 0xfa7b, 0x55e2 },
+    { 0xfa7c, 0x585a },
+    { 0xfa7d, 0x58b3 },
+    { 0xfa7e, 0x5944 },
+    { 0xfa7f, 0x5954 },
+    { 0xfa80, 0x5a62 },
+    { 0xfa81, 0x5b28 },
+    { 0xfa82, 0x5ed2 },
+    { 0xfa83, 0x5ed9 },
+    { 0xfa84, 0x5f69 },
+    { 0xfa85, 0x5fad },
+    { 0xfa86, 0x60d8 },
+    { 0xfa87, 0x614e },
+    { 0xfa88, 0x6108 },
+    { 0xfa89, 0x618e },
+    { 0xfa8a, 0x6160 },
+    { 0xfa8b, 0x61f2 },
+    { 0xfa8c, 0x6234 },
+    { 0xfa8d, 0x63c4 },
+    { 0xfa8e, 0x641c },
+    { 0xfa8f, 0x6452 },
+    { 0xfa90, 0x6556 },
+    { 0xfa91, 0x6674 },
+    { 0xfa92, 0x6717 },
+    { 0xfa93, 0x671b },
+    { 0xfa94, 0x6756 },
+    { 0xfa95, 0x6b79 },
+    { 0xfa96, 0x6bba },
+    { 0xfa97, 0x6d41 },
+    { 0xfa98, 0x6edb },
+    { 0xfa99, 0x6ecb },
+    { 0xfa9a, 0x6f22 },
+    { 0xfa9b, 0x701e },
+    { 0xfa9c, 0x716e },
+    { 0xfa9d, 0x77a7 },
+    { 0xfa9e, 0x7235 },
+    { 0xfa9f, 0x72af },
+    { 0xfaa0, 0x732a },
+    { 0xfaa1, 0x7471 },
+    { 0xfaa2, 0x7506 },
+    { 0xfaa3, 0x753b },
+    { 0xfaa4, 0x761d },
+    { 0xfaa5, 0x761f },
+    { 0xfaa6, 0x76ca },
+    { 0xfaa7, 0x76db },
+    { 0xfaa8, 0x76f4 },
+    { 0xfaa9, 0x774a },
+    { 0xfaaa, 0x7740 },
+    { 0xfaab, 0x78cc },
+    { 0xfaac, 0x7ab1 },
+    { 0xfaad, 0x7bc0 },
+    { 0xfaae, 0x7c7b },
+    { 0xfaaf, 0x7d5b },
+    { 0xfab0, 0x7df4 },
+    { 0xfab1, 0x7f3e },
+    { 0xfab2, 0x8005 },
+    { 0xfab3, 0x8352 },
+    { 0xfab4, 0x83ef },
+    { 0xfab5, 0x8779 },
+    { 0xfab6, 0x8941 },
+    { 0xfab7, 0x8986 },
+    { 0xfab8, 0x8996 },
+    { 0xfab9, 0x8abf },
+    { 0xfaba, 0x8af8 },
+    { 0xfabb, 0x8acb },
+    { 0xfabc, 0x8b01 },
+    { 0xfabd, 0x8afe },
+    { 0xfabe, 0x8aed },
+    { 0xfabf, 0x8b39 },
+    { 0xfac0, 0x8b8a },
+    { 0xfac1, 0x8d08 },
+    { 0xfac2, 0x8f38 },
+    { 0xfac3, 0x9072 },
+    { 0xfac4, 0x9199 },
+    { 0xfac5, 0x9276 },
+    { 0xfac6, 0x967c },
+    { 0xfac7, 0x96e3 },
+    { 0xfac8, 0x9756 },
+    { 0xfac9, 0x97db },
+    { 0xfaca, 0x97ff },
+    { 0xfacb, 0x980b },
+    { 0xfacc, 0x983b },
+    { 0xfacd, 0x9b12 },
+    { 0xface, 0x9f9c },
+    { 0xfad2, 0x3b9d },
+    { 0xfad3, 0x4018 },
+    { 0xfad4, 0x4039 },
+    { 0xfad8, 0x9f43 },
+    { 0xfad9, 0x9f8e },
+    { 0xfb20, 0x5e2 },
+    { 0xfb21, 0x5d0 },
+    { 0xfb22, 0x5d3 },
+    { 0xfb23, 0x5d4 },
+    { 0xfb24, 0x5db },
+    { 0xfb25, 0x5dc },
+    { 0xfb26, 0x5dd },
+    { 0xfb27, 0x5e8 },
+    { 0xfb28, 0x5ea },
+    { 0xfb29, 0x2b },
+    { 0xfb50, 0x671 },
+    { 0xfb51, 0x671 },
+    { 0xfb52, 0x67b },
+    { 0xfb53, 0x67b },
+    { 0xfb54, 0x67b },
+    { 0xfb55, 0x67b },
+    { 0xfb56, 0x67e },
+    { 0xfb57, 0x67e },
+    { 0xfb58, 0x67e },
+    { 0xfb59, 0x67e },
+    { 0xfb5a, 0x680 },
+    { 0xfb5b, 0x680 },
+    { 0xfb5c, 0x680 },
+    { 0xfb5d, 0x680 },
+    { 0xfb5e, 0x67a },
+    { 0xfb5f, 0x67a },
+    { 0xfb60, 0x67a },
+    { 0xfb61, 0x67a },
+    { 0xfb62, 0x67f },
+    { 0xfb63, 0x67f },
+    { 0xfb64, 0x67f },
+    { 0xfb65, 0x67f },
+    { 0xfb66, 0x679 },
+    { 0xfb67, 0x679 },
+    { 0xfb68, 0x679 },
+    { 0xfb69, 0x679 },
+    { 0xfb6a, 0x6a4 },
+    { 0xfb6b, 0x6a4 },
+    { 0xfb6c, 0x6a4 },
+    { 0xfb6d, 0x6a4 },
+    { 0xfb6e, 0x6a6 },
+    { 0xfb6f, 0x6a6 },
+    { 0xfb70, 0x6a6 },
+    { 0xfb71, 0x6a6 },
+    { 0xfb72, 0x684 },
+    { 0xfb73, 0x684 },
+    { 0xfb74, 0x684 },
+    { 0xfb75, 0x684 },
+    { 0xfb76, 0x683 },
+    { 0xfb77, 0x683 },
+    { 0xfb78, 0x683 },
+    { 0xfb79, 0x683 },
+    { 0xfb7a, 0x686 },
+    { 0xfb7b, 0x686 },
+    { 0xfb7c, 0x686 },
+    { 0xfb7d, 0x686 },
+    { 0xfb7e, 0x687 },
+    { 0xfb7f, 0x687 },
+    { 0xfb80, 0x687 },
+    { 0xfb81, 0x687 },
+    { 0xfb82, 0x68d },
+    { 0xfb83, 0x68d },
+    { 0xfb84, 0x68c },
+    { 0xfb85, 0x68c },
+    { 0xfb86, 0x68e },
+    { 0xfb87, 0x68e },
+    { 0xfb88, 0x688 },
+    { 0xfb89, 0x688 },
+    { 0xfb8a, 0x698 },
+    { 0xfb8b, 0x698 },
+    { 0xfb8c, 0x691 },
+    { 0xfb8d, 0x691 },
+    { 0xfb8e, 0x6a9 },
+    { 0xfb8f, 0x6a9 },
+    { 0xfb90, 0x6a9 },
+    { 0xfb91, 0x6a9 },
+    { 0xfb92, 0x6af },
+    { 0xfb93, 0x6af },
+    { 0xfb94, 0x6af },
+    { 0xfb95, 0x6af },
+    { 0xfb96, 0x6b3 },
+    { 0xfb97, 0x6b3 },
+    { 0xfb98, 0x6b3 },
+    { 0xfb99, 0x6b3 },
+    { 0xfb9a, 0x6b1 },
+    { 0xfb9b, 0x6b1 },
+    { 0xfb9c, 0x6b1 },
+    { 0xfb9d, 0x6b1 },
+    { 0xfb9e, 0x6ba },
+    { 0xfb9f, 0x6ba },
+    { 0xfba0, 0x6bb },
+    { 0xfba1, 0x6bb },
+    { 0xfba2, 0x6bb },
+    { 0xfba3, 0x6bb },
+    { 0xfba6, 0x6c1 },
+    { 0xfba7, 0x6c1 },
+    { 0xfba8, 0x6c1 },
+    { 0xfba9, 0x6c1 },
+    { 0xfbaa, 0x6be },
+    { 0xfbab, 0x6be },
+    { 0xfbac, 0x6be },
+    { 0xfbad, 0x6be },
+    { 0xfbae, 0x6d2 },
+    { 0xfbaf, 0x6d2 },
+    { 0xfbd3, 0x6ad },
+    { 0xfbd4, 0x6ad },
+    { 0xfbd5, 0x6ad },
+    { 0xfbd6, 0x6ad },
+    { 0xfbd7, 0x6c7 },
+    { 0xfbd8, 0x6c7 },
+    { 0xfbd9, 0x6c6 },
+    { 0xfbda, 0x6c6 },
+    { 0xfbdb, 0x6c8 },
+    { 0xfbdc, 0x6c8 },
+    { 0xfbde, 0x6cb },
+    { 0xfbdf, 0x6cb },
+    { 0xfbe0, 0x6c5 },
+    { 0xfbe1, 0x6c5 },
+    { 0xfbe2, 0x6c9 },
+    { 0xfbe3, 0x6c9 },
+    { 0xfbe4, 0x6d0 },
+    { 0xfbe5, 0x6d0 },
+    { 0xfbe6, 0x6d0 },
+    { 0xfbe7, 0x6d0 },
+    { 0xfbe8, 0x649 },
+    { 0xfbe9, 0x649 },
+    { 0xfbfc, 0x6cc },
+    { 0xfbfd, 0x6cc },
+    { 0xfbfe, 0x6cc },
+    { 0xfbff, 0x6cc },
+    { 0xfe10, 0x2c },
+    { 0xfe11, 0x3001 },
+    { 0xfe12, 0x3002 },
+    { 0xfe13, 0x3a },
+    { 0xfe14, 0x3b },
+    { 0xfe15, 0x21 },
+    { 0xfe16, 0x3f },
+    { 0xfe17, 0x3016 },
+    { 0xfe18, 0x3017 },
+    { 0xfe20, 0x0 },
+    { 0xfe21, 0x0 },
+    { 0xfe22, 0x0 },
+    { 0xfe23, 0x0 },
+    { 0xfe24, 0x0 },
+    { 0xfe25, 0x0 },
+    { 0xfe26, 0x0 },
+    { 0xfe27, 0x0 },
+    { 0xfe28, 0x0 },
+    { 0xfe29, 0x0 },
+    { 0xfe2a, 0x0 },
+    { 0xfe2b, 0x0 },
+    { 0xfe2c, 0x0 },
+    { 0xfe2d, 0x0 },
+    { 0xfe2e, 0x0 },
+    { 0xfe2f, 0x0 },
+    { 0xfe31, 0x2014 },
+    { 0xfe32, 0x2013 },
+    { 0xfe33, 0x5f },
+    { 0xfe34, 0x5f },
+    { 0xfe35, 0x28 },
+    { 0xfe36, 0x29 },
+    { 0xfe37, 0x7b },
+    { 0xfe38, 0x7d },
+    { 0xfe39, 0x3014 },
+    { 0xfe3a, 0x3015 },
+    { 0xfe3b, 0x3010 },
+    { 0xfe3c, 0x3011 },
+    { 0xfe3d, 0x300a },
+    { 0xfe3e, 0x300b },
+    { 0xfe3f, 0x3008 },
+    { 0xfe40, 0x3009 },
+    { 0xfe41, 0x300c },
+    { 0xfe42, 0x300d },
+    { 0xfe43, 0x300e },
+    { 0xfe44, 0x300f },
+    { 0xfe47, 0x5b },
+    { 0xfe48, 0x5d },
+    { 0xfe49, 0x20 },
+    { 0xfe4a, 0x20 },
+    { 0xfe4b, 0x20 },
+    { 0xfe4c, 0x20 },
+    { 0xfe4d, 0x5f },
+    { 0xfe4e, 0x5f },
+    { 0xfe4f, 0x5f },
+    { 0xfe50, 0x2c },
+    { 0xfe51, 0x3001 },
+    { 0xfe52, 0x2e },
+    { 0xfe54, 0x3b },
+    { 0xfe55, 0x3a },
+    { 0xfe56, 0x3f },
+    { 0xfe57, 0x21 },
+    { 0xfe58, 0x2014 },
+    { 0xfe59, 0x28 },
+    { 0xfe5a, 0x29 },
+    { 0xfe5b, 0x7b },
+    { 0xfe5c, 0x7d },
+    { 0xfe5d, 0x3014 },
+    { 0xfe5e, 0x3015 },
+    { 0xfe5f, 0x23 },
+    { 0xfe60, 0x26 },
+    { 0xfe61, 0x2a },
+    { 0xfe62, 0x2b },
+    { 0xfe63, 0x2d },
+    { 0xfe64, 0x3c },
+    { 0xfe65, 0x3e },
+    { 0xfe66, 0x3d },
+    { 0xfe68, 0x5c },
+    { 0xfe69, 0x24 },
+    { 0xfe6a, 0x25 },
+    { 0xfe6b, 0x40 },
+    { 0xfe80, 0x621 },
+    { 0xfe8d, 0x627 },
+    { 0xfe8e, 0x627 },
+    { 0xfe8f, 0x628 },
+    { 0xfe90, 0x628 },
+    { 0xfe91, 0x628 },
+    { 0xfe92, 0x628 },
+    { 0xfe93, 0x629 },
+    { 0xfe94, 0x629 },
+    { 0xfe95, 0x62a },
+    { 0xfe96, 0x62a },
+    { 0xfe97, 0x62a },
+    { 0xfe98, 0x62a },
+    { 0xfe99, 0x62b },
+    { 0xfe9a, 0x62b },
+    { 0xfe9b, 0x62b },
+    { 0xfe9c, 0x62b },
+    { 0xfe9d, 0x62c },
+    { 0xfe9e, 0x62c },
+    { 0xfe9f, 0x62c },
+    { 0xfea0, 0x62c },
+    { 0xfea1, 0x62d },
+    { 0xfea2, 0x62d },
+    { 0xfea3, 0x62d },
+    { 0xfea4, 0x62d },
+    { 0xfea5, 0x62e },
+    { 0xfea6, 0x62e },
+    { 0xfea7, 0x62e },
+    { 0xfea8, 0x62e },
+    { 0xfea9, 0x62f },
+    { 0xfeaa, 0x62f },
+    { 0xfeab, 0x630 },
+    { 0xfeac, 0x630 },
+    { 0xfead, 0x631 },
+    { 0xfeae, 0x631 },
+    { 0xfeaf, 0x632 },
+    { 0xfeb0, 0x632 },
+    { 0xfeb1, 0x633 },
+    { 0xfeb2, 0x633 },
+    { 0xfeb3, 0x633 },
+    { 0xfeb4, 0x633 },
+    { 0xfeb5, 0x634 },
+    { 0xfeb6, 0x634 },
+    { 0xfeb7, 0x634 },
+    { 0xfeb8, 0x634 },
+    { 0xfeb9, 0x635 },
+    { 0xfeba, 0x635 },
+    { 0xfebb, 0x635 },
+    { 0xfebc, 0x635 },
+    { 0xfebd, 0x636 },
+    { 0xfebe, 0x636 },
+    { 0xfebf, 0x636 },
+    { 0xfec0, 0x636 },
+    { 0xfec1, 0x637 },
+    { 0xfec2, 0x637 },
+    { 0xfec3, 0x637 },
+    { 0xfec4, 0x637 },
+    { 0xfec5, 0x638 },
+    { 0xfec6, 0x638 },
+    { 0xfec7, 0x638 },
+    { 0xfec8, 0x638 },
+    { 0xfec9, 0x639 },
+    { 0xfeca, 0x639 },
+    { 0xfecb, 0x639 },
+    { 0xfecc, 0x639 },
+    { 0xfecd, 0x63a },
+    { 0xfece, 0x63a },
+    { 0xfecf, 0x63a },
+    { 0xfed0, 0x63a },
+    { 0xfed1, 0x641 },
+    { 0xfed2, 0x641 },
+    { 0xfed3, 0x641 },
+    { 0xfed4, 0x641 },
+    { 0xfed5, 0x642 },
+    { 0xfed6, 0x642 },
+    { 0xfed7, 0x642 },
+    { 0xfed8, 0x642 },
+    { 0xfed9, 0x643 },
+    { 0xfeda, 0x643 },
+    { 0xfedb, 0x643 },
+    { 0xfedc, 0x643 },
+    { 0xfedd, 0x644 },
+    { 0xfede, 0x644 },
+    { 0xfedf, 0x644 },
+    { 0xfee0, 0x644 },
+    { 0xfee1, 0x645 },
+    { 0xfee2, 0x645 },
+    { 0xfee3, 0x645 },
+    { 0xfee4, 0x645 },
+    { 0xfee5, 0x646 },
+    { 0xfee6, 0x646 },
+    { 0xfee7, 0x646 },
+    { 0xfee8, 0x646 },
+    { 0xfee9, 0x647 },
+    { 0xfeea, 0x647 },
+    { 0xfeeb, 0x647 },
+    { 0xfeec, 0x647 },
+    { 0xfeed, 0x648 },
+    { 0xfeee, 0x648 },
+    { 0xfeef, 0x649 },
+    { 0xfef0, 0x649 },
+    { 0xfef1, 0x64a },
+    { 0xfef2, 0x64a },
+    { 0xfef3, 0x64a },
+    { 0xfef4, 0x64a },
+    { 0xff5f, 0x2985 },
+    { 0xff60, 0x2986 },
+    { 0xff61, 0x3002 },
+    { 0xff62, 0x300c },
+    { 0xff63, 0x300d },
+    { 0xff64, 0x3001 },
+    { 0xff65, 0x30fb },
+    { 0xff66, 0x30f2 },
+    { 0xff67, 0x30a1 },
+    { 0xff68, 0x30a3 },
+    { 0xff69, 0x30a5 },
+    { 0xff6a, 0x30a7 },
+    { 0xff6b, 0x30a9 },
+    { 0xff6c, 0x30e3 },
+    { 0xff6d, 0x30e5 },
+    { 0xff6e, 0x30e7 },
+    { 0xff6f, 0x30c3 },
+    { 0xff70, 0x30fc },
+    { 0xff71, 0x30a2 },
+    { 0xff72, 0x30a4 },
+    { 0xff73, 0x30a6 },
+    { 0xff74, 0x30a8 },
+    { 0xff75, 0x30aa },
+    { 0xff76, 0x30ab },
+    { 0xff77, 0x30ad },
+    { 0xff78, 0x30af },
+    { 0xff79, 0x30b1 },
+    { 0xff7a, 0x30b3 },
+    { 0xff7b, 0x30b5 },
+    { 0xff7c, 0x30b7 },
+    { 0xff7d, 0x30b9 },
+    { 0xff7e, 0x30bb },
+    { 0xff7f, 0x30bd },
+    { 0xff80, 0x30bf },
+    { 0xff81, 0x30c1 },
+    { 0xff82, 0x30c4 },
+    { 0xff83, 0x30c6 },
+    { 0xff84, 0x30c8 },
+    { 0xff85, 0x30ca },
+    { 0xff86, 0x30cb },
+    { 0xff87, 0x30cc },
+    { 0xff88, 0x30cd },
+    { 0xff89, 0x30ce },
+    { 0xff8a, 0x30cf },
+    { 0xff8b, 0x30d2 },
+    { 0xff8c, 0x30d5 },
+    { 0xff8d, 0x30d8 },
+    { 0xff8e, 0x30db },
+    { 0xff8f, 0x30de },
+    { 0xff90, 0x30df },
+    { 0xff91, 0x30e0 },
+    { 0xff92, 0x30e1 },
+    { 0xff93, 0x30e2 },
+    { 0xff94, 0x30e4 },
+    { 0xff95, 0x30e6 },
+    { 0xff96, 0x30e8 },
+    { 0xff97, 0x30e9 },
+    { 0xff98, 0x30ea },
+    { 0xff99, 0x30eb },
+    { 0xff9a, 0x30ec },
+    { 0xff9b, 0x30ed },
+    { 0xff9c, 0x30ef },
+    { 0xff9d, 0x30f3 },
+    { 0xff9e, 0x3099 },
+    { 0xff9f, 0x309a },
+    { 0xffa0, 0x1160 },
+    { 0xffa1, 0x1100 },
+    { 0xffa2, 0x1101 },
+    { 0xffa3, 0x11aa },
+    { 0xffa4, 0x1102 },
+    { 0xffa5, 0x11ac },
+    { 0xffa6, 0x11ad },
+    { 0xffa7, 0x1103 },
+    { 0xffa8, 0x1104 },
+    { 0xffa9, 0x1105 },
+    { 0xffaa, 0x11b0 },
+    { 0xffab, 0x11b1 },
+    { 0xffac, 0x11b2 },
+    { 0xffad, 0x11b3 },
+    { 0xffae, 0x11b4 },
+    { 0xffaf, 0x11b5 },
+    { 0xffb0, 0x111a },
+    { 0xffb1, 0x1106 },
+    { 0xffb2, 0x1107 },
+    { 0xffb3, 0x1108 },
+    { 0xffb4, 0x1121 },
+    { 0xffb5, 0x1109 },
+    { 0xffb6, 0x110a },
+    { 0xffb7, 0x110b },
+    { 0xffb8, 0x110c },
+    { 0xffb9, 0x110d },
+    { 0xffba, 0x110e },
+    { 0xffbb, 0x110f },
+    { 0xffbc, 0x1110 },
+    { 0xffbd, 0x1111 },
+    { 0xffbe, 0x1112 },
+    { 0xffc2, 0x1161 },
+    { 0xffc3, 0x1162 },
+    { 0xffc4, 0x1163 },
+    { 0xffc5, 0x1164 },
+    { 0xffc6, 0x1165 },
+    { 0xffc7, 0x1166 },
+    { 0xffca, 0x1167 },
+    { 0xffcb, 0x1168 },
+    { 0xffcc, 0x1169 },
+    { 0xffcd, 0x116a },
+    { 0xffce, 0x116b },
+    { 0xffcf, 0x116c },
+    { 0xffd2, 0x116d },
+    { 0xffd3, 0x116e },
+    { 0xffd4, 0x116f },
+    { 0xffd5, 0x1170 },
+    { 0xffd6, 0x1171 },
+    { 0xffd7, 0x1172 },
+    { 0xffda, 0x1173 },
+    { 0xffdb, 0x1174 },
+    { 0xffdc, 0x1175 },
+    { 0xffe0, 0xa2 },
+    { 0xffe1, 0xa3 },
+    { 0xffe2, 0xac },
+    { 0xffe3, 0x20 },
+    { 0xffe4, 0xa6 },
+    { 0xffe5, 0xa5 },
+    { 0xffe6, 0x20a9 },
+    { 0xffe8, 0x2502 },
+    { 0xffe9, 0x2190 },
+    { 0xffea, 0x2191 },
+    { 0xffeb, 0x2192 },
+    { 0xffec, 0x2193 },
+    { 0xffed, 0x25a0 },
+    { 0xffee, 0x25cb },
+    { 0x10400, 0x10428 },
+    { 0x10401, 0x10429 },
+    { 0x10402, 0x1042a },
+    { 0x10403, 0x1042b },
+    { 0x10404, 0x1042c },
+    { 0x10405, 0x1042d },
+    { 0x10406, 0x1042e },
+    { 0x10407, 0x1042f },
+    { 0x10408, 0x10430 },
+    { 0x10409, 0x10431 },
+    { 0x1040a, 0x10432 },
+    { 0x1040b, 0x10433 },
+    { 0x1040c, 0x10434 },
+    { 0x1040d, 0x10435 },
+    { 0x1040e, 0x10436 },
+    { 0x1040f, 0x10437 },
+    { 0x10410, 0x10438 },
+    { 0x10411, 0x10439 },
+    { 0x10412, 0x1043a },
+    { 0x10413, 0x1043b },
+    { 0x10414, 0x1043c },
+    { 0x10415, 0x1043d },
+    { 0x10416, 0x1043e },
+    { 0x10417, 0x1043f },
+    { 0x10418, 0x10440 },
+    { 0x10419, 0x10441 },
+    { 0x1041a, 0x10442 },
+    { 0x1041b, 0x10443 },
+    { 0x1041c, 0x10444 },
+    { 0x1041d, 0x10445 },
+    { 0x1041e, 0x10446 },
+    { 0x1041f, 0x10447 },
+    { 0x10420, 0x10448 },
+    { 0x10421, 0x10449 },
+    { 0x10422, 0x1044a },
+    { 0x10423, 0x1044b },
+    { 0x10424, 0x1044c },
+    { 0x10425, 0x1044d },
+    { 0x10426, 0x1044e },
+    { 0x10427, 0x1044f },
+    { 0x104b0, 0x104d8 },
+    { 0x104b1, 0x104d9 },
+    { 0x104b2, 0x104da },
+    { 0x104b3, 0x104db },
+    { 0x104b4, 0x104dc },
+    { 0x104b5, 0x104dd },
+    { 0x104b6, 0x104de },
+    { 0x104b7, 0x104df },
+    { 0x104b8, 0x104e0 },
+    { 0x104b9, 0x104e1 },
+    { 0x104ba, 0x104e2 },
+    { 0x104bb, 0x104e3 },
+    { 0x104bc, 0x104e4 },
+    { 0x104bd, 0x104e5 },
+    { 0x104be, 0x104e6 },
+    { 0x104bf, 0x104e7 },
+    { 0x104c0, 0x104e8 },
+    { 0x104c1, 0x104e9 },
+    { 0x104c2, 0x104ea },
+    { 0x104c3, 0x104eb },
+    { 0x104c4, 0x104ec },
+    { 0x104c5, 0x104ed },
+    { 0x104c6, 0x104ee },
+    { 0x104c7, 0x104ef },
+    { 0x104c8, 0x104f0 },
+    { 0x104c9, 0x104f1 },
+    { 0x104ca, 0x104f2 },
+    { 0x104cb, 0x104f3 },
+    { 0x104cc, 0x104f4 },
+    { 0x104cd, 0x104f5 },
+    { 0x104ce, 0x104f6 },
+    { 0x104cf, 0x104f7 },
+    { 0x104d0, 0x104f8 },
+    { 0x104d1, 0x104f9 },
+    { 0x104d2, 0x104fa },
+    { 0x104d3, 0x104fb },
+    { 0x10570, 0x10597 },
+    { 0x10571, 0x10598 },
+    { 0x10572, 0x10599 },
+    { 0x10573, 0x1059a },
+    { 0x10574, 0x1059b },
+    { 0x10575, 0x1059c },
+    { 0x10576, 0x1059d },
+    { 0x10577, 0x1059e },
+    { 0x10578, 0x1059f },
+    { 0x10579, 0x105a0 },
+    { 0x1057a, 0x105a1 },
+    { 0x1057c, 0x105a3 },
+    { 0x1057d, 0x105a4 },
+    { 0x1057e, 0x105a5 },
+    { 0x1057f, 0x105a6 },
+    { 0x10580, 0x105a7 },
+    { 0x10581, 0x105a8 },
+    { 0x10582, 0x105a9 },
+    { 0x10583, 0x105aa },
+    { 0x10584, 0x105ab },
+    { 0x10585, 0x105ac },
+    { 0x10586, 0x105ad },
+    { 0x10587, 0x105ae },
+    { 0x10588, 0x105af },
+    { 0x10589, 0x105b0 },
+    { 0x1058a, 0x105b1 },
+    { 0x1058c, 0x105b3 },
+    { 0x1058d, 0x105b4 },
+    { 0x1058e, 0x105b5 },
+    { 0x1058f, 0x105b6 },
+    { 0x10590, 0x105b7 },
+    { 0x10591, 0x105b8 },
+    { 0x10592, 0x105b9 },
+    { 0x10594, 0x105bb },
+    { 0x10595, 0x105bc },
+    { 0x10781, 0x2d0 },
+    { 0x10782, 0x2d1 },
+    { 0x10783, 0xe6 },
+    { 0x10784, 0x299 },
+    { 0x10785, 0x253 },
+    { 0x10787, 0x2a3 },
+    { 0x10788, 0xab66 },
+    { 0x10789, 0x2a5 },
+    { 0x1078a, 0x2a4 },
+    { 0x1078b, 0x256 },
+    { 0x1078c, 0x257 },
+    { 0x1078d, 0x1d91 },
+    { 0x1078e, 0x258 },
+    { 0x1078f, 0x25e },
+    { 0x10790, 0x2a9 },
+    { 0x10791, 0x264 },
+    { 0x10792, 0x262 },
+    { 0x10793, 0x260 },
+    { 0x10794, 0x29b },
+    { 0x10795, 0x127 },
+    { 0x10796, 0x29c },
+    { 0x10797, 0x267 },
+    { 0x10798, 0x284 },
+    { 0x10799, 0x2aa },
+    { 0x1079a, 0x2ab },
+    { 0x1079b, 0x26c },
+    { 0x1079c, 0x1df04 },
+    { 0x1079d, 0xa78e },
+    { 0x1079e, 0x26e },
+    { 0x1079f, 0x1df05 },
+    { 0x107a0, 0x28e },
+    { 0x107a1, 0x1df06 },
+    { 0x107a2, 0xf8 },
+    { 0x107a3, 0x276 },
+    { 0x107a4, 0x277 },
+    { 0x107a5, 0x71 },
+    { 0x107a6, 0x27a },
+    { 0x107a7, 0x1df08 },
+    { 0x107a8, 0x27d },
+    { 0x107a9, 0x27e },
+    { 0x107aa, 0x280 },
+    { 0x107ab, 0x2a8 },
+    { 0x107ac, 0x2a6 },
+    { 0x107ad, 0xab67 },
+    { 0x107ae, 0x2a7 },
+    { 0x107af, 0x288 },
+    { 0x107b0, 0x2c71 },
+    { 0x107b2, 0x28f },
+    { 0x107b3, 0x2a1 },
+    { 0x107b4, 0x2a2 },
+    { 0x107b5, 0x298 },
+    { 0x107b6, 0x1c0 },
+    { 0x107b7, 0x1c1 },
+    { 0x107b8, 0x1c2 },
+    { 0x107b9, 0x1df0a },
+    { 0x107ba, 0x1df1e },
+    { 0x10c80, 0x10cc0 },
+    { 0x10c81, 0x10cc1 },
+    { 0x10c82, 0x10cc2 },
+    { 0x10c83, 0x10cc3 },
+    { 0x10c84, 0x10cc4 },
+    { 0x10c85, 0x10cc5 },
+    { 0x10c86, 0x10cc6 },
+    { 0x10c87, 0x10cc7 },
+    { 0x10c88, 0x10cc8 },
+    { 0x10c89, 0x10cc9 },
+    { 0x10c8a, 0x10cca },
+    { 0x10c8b, 0x10ccb },
+    { 0x10c8c, 0x10ccc },
+    { 0x10c8d, 0x10ccd },
+    { 0x10c8e, 0x10cce },
+    { 0x10c8f, 0x10ccf },
+    { 0x10c90, 0x10cd0 },
+    { 0x10c91, 0x10cd1 },
+    { 0x10c92, 0x10cd2 },
+    { 0x10c93, 0x10cd3 },
+    { 0x10c94, 0x10cd4 },
+    { 0x10c95, 0x10cd5 },
+    { 0x10c96, 0x10cd6 },
+    { 0x10c97, 0x10cd7 },
+    { 0x10c98, 0x10cd8 },
+    { 0x10c99, 0x10cd9 },
+    { 0x10c9a, 0x10cda },
+    { 0x10c9b, 0x10cdb },
+    { 0x10c9c, 0x10cdc },
+    { 0x10c9d, 0x10cdd },
+    { 0x10c9e, 0x10cde },
+    { 0x10c9f, 0x10cdf },
+    { 0x10ca0, 0x10ce0 },
+    { 0x10ca1, 0x10ce1 },
+    { 0x10ca2, 0x10ce2 },
+    { 0x10ca3, 0x10ce3 },
+    { 0x10ca4, 0x10ce4 },
+    { 0x10ca5, 0x10ce5 },
+    { 0x10ca6, 0x10ce6 },
+    { 0x10ca7, 0x10ce7 },
+    { 0x10ca8, 0x10ce8 },
+    { 0x10ca9, 0x10ce9 },
+    { 0x10caa, 0x10cea },
+    { 0x10cab, 0x10ceb },
+    { 0x10cac, 0x10cec },
+    { 0x10cad, 0x10ced },
+    { 0x10cae, 0x10cee },
+    { 0x10caf, 0x10cef },
+    { 0x10cb0, 0x10cf0 },
+    { 0x10cb1, 0x10cf1 },
+    { 0x10cb2, 0x10cf2 },
+    { 0x118a0, 0x118c0 },
+    { 0x118a1, 0x118c1 },
+    { 0x118a2, 0x118c2 },
+    { 0x118a3, 0x118c3 },
+    { 0x118a4, 0x118c4 },
+    { 0x118a5, 0x118c5 },
+    { 0x118a6, 0x118c6 },
+    { 0x118a7, 0x118c7 },
+    { 0x118a8, 0x118c8 },
+    { 0x118a9, 0x118c9 },
+    { 0x118aa, 0x118ca },
+    { 0x118ab, 0x118cb },
+    { 0x118ac, 0x118cc },
+    { 0x118ad, 0x118cd },
+    { 0x118ae, 0x118ce },
+    { 0x118af, 0x118cf },
+    { 0x118b0, 0x118d0 },
+    { 0x118b1, 0x118d1 },
+    { 0x118b2, 0x118d2 },
+    { 0x118b3, 0x118d3 },
+    { 0x118b4, 0x118d4 },
+    { 0x118b5, 0x118d5 },
+    { 0x118b6, 0x118d6 },
+    { 0x118b7, 0x118d7 },
+    { 0x118b8, 0x118d8 },
+    { 0x118b9, 0x118d9 },
+    { 0x118ba, 0x118da },
+    { 0x118bb, 0x118db },
+    { 0x118bc, 0x118dc },
+    { 0x118bd, 0x118dd },
+    { 0x118be, 0x118de },
+    { 0x118bf, 0x118df },
+    { 0x16e40, 0x16e60 },
+    { 0x16e41, 0x16e61 },
+    { 0x16e42, 0x16e62 },
+    { 0x16e43, 0x16e63 },
+    { 0x16e44, 0x16e64 },
+    { 0x16e45, 0x16e65 },
+    { 0x16e46, 0x16e66 },
+    { 0x16e47, 0x16e67 },
+    { 0x16e48, 0x16e68 },
+    { 0x16e49, 0x16e69 },
+    { 0x16e4a, 0x16e6a },
+    { 0x16e4b, 0x16e6b },
+    { 0x16e4c, 0x16e6c },
+    { 0x16e4d, 0x16e6d },
+    { 0x16e4e, 0x16e6e },
+    { 0x16e4f, 0x16e6f },
+    { 0x16e50, 0x16e70 },
+    { 0x16e51, 0x16e71 },
+    { 0x16e52, 0x16e72 },
+    { 0x16e53, 0x16e73 },
+    { 0x16e54, 0x16e74 },
+    { 0x16e55, 0x16e75 },
+    { 0x16e56, 0x16e76 },
+    { 0x16e57, 0x16e77 },
+    { 0x16e58, 0x16e78 },
+    { 0x16e59, 0x16e79 },
+    { 0x16e5a, 0x16e7a },
+    { 0x16e5b, 0x16e7b },
+    { 0x16e5c, 0x16e7c },
+    { 0x16e5d, 0x16e7d },
+    { 0x16e5e, 0x16e7e },
+    { 0x16e5f, 0x16e7f },
+    { 0x1d400, 0x61 },
+    { 0x1d401, 0x62 },
+    { 0x1d402, 0x63 },
+    { 0x1d403, 0x64 },
+    { 0x1d404, 0x65 },
+    { 0x1d405, 0x66 },
+    { 0x1d406, 0x67 },
+    { 0x1d407, 0x68 },
+    { 0x1d408, 0x69 },
+    { 0x1d409, 0x6a },
+    { 0x1d40a, 0x6b },
+    { 0x1d40b, 0x6c },
+    { 0x1d40c, 0x6d },
+    { 0x1d40d, 0x6e },
+    { 0x1d40e, 0x6f },
+    { 0x1d40f, 0x70 },
+    { 0x1d410, 0x71 },
+    { 0x1d411, 0x72 },
+    { 0x1d412, 0x73 },
+    { 0x1d413, 0x74 },
+    { 0x1d414, 0x75 },
+    { 0x1d415, 0x76 },
+    { 0x1d416, 0x77 },
+    { 0x1d417, 0x78 },
+    { 0x1d418, 0x79 },
+    { 0x1d419, 0x7a },
+    { 0x1d41a, 0x61 },
+    { 0x1d41b, 0x62 },
+    { 0x1d41c, 0x63 },
+    { 0x1d41d, 0x64 },
+    { 0x1d41e, 0x65 },
+    { 0x1d41f, 0x66 },
+    { 0x1d420, 0x67 },
+    { 0x1d421, 0x68 },
+    { 0x1d422, 0x69 },
+    { 0x1d423, 0x6a },
+    { 0x1d424, 0x6b },
+    { 0x1d425, 0x6c },
+    { 0x1d426, 0x6d },
+    { 0x1d427, 0x6e },
+    { 0x1d428, 0x6f },
+    { 0x1d429, 0x70 },
+    { 0x1d42a, 0x71 },
+    { 0x1d42b, 0x72 },
+    { 0x1d42c, 0x73 },
+    { 0x1d42d, 0x74 },
+    { 0x1d42e, 0x75 },
+    { 0x1d42f, 0x76 },
+    { 0x1d430, 0x77 },
+    { 0x1d431, 0x78 },
+    { 0x1d432, 0x79 },
+    { 0x1d433, 0x7a },
+    { 0x1d434, 0x61 },
+    { 0x1d435, 0x62 },
+    { 0x1d436, 0x63 },
+    { 0x1d437, 0x64 },
+    { 0x1d438, 0x65 },
+    { 0x1d439, 0x66 },
+    { 0x1d43a, 0x67 },
+    { 0x1d43b, 0x68 },
+    { 0x1d43c, 0x69 },
+    { 0x1d43d, 0x6a },
+    { 0x1d43e, 0x6b },
+    { 0x1d43f, 0x6c },
+    { 0x1d440, 0x6d },
+    { 0x1d441, 0x6e },
+    { 0x1d442, 0x6f },
+    { 0x1d443, 0x70 },
+    { 0x1d444, 0x71 },
+    { 0x1d445, 0x72 },
+    { 0x1d446, 0x73 },
+    { 0x1d447, 0x74 },
+    { 0x1d448, 0x75 },
+    { 0x1d449, 0x76 },
+    { 0x1d44a, 0x77 },
+    { 0x1d44b, 0x78 },
+    { 0x1d44c, 0x79 },
+    { 0x1d44d, 0x7a },
+    { 0x1d44e, 0x61 },
+    { 0x1d44f, 0x62 },
+    { 0x1d450, 0x63 },
+    { 0x1d451, 0x64 },
+    { 0x1d452, 0x65 },
+    { 0x1d453, 0x66 },
+    { 0x1d454, 0x67 },
+    { 0x1d456, 0x69 },
+    { 0x1d457, 0x6a },
+    { 0x1d458, 0x6b },
+    { 0x1d459, 0x6c },
+    { 0x1d45a, 0x6d },
+    { 0x1d45b, 0x6e },
+    { 0x1d45c, 0x6f },
+    { 0x1d45d, 0x70 },
+    { 0x1d45e, 0x71 },
+    { 0x1d45f, 0x72 },
+    { 0x1d460, 0x73 },
+    { 0x1d461, 0x74 },
+    { 0x1d462, 0x75 },
+    { 0x1d463, 0x76 },
+    { 0x1d464, 0x77 },
+    { 0x1d465, 0x78 },
+    { 0x1d466, 0x79 },
+    { 0x1d467, 0x7a },
+    { 0x1d468, 0x61 },
+    { 0x1d469, 0x62 },
+    { 0x1d46a, 0x63 },
+    { 0x1d46b, 0x64 },
+    { 0x1d46c, 0x65 },
+    { 0x1d46d, 0x66 },
+    { 0x1d46e, 0x67 },
+    { 0x1d46f, 0x68 },
+    { 0x1d470, 0x69 },
+    { 0x1d471, 0x6a },
+    { 0x1d472, 0x6b },
+    { 0x1d473, 0x6c },
+    { 0x1d474, 0x6d },
+    { 0x1d475, 0x6e },
+    { 0x1d476, 0x6f },
+    { 0x1d477, 0x70 },
+    { 0x1d478, 0x71 },
+    { 0x1d479, 0x72 },
+    { 0x1d47a, 0x73 },
+    { 0x1d47b, 0x74 },
+    { 0x1d47c, 0x75 },
+    { 0x1d47d, 0x76 },
+    { 0x1d47e, 0x77 },
+    { 0x1d47f, 0x78 },
+    { 0x1d480, 0x79 },
+    { 0x1d481, 0x7a },
+    { 0x1d482, 0x61 },
+    { 0x1d483, 0x62 },
+    { 0x1d484, 0x63 },
+    { 0x1d485, 0x64 },
+    { 0x1d486, 0x65 },
+    { 0x1d487, 0x66 },
+    { 0x1d488, 0x67 },
+    { 0x1d489, 0x68 },
+    { 0x1d48a, 0x69 },
+    { 0x1d48b, 0x6a },
+    { 0x1d48c, 0x6b },
+    { 0x1d48d, 0x6c },
+    { 0x1d48e, 0x6d },
+    { 0x1d48f, 0x6e },
+    { 0x1d490, 0x6f },
+    { 0x1d491, 0x70 },
+    { 0x1d492, 0x71 },
+    { 0x1d493, 0x72 },
+    { 0x1d494, 0x73 },
+    { 0x1d495, 0x74 },
+    { 0x1d496, 0x75 },
+    { 0x1d497, 0x76 },
+    { 0x1d498, 0x77 },
+    { 0x1d499, 0x78 },
+    { 0x1d49a, 0x79 },
+    { 0x1d49b, 0x7a },
+    { 0x1d49c, 0x61 },
+    { 0x1d49e, 0x63 },
+    { 0x1d49f, 0x64 },
+    { 0x1d4a2, 0x67 },
+    { 0x1d4a5, 0x6a },
+    { 0x1d4a6, 0x6b },
+    { 0x1d4a9, 0x6e },
+    { 0x1d4aa, 0x6f },
+    { 0x1d4ab, 0x70 },
+    { 0x1d4ac, 0x71 },
+    { 0x1d4ae, 0x73 },
+    { 0x1d4af, 0x74 },
+    { 0x1d4b0, 0x75 },
+    { 0x1d4b1, 0x76 },
+    { 0x1d4b2, 0x77 },
+    { 0x1d4b3, 0x78 },
+    { 0x1d4b4, 0x79 },
+    { 0x1d4b5, 0x7a },
+    { 0x1d4b6, 0x61 },
+    { 0x1d4b7, 0x62 },
+    { 0x1d4b8, 0x63 },
+    { 0x1d4b9, 0x64 },
+    { 0x1d4bb, 0x66 },
+    { 0x1d4bd, 0x68 },
+    { 0x1d4be, 0x69 },
+    { 0x1d4bf, 0x6a },
+    { 0x1d4c0, 0x6b },
+    { 0x1d4c1, 0x6c },
+    { 0x1d4c2, 0x6d },
+    { 0x1d4c3, 0x6e },
+    { 0x1d4c5, 0x70 },
+    { 0x1d4c6, 0x71 },
+    { 0x1d4c7, 0x72 },
+    { 0x1d4c8, 0x73 },
+    { 0x1d4c9, 0x74 },
+    { 0x1d4ca, 0x75 },
+    { 0x1d4cb, 0x76 },
+    { 0x1d4cc, 0x77 },
+    { 0x1d4cd, 0x78 },
+    { 0x1d4ce, 0x79 },
+    { 0x1d4cf, 0x7a },
+    { 0x1d4d0, 0x61 },
+    { 0x1d4d1, 0x62 },
+    { 0x1d4d2, 0x63 },
+    { 0x1d4d3, 0x64 },
+    { 0x1d4d4, 0x65 },
+    { 0x1d4d5, 0x66 },
+    { 0x1d4d6, 0x67 },
+    { 0x1d4d7, 0x68 },
+    { 0x1d4d8, 0x69 },
+    { 0x1d4d9, 0x6a },
+    { 0x1d4da, 0x6b },
+    { 0x1d4db, 0x6c },
+    { 0x1d4dc, 0x6d },
+    { 0x1d4dd, 0x6e },
+    { 0x1d4de, 0x6f },
+    { 0x1d4df, 0x70 },
+    { 0x1d4e0, 0x71 },
+    { 0x1d4e1, 0x72 },
+    { 0x1d4e2, 0x73 },
+    { 0x1d4e3, 0x74 },
+    { 0x1d4e4, 0x75 },
+    { 0x1d4e5, 0x76 },
+    { 0x1d4e6, 0x77 },
+    { 0x1d4e7, 0x78 },
+    { 0x1d4e8, 0x79 },
+    { 0x1d4e9, 0x7a },
+    { 0x1d4ea, 0x61 },
+    { 0x1d4eb, 0x62 },
+    { 0x1d4ec, 0x63 },
+    { 0x1d4ed, 0x64 },
+    { 0x1d4ee, 0x65 },
+    { 0x1d4ef, 0x66 },
+    { 0x1d4f0, 0x67 },
+    { 0x1d4f1, 0x68 },
+    { 0x1d4f2, 0x69 },
+    { 0x1d4f3, 0x6a },
+    { 0x1d4f4, 0x6b },
+    { 0x1d4f5, 0x6c },
+    { 0x1d4f6, 0x6d },
+    { 0x1d4f7, 0x6e },
+    { 0x1d4f8, 0x6f },
+    { 0x1d4f9, 0x70 },
+    { 0x1d4fa, 0x71 },
+    { 0x1d4fb, 0x72 },
+    { 0x1d4fc, 0x73 },
+    { 0x1d4fd, 0x74 },
+    { 0x1d4fe, 0x75 },
+    { 0x1d4ff, 0x76 },
+    { 0x1d500, 0x77 },
+    { 0x1d501, 0x78 },
+    { 0x1d502, 0x79 },
+    { 0x1d503, 0x7a },
+    { 0x1d504, 0x61 },
+    { 0x1d505, 0x62 },
+    { 0x1d507, 0x64 },
+    { 0x1d508, 0x65 },
+    { 0x1d509, 0x66 },
+    { 0x1d50a, 0x67 },
+    { 0x1d50d, 0x6a },
+    { 0x1d50e, 0x6b },
+    { 0x1d50f, 0x6c },
+    { 0x1d510, 0x6d },
+    { 0x1d511, 0x6e },
+    { 0x1d512, 0x6f },
+    { 0x1d513, 0x70 },
+    { 0x1d514, 0x71 },
+    { 0x1d516, 0x73 },
+    { 0x1d517, 0x74 },
+    { 0x1d518, 0x75 },
+    { 0x1d519, 0x76 },
+    { 0x1d51a, 0x77 },
+    { 0x1d51b, 0x78 },
+    { 0x1d51c, 0x79 },
+    { 0x1d51e, 0x61 },
+    { 0x1d51f, 0x62 },
+    { 0x1d520, 0x63 },
+    { 0x1d521, 0x64 },
+    { 0x1d522, 0x65 },
+    { 0x1d523, 0x66 },
+    { 0x1d524, 0x67 },
+    { 0x1d525, 0x68 },
+    { 0x1d526, 0x69 },
+    { 0x1d527, 0x6a },
+    { 0x1d528, 0x6b },
+    { 0x1d529, 0x6c },
+    { 0x1d52a, 0x6d },
+    { 0x1d52b, 0x6e },
+    { 0x1d52c, 0x6f },
+    { 0x1d52d, 0x70 },
+    { 0x1d52e, 0x71 },
+    { 0x1d52f, 0x72 },
+    { 0x1d530, 0x73 },
+    { 0x1d531, 0x74 },
+    { 0x1d532, 0x75 },
+    { 0x1d533, 0x76 },
+    { 0x1d534, 0x77 },
+    { 0x1d535, 0x78 },
+    { 0x1d536, 0x79 },
+    { 0x1d537, 0x7a },
+    { 0x1d538, 0x61 },
+    { 0x1d539, 0x62 },
+    { 0x1d53b, 0x64 },
+    { 0x1d53c, 0x65 },
+    { 0x1d53d, 0x66 },
+    { 0x1d53e, 0x67 },
+    { 0x1d540, 0x69 },
+    { 0x1d541, 0x6a },
+    { 0x1d542, 0x6b },
+    { 0x1d543, 0x6c },
+    { 0x1d544, 0x6d },
+    { 0x1d546, 0x6f },
+    { 0x1d54a, 0x73 },
+    { 0x1d54b, 0x74 },
+    { 0x1d54c, 0x75 },
+    { 0x1d54d, 0x76 },
+    { 0x1d54e, 0x77 },
+    { 0x1d54f, 0x78 },
+    { 0x1d550, 0x79 },
+    { 0x1d552, 0x61 },
+    { 0x1d553, 0x62 },
+    { 0x1d554, 0x63 },
+    { 0x1d555, 0x64 },
+    { 0x1d556, 0x65 },
+    { 0x1d557, 0x66 },
+    { 0x1d558, 0x67 },
+    { 0x1d559, 0x68 },
+    { 0x1d55a, 0x69 },
+    { 0x1d55b, 0x6a },
+    { 0x1d55c, 0x6b },
+    { 0x1d55d, 0x6c },
+    { 0x1d55e, 0x6d },
+    { 0x1d55f, 0x6e },
+    { 0x1d560, 0x6f },
+    { 0x1d561, 0x70 },
+    { 0x1d562, 0x71 },
+    { 0x1d563, 0x72 },
+    { 0x1d564, 0x73 },
+    { 0x1d565, 0x74 },
+    { 0x1d566, 0x75 },
+    { 0x1d567, 0x76 },
+    { 0x1d568, 0x77 },
+    { 0x1d569, 0x78 },
+    { 0x1d56a, 0x79 },
+    { 0x1d56b, 0x7a },
+    { 0x1d56c, 0x61 },
+    { 0x1d56d, 0x62 },
+    { 0x1d56e, 0x63 },
+    { 0x1d56f, 0x64 },
+    { 0x1d570, 0x65 },
+    { 0x1d571, 0x66 },
+    { 0x1d572, 0x67 },
+    { 0x1d573, 0x68 },
+    { 0x1d574, 0x69 },
+    { 0x1d575, 0x6a },
+    { 0x1d576, 0x6b },
+    { 0x1d577, 0x6c },
+    { 0x1d578, 0x6d },
+    { 0x1d579, 0x6e },
+    { 0x1d57a, 0x6f },
+    { 0x1d57b, 0x70 },
+    { 0x1d57c, 0x71 },
+    { 0x1d57d, 0x72 },
+    { 0x1d57e, 0x73 },
+    { 0x1d57f, 0x74 },
+    { 0x1d580, 0x75 },
+    { 0x1d581, 0x76 },
+    { 0x1d582, 0x77 },
+    { 0x1d583, 0x78 },
+    { 0x1d584, 0x79 },
+    { 0x1d585, 0x7a },
+    { 0x1d586, 0x61 },
+    { 0x1d587, 0x62 },
+    { 0x1d588, 0x63 },
+    { 0x1d589, 0x64 },
+    { 0x1d58a, 0x65 },
+    { 0x1d58b, 0x66 },
+    { 0x1d58c, 0x67 },
+    { 0x1d58d, 0x68 },
+    { 0x1d58e, 0x69 },
+    { 0x1d58f, 0x6a },
+    { 0x1d590, 0x6b },
+    { 0x1d591, 0x6c },
+    { 0x1d592, 0x6d },
+    { 0x1d593, 0x6e },
+    { 0x1d594, 0x6f },
+    { 0x1d595, 0x70 },
+    { 0x1d596, 0x71 },
+    { 0x1d597, 0x72 },
+    { 0x1d598, 0x73 },
+    { 0x1d599, 0x74 },
+    { 0x1d59a, 0x75 },
+    { 0x1d59b, 0x76 },
+    { 0x1d59c, 0x77 },
+    { 0x1d59d, 0x78 },
+    { 0x1d59e, 0x79 },
+    { 0x1d59f, 0x7a },
+    { 0x1d5a0, 0x61 },
+    { 0x1d5a1, 0x62 },
+    { 0x1d5a2, 0x63 },
+    { 0x1d5a3, 0x64 },
+    { 0x1d5a4, 0x65 },
+    { 0x1d5a5, 0x66 },
+    { 0x1d5a6, 0x67 },
+    { 0x1d5a7, 0x68 },
+    { 0x1d5a8, 0x69 },
+    { 0x1d5a9, 0x6a },
+    { 0x1d5aa, 0x6b },
+    { 0x1d5ab, 0x6c },
+    { 0x1d5ac, 0x6d },
+    { 0x1d5ad, 0x6e },
+    { 0x1d5ae, 0x6f },
+    { 0x1d5af, 0x70 },
+    { 0x1d5b0, 0x71 },
+    { 0x1d5b1, 0x72 },
+    { 0x1d5b2, 0x73 },
+    { 0x1d5b3, 0x74 },
+    { 0x1d5b4, 0x75 },
+    { 0x1d5b5, 0x76 },
+    { 0x1d5b6, 0x77 },
+    { 0x1d5b7, 0x78 },
+    { 0x1d5b8, 0x79 },
+    { 0x1d5b9, 0x7a },
+    { 0x1d5ba, 0x61 },
+    { 0x1d5bb, 0x62 },
+    { 0x1d5bc, 0x63 },
+    { 0x1d5bd, 0x64 },
+    { 0x1d5be, 0x65 },
+    { 0x1d5bf, 0x66 },
+    { 0x1d5c0, 0x67 },
+    { 0x1d5c1, 0x68 },
+    { 0x1d5c2, 0x69 },
+    { 0x1d5c3, 0x6a },
+    { 0x1d5c4, 0x6b },
+    { 0x1d5c5, 0x6c },
+    { 0x1d5c6, 0x6d },
+    { 0x1d5c7, 0x6e },
+    { 0x1d5c8, 0x6f },
+    { 0x1d5c9, 0x70 },
+    { 0x1d5ca, 0x71 },
+    { 0x1d5cb, 0x72 },
+    { 0x1d5cc, 0x73 },
+    { 0x1d5cd, 0x74 },
+    { 0x1d5ce, 0x75 },
+    { 0x1d5cf, 0x76 },
+    { 0x1d5d0, 0x77 },
+    { 0x1d5d1, 0x78 },
+    { 0x1d5d2, 0x79 },
+    { 0x1d5d3, 0x7a },
+    { 0x1d5d4, 0x61 },
+    { 0x1d5d5, 0x62 },
+    { 0x1d5d6, 0x63 },
+    { 0x1d5d7, 0x64 },
+    { 0x1d5d8, 0x65 },
+    { 0x1d5d9, 0x66 },
+    { 0x1d5da, 0x67 },
+    { 0x1d5db, 0x68 },
+    { 0x1d5dc, 0x69 },
+    { 0x1d5dd, 0x6a },
+    { 0x1d5de, 0x6b },
+    { 0x1d5df, 0x6c },
+    { 0x1d5e0, 0x6d },
+    { 0x1d5e1, 0x6e },
+    { 0x1d5e2, 0x6f },
+    { 0x1d5e3, 0x70 },
+    { 0x1d5e4, 0x71 },
+    { 0x1d5e5, 0x72 },
+    { 0x1d5e6, 0x73 },
+    { 0x1d5e7, 0x74 },
+    { 0x1d5e8, 0x75 },
+    { 0x1d5e9, 0x76 },
+    { 0x1d5ea, 0x77 },
+    { 0x1d5eb, 0x78 },
+    { 0x1d5ec, 0x79 },
+    { 0x1d5ed, 0x7a },
+    { 0x1d5ee, 0x61 },
+    { 0x1d5ef, 0x62 },
+    { 0x1d5f0, 0x63 },
+    { 0x1d5f1, 0x64 },
+    { 0x1d5f2, 0x65 },
+    { 0x1d5f3, 0x66 },
+    { 0x1d5f4, 0x67 },
+    { 0x1d5f5, 0x68 },
+    { 0x1d5f6, 0x69 },
+    { 0x1d5f7, 0x6a },
+    { 0x1d5f8, 0x6b },
+    { 0x1d5f9, 0x6c },
+    { 0x1d5fa, 0x6d },
+    { 0x1d5fb, 0x6e },
+    { 0x1d5fc, 0x6f },
+    { 0x1d5fd, 0x70 },
+    { 0x1d5fe, 0x71 },
+    { 0x1d5ff, 0x72 },
+    { 0x1d600, 0x73 },
+    { 0x1d601, 0x74 },
+    { 0x1d602, 0x75 },
+    { 0x1d603, 0x76 },
+    { 0x1d604, 0x77 },
+    { 0x1d605, 0x78 },
+    { 0x1d606, 0x79 },
+    { 0x1d607, 0x7a },
+    { 0x1d608, 0x61 },
+    { 0x1d609, 0x62 },
+    { 0x1d60a, 0x63 },
+    { 0x1d60b, 0x64 },
+    { 0x1d60c, 0x65 },
+    { 0x1d60d, 0x66 },
+    { 0x1d60e, 0x67 },
+    { 0x1d60f, 0x68 },
+    { 0x1d610, 0x69 },
+    { 0x1d611, 0x6a },
+    { 0x1d612, 0x6b },
+    { 0x1d613, 0x6c },
+    { 0x1d614, 0x6d },
+    { 0x1d615, 0x6e },
+    { 0x1d616, 0x6f },
+    { 0x1d617, 0x70 },
+    { 0x1d618, 0x71 },
+    { 0x1d619, 0x72 },
+    { 0x1d61a, 0x73 },
+    { 0x1d61b, 0x74 },
+    { 0x1d61c, 0x75 },
+    { 0x1d61d, 0x76 },
+    { 0x1d61e, 0x77 },
+    { 0x1d61f, 0x78 },
+    { 0x1d620, 0x79 },
+    { 0x1d621, 0x7a },
+    { 0x1d622, 0x61 },
+    { 0x1d623, 0x62 },
+    { 0x1d624, 0x63 },
+    { 0x1d625, 0x64 },
+    { 0x1d626, 0x65 },
+    { 0x1d627, 0x66 },
+    { 0x1d628, 0x67 },
+    { 0x1d629, 0x68 },
+    { 0x1d62a, 0x69 },
+    { 0x1d62b, 0x6a },
+    { 0x1d62c, 0x6b },
+    { 0x1d62d, 0x6c },
+    { 0x1d62e, 0x6d },
+    { 0x1d62f, 0x6e },
+    { 0x1d630, 0x6f },
+    { 0x1d631, 0x70 },
+    { 0x1d632, 0x71 },
+    { 0x1d633, 0x72 },
+    { 0x1d634, 0x73 },
+    { 0x1d635, 0x74 },
+    { 0x1d636, 0x75 },
+    { 0x1d637, 0x76 },
+    { 0x1d638, 0x77 },
+    { 0x1d639, 0x78 },
+    { 0x1d63a, 0x79 },
+    { 0x1d63b, 0x7a },
+    { 0x1d63c, 0x61 },
+    { 0x1d63d, 0x62 },
+    { 0x1d63e, 0x63 },
+    { 0x1d63f, 0x64 },
+    { 0x1d640, 0x65 },
+    { 0x1d641, 0x66 },
+    { 0x1d642, 0x67 },
+    { 0x1d643, 0x68 },
+    { 0x1d644, 0x69 },
+    { 0x1d645, 0x6a },
+    { 0x1d646, 0x6b },
+    { 0x1d647, 0x6c },
+    { 0x1d648, 0x6d },
+    { 0x1d649, 0x6e },
+    { 0x1d64a, 0x6f },
+    { 0x1d64b, 0x70 },
+    { 0x1d64c, 0x71 },
+    { 0x1d64d, 0x72 },
+    { 0x1d64e, 0x73 },
+    { 0x1d64f, 0x74 },
+    { 0x1d650, 0x75 },
+    { 0x1d651, 0x76 },
+    { 0x1d652, 0x77 },
+    { 0x1d653, 0x78 },
+    { 0x1d654, 0x79 },
+    { 0x1d655, 0x7a },
+    { 0x1d656, 0x61 },
+    { 0x1d657, 0x62 },
+    { 0x1d658, 0x63 },
+    { 0x1d659, 0x64 },
+    { 0x1d65a, 0x65 },
+    { 0x1d65b, 0x66 },
+    { 0x1d65c, 0x67 },
+    { 0x1d65d, 0x68 },
+    { 0x1d65e, 0x69 },
+    { 0x1d65f, 0x6a },
+    { 0x1d660, 0x6b },
+    { 0x1d661, 0x6c },
+    { 0x1d662, 0x6d },
+    { 0x1d663, 0x6e },
+    { 0x1d664, 0x6f },
+    { 0x1d665, 0x70 },
+    { 0x1d666, 0x71 },
+    { 0x1d667, 0x72 },
+    { 0x1d668, 0x73 },
+    { 0x1d669, 0x74 },
+    { 0x1d66a, 0x75 },
+    { 0x1d66b, 0x76 },
+    { 0x1d66c, 0x77 },
+    { 0x1d66d, 0x78 },
+    { 0x1d66e, 0x79 },
+    { 0x1d66f, 0x7a },
+    { 0x1d670, 0x61 },
+    { 0x1d671, 0x62 },
+    { 0x1d672, 0x63 },
+    { 0x1d673, 0x64 },
+    { 0x1d674, 0x65 },
+    { 0x1d675, 0x66 },
+    { 0x1d676, 0x67 },
+    { 0x1d677, 0x68 },
+    { 0x1d678, 0x69 },
+    { 0x1d679, 0x6a },
+    { 0x1d67a, 0x6b },
+    { 0x1d67b, 0x6c },
+    { 0x1d67c, 0x6d },
+    { 0x1d67d, 0x6e },
+    { 0x1d67e, 0x6f },
+    { 0x1d67f, 0x70 },
+    { 0x1d680, 0x71 },
+    { 0x1d681, 0x72 },
+    { 0x1d682, 0x73 },
+    { 0x1d683, 0x74 },
+    { 0x1d684, 0x75 },
+    { 0x1d685, 0x76 },
+    { 0x1d686, 0x77 },
+    { 0x1d687, 0x78 },
+    { 0x1d688, 0x79 },
+    { 0x1d689, 0x7a },
+    { 0x1d68a, 0x61 },
+    { 0x1d68b, 0x62 },
+    { 0x1d68c, 0x63 },
+    { 0x1d68d, 0x64 },
+    { 0x1d68e, 0x65 },
+    { 0x1d68f, 0x66 },
+    { 0x1d690, 0x67 },
+    { 0x1d691, 0x68 },
+    { 0x1d692, 0x69 },
+    { 0x1d693, 0x6a },
+    { 0x1d694, 0x6b },
+    { 0x1d695, 0x6c },
+    { 0x1d696, 0x6d },
+    { 0x1d697, 0x6e },
+    { 0x1d698, 0x6f },
+    { 0x1d699, 0x70 },
+    { 0x1d69a, 0x71 },
+    { 0x1d69b, 0x72 },
+    { 0x1d69c, 0x73 },
+    { 0x1d69d, 0x74 },
+    { 0x1d69e, 0x75 },
+    { 0x1d69f, 0x76 },
+    { 0x1d6a0, 0x77 },
+    { 0x1d6a1, 0x78 },
+    { 0x1d6a2, 0x79 },
+    { 0x1d6a3, 0x7a },
+    { 0x1d6a4, 0x131 },
+    { 0x1d6a5, 0x237 },
+    { 0x1d6a8, 0x3b1 },
+    { 0x1d6a9, 0x3b2 },
+    { 0x1d6aa, 0x3b3 },
+    { 0x1d6ab, 0x3b4 },
+    { 0x1d6ac, 0x3b5 },
+    { 0x1d6ad, 0x3b6 },
+    { 0x1d6ae, 0x3b7 },
+    { 0x1d6af, 0x3b8 },
+    { 0x1d6b0, 0x3b9 },
+    { 0x1d6b1, 0x3ba },
+    { 0x1d6b2, 0x3bb },
+    { 0x1d6b3, 0x3bc },
+    { 0x1d6b4, 0x3bd },
+    { 0x1d6b5, 0x3be },
+    { 0x1d6b6, 0x3bf },
+    { 0x1d6b7, 0x3c0 },
+    { 0x1d6b8, 0x3c1 },
+    { 0x1d6b9, 0x3b8 },
+    { 0x1d6ba, 0x3c3 },
+    { 0x1d6bb, 0x3c4 },
+    { 0x1d6bc, 0x3c5 },
+    { 0x1d6bd, 0x3c6 },
+    { 0x1d6be, 0x3c7 },
+    { 0x1d6bf, 0x3c8 },
+    { 0x1d6c0, 0x3c9 },
+    { 0x1d6c1, 0x2207 },
+    { 0x1d6c2, 0x3b1 },
+    { 0x1d6c3, 0x3b2 },
+    { 0x1d6c4, 0x3b3 },
+    { 0x1d6c5, 0x3b4 },
+    { 0x1d6c6, 0x3b5 },
+    { 0x1d6c7, 0x3b6 },
+    { 0x1d6c8, 0x3b7 },
+    { 0x1d6c9, 0x3b8 },
+    { 0x1d6ca, 0x3b9 },
+    { 0x1d6cb, 0x3ba },
+    { 0x1d6cc, 0x3bb },
+    { 0x1d6cd, 0x3bc },
+    { 0x1d6ce, 0x3bd },
+    { 0x1d6cf, 0x3be },
+    { 0x1d6d0, 0x3bf },
+    { 0x1d6d1, 0x3c0 },
+    { 0x1d6d2, 0x3c1 },
+    { 0x1d6d3, 0x3c2 },
+    { 0x1d6d4, 0x3c3 },
+    { 0x1d6d5, 0x3c4 },
+    { 0x1d6d6, 0x3c5 },
+    { 0x1d6d7, 0x3c6 },
+    { 0x1d6d8, 0x3c7 },
+    { 0x1d6d9, 0x3c8 },
+    { 0x1d6da, 0x3c9 },
+    { 0x1d6db, 0x2202 },
+    { 0x1d6dc, 0x3b5 },
+    { 0x1d6dd, 0x3b8 },
+    { 0x1d6de, 0x3ba },
+    { 0x1d6df, 0x3c6 },
+    { 0x1d6e0, 0x3c1 },
+    { 0x1d6e1, 0x3c0 },
+    { 0x1d6e2, 0x3b1 },
+    { 0x1d6e3, 0x3b2 },
+    { 0x1d6e4, 0x3b3 },
+    { 0x1d6e5, 0x3b4 },
+    { 0x1d6e6, 0x3b5 },
+    { 0x1d6e7, 0x3b6 },
+    { 0x1d6e8, 0x3b7 },
+    { 0x1d6e9, 0x3b8 },
+    { 0x1d6ea, 0x3b9 },
+    { 0x1d6eb, 0x3ba },
+    { 0x1d6ec, 0x3bb },
+    { 0x1d6ed, 0x3bc },
+    { 0x1d6ee, 0x3bd },
+    { 0x1d6ef, 0x3be },
+    { 0x1d6f0, 0x3bf },
+    { 0x1d6f1, 0x3c0 },
+    { 0x1d6f2, 0x3c1 },
+    { 0x1d6f3, 0x3b8 },
+    { 0x1d6f4, 0x3c3 },
+    { 0x1d6f5, 0x3c4 },
+    { 0x1d6f6, 0x3c5 },
+    { 0x1d6f7, 0x3c6 },
+    { 0x1d6f8, 0x3c7 },
+    { 0x1d6f9, 0x3c8 },
+    { 0x1d6fa, 0x3c9 },
+    { 0x1d6fb, 0x2207 },
+    { 0x1d6fc, 0x3b1 },
+    { 0x1d6fd, 0x3b2 },
+    { 0x1d6fe, 0x3b3 },
+    { 0x1d6ff, 0x3b4 },
+    { 0x1d700, 0x3b5 },
+    { 0x1d701, 0x3b6 },
+    { 0x1d702, 0x3b7 },
+    { 0x1d703, 0x3b8 },
+    { 0x1d704, 0x3b9 },
+    { 0x1d705, 0x3ba },
+    { 0x1d706, 0x3bb },
+    { 0x1d707, 0x3bc },
+    { 0x1d708, 0x3bd },
+    { 0x1d709, 0x3be },
+    { 0x1d70a, 0x3bf },
+    { 0x1d70b, 0x3c0 },
+    { 0x1d70c, 0x3c1 },
+    { 0x1d70d, 0x3c2 },
+    { 0x1d70e, 0x3c3 },
+    { 0x1d70f, 0x3c4 },
+    { 0x1d710, 0x3c5 },
+    { 0x1d711, 0x3c6 },
+    { 0x1d712, 0x3c7 },
+    { 0x1d713, 0x3c8 },
+    { 0x1d714, 0x3c9 },
+    { 0x1d715, 0x2202 },
+    { 0x1d716, 0x3b5 },
+    { 0x1d717, 0x3b8 },
+    { 0x1d718, 0x3ba },
+    { 0x1d719, 0x3c6 },
+    { 0x1d71a, 0x3c1 },
+    { 0x1d71b, 0x3c0 },
+    { 0x1d71c, 0x3b1 },
+    { 0x1d71d, 0x3b2 },
+    { 0x1d71e, 0x3b3 },
+    { 0x1d71f, 0x3b4 },
+    { 0x1d720, 0x3b5 },
+    { 0x1d721, 0x3b6 },
+    { 0x1d722, 0x3b7 },
+    { 0x1d723, 0x3b8 },
+    { 0x1d724, 0x3b9 },
+    { 0x1d725, 0x3ba },
+    { 0x1d726, 0x3bb },
+    { 0x1d727, 0x3bc },
+    { 0x1d728, 0x3bd },
+    { 0x1d729, 0x3be },
+    { 0x1d72a, 0x3bf },
+    { 0x1d72b, 0x3c0 },
+    { 0x1d72c, 0x3c1 },
+    { 0x1d72d, 0x3b8 },
+    { 0x1d72e, 0x3c3 },
+    { 0x1d72f, 0x3c4 },
+    { 0x1d730, 0x3c5 },
+    { 0x1d731, 0x3c6 },
+    { 0x1d732, 0x3c7 },
+    { 0x1d733, 0x3c8 },
+    { 0x1d734, 0x3c9 },
+    { 0x1d735, 0x2207 },
+    { 0x1d736, 0x3b1 },
+    { 0x1d737, 0x3b2 },
+    { 0x1d738, 0x3b3 },
+    { 0x1d739, 0x3b4 },
+    { 0x1d73a, 0x3b5 },
+    { 0x1d73b, 0x3b6 },
+    { 0x1d73c, 0x3b7 },
+    { 0x1d73d, 0x3b8 },
+    { 0x1d73e, 0x3b9 },
+    { 0x1d73f, 0x3ba },
+    { 0x1d740, 0x3bb },
+    { 0x1d741, 0x3bc },
+    { 0x1d742, 0x3bd },
+    { 0x1d743, 0x3be },
+    { 0x1d744, 0x3bf },
+    { 0x1d745, 0x3c0 },
+    { 0x1d746, 0x3c1 },
+    { 0x1d747, 0x3c2 },
+    { 0x1d748, 0x3c3 },
+    { 0x1d749, 0x3c4 },
+    { 0x1d74a, 0x3c5 },
+    { 0x1d74b, 0x3c6 },
+    { 0x1d74c, 0x3c7 },
+    { 0x1d74d, 0x3c8 },
+    { 0x1d74e, 0x3c9 },
+    { 0x1d74f, 0x2202 },
+    { 0x1d750, 0x3b5 },
+    { 0x1d751, 0x3b8 },
+    { 0x1d752, 0x3ba },
+    { 0x1d753, 0x3c6 },
+    { 0x1d754, 0x3c1 },
+    { 0x1d755, 0x3c0 },
+    { 0x1d756, 0x3b1 },
+    { 0x1d757, 0x3b2 },
+    { 0x1d758, 0x3b3 },
+    { 0x1d759, 0x3b4 },
+    { 0x1d75a, 0x3b5 },
+    { 0x1d75b, 0x3b6 },
+    { 0x1d75c, 0x3b7 },
+    { 0x1d75d, 0x3b8 },
+    { 0x1d75e, 0x3b9 },
+    { 0x1d75f, 0x3ba },
+    { 0x1d760, 0x3bb },
+    { 0x1d761, 0x3bc },
+    { 0x1d762, 0x3bd },
+    { 0x1d763, 0x3be },
+    { 0x1d764, 0x3bf },
+    { 0x1d765, 0x3c0 },
+    { 0x1d766, 0x3c1 },
+    { 0x1d767, 0x3b8 },
+    { 0x1d768, 0x3c3 },
+    { 0x1d769, 0x3c4 },
+    { 0x1d76a, 0x3c5 },
+    { 0x1d76b, 0x3c6 },
+    { 0x1d76c, 0x3c7 },
+    { 0x1d76d, 0x3c8 },
+    { 0x1d76e, 0x3c9 },
+    { 0x1d76f, 0x2207 },
+    { 0x1d770, 0x3b1 },
+    { 0x1d771, 0x3b2 },
+    { 0x1d772, 0x3b3 },
+    { 0x1d773, 0x3b4 },
+    { 0x1d774, 0x3b5 },
+    { 0x1d775, 0x3b6 },
+    { 0x1d776, 0x3b7 },
+    { 0x1d777, 0x3b8 },
+    { 0x1d778, 0x3b9 },
+    { 0x1d779, 0x3ba },
+    { 0x1d77a, 0x3bb },
+    { 0x1d77b, 0x3bc },
+    { 0x1d77c, 0x3bd },
+    { 0x1d77d, 0x3be },
+    { 0x1d77e, 0x3bf },
+    { 0x1d77f, 0x3c0 },
+    { 0x1d780, 0x3c1 },
+    { 0x1d781, 0x3c2 },
+    { 0x1d782, 0x3c3 },
+    { 0x1d783, 0x3c4 },
+    { 0x1d784, 0x3c5 },
+    { 0x1d785, 0x3c6 },
+    { 0x1d786, 0x3c7 },
+    { 0x1d787, 0x3c8 },
+    { 0x1d788, 0x3c9 },
+    { 0x1d789, 0x2202 },
+    { 0x1d78a, 0x3b5 },
+    { 0x1d78b, 0x3b8 },
+    { 0x1d78c, 0x3ba },
+    { 0x1d78d, 0x3c6 },
+    { 0x1d78e, 0x3c1 },
+    { 0x1d78f, 0x3c0 },
+    { 0x1d790, 0x3b1 },
+    { 0x1d791, 0x3b2 },
+    { 0x1d792, 0x3b3 },
+    { 0x1d793, 0x3b4 },
+    { 0x1d794, 0x3b5 },
+    { 0x1d795, 0x3b6 },
+    { 0x1d796, 0x3b7 },
+    { 0x1d797, 0x3b8 },
+    { 0x1d798, 0x3b9 },
+    { 0x1d799, 0x3ba },
+    { 0x1d79a, 0x3bb },
+    { 0x1d79b, 0x3bc },
+    { 0x1d79c, 0x3bd },
+    { 0x1d79d, 0x3be },
+    { 0x1d79e, 0x3bf },
+    { 0x1d79f, 0x3c0 },
+    { 0x1d7a0, 0x3c1 },
+    { 0x1d7a1, 0x3b8 },
+    { 0x1d7a2, 0x3c3 },
+    { 0x1d7a3, 0x3c4 },
+    { 0x1d7a4, 0x3c5 },
+    { 0x1d7a5, 0x3c6 },
+    { 0x1d7a6, 0x3c7 },
+    { 0x1d7a7, 0x3c8 },
+    { 0x1d7a8, 0x3c9 },
+    { 0x1d7a9, 0x2207 },
+    { 0x1d7aa, 0x3b1 },
+    { 0x1d7ab, 0x3b2 },
+    { 0x1d7ac, 0x3b3 },
+    { 0x1d7ad, 0x3b4 },
+    { 0x1d7ae, 0x3b5 },
+    { 0x1d7af, 0x3b6 },
+    { 0x1d7b0, 0x3b7 },
+    { 0x1d7b1, 0x3b8 },
+    { 0x1d7b2, 0x3b9 },
+    { 0x1d7b3, 0x3ba },
+    { 0x1d7b4, 0x3bb },
+    { 0x1d7b5, 0x3bc },
+    { 0x1d7b6, 0x3bd },
+    { 0x1d7b7, 0x3be },
+    { 0x1d7b8, 0x3bf },
+    { 0x1d7b9, 0x3c0 },
+    { 0x1d7ba, 0x3c1 },
+    { 0x1d7bb, 0x3c2 },
+    { 0x1d7bc, 0x3c3 },
+    { 0x1d7bd, 0x3c4 },
+    { 0x1d7be, 0x3c5 },
+    { 0x1d7bf, 0x3c6 },
+    { 0x1d7c0, 0x3c7 },
+    { 0x1d7c1, 0x3c8 },
+    { 0x1d7c2, 0x3c9 },
+    { 0x1d7c3, 0x2202 },
+    { 0x1d7c4, 0x3b5 },
+    { 0x1d7c5, 0x3b8 },
+    { 0x1d7c6, 0x3ba },
+    { 0x1d7c7, 0x3c6 },
+    { 0x1d7c8, 0x3c1 },
+    { 0x1d7c9, 0x3c0 },
+    { 0x1d7ca, 0x3dd },
+    { 0x1d7cb, 0x3dd },
+    { 0x1d7ce, 0x30 },
+    { 0x1d7cf, 0x31 },
+    { 0x1d7d0, 0x32 },
+    { 0x1d7d1, 0x33 },
+    { 0x1d7d2, 0x34 },
+    { 0x1d7d3, 0x35 },
+    { 0x1d7d4, 0x36 },
+    { 0x1d7d5, 0x37 },
+    { 0x1d7d6, 0x38 },
+    { 0x1d7d7, 0x39 },
+    { 0x1d7d8, 0x30 },
+    { 0x1d7d9, 0x31 },
+    { 0x1d7da, 0x32 },
+    { 0x1d7db, 0x33 },
+    { 0x1d7dc, 0x34 },
+    { 0x1d7dd, 0x35 },
+    { 0x1d7de, 0x36 },
+    { 0x1d7df, 0x37 },
+    { 0x1d7e0, 0x38 },
+    { 0x1d7e1, 0x39 },
+    { 0x1d7e2, 0x30 },
+    { 0x1d7e3, 0x31 },
+    { 0x1d7e4, 0x32 },
+    { 0x1d7e5, 0x33 },
+    { 0x1d7e6, 0x34 },
+    { 0x1d7e7, 0x35 },
+    { 0x1d7e8, 0x36 },
+    { 0x1d7e9, 0x37 },
+    { 0x1d7ea, 0x38 },
+    { 0x1d7eb, 0x39 },
+    { 0x1d7ec, 0x30 },
+    { 0x1d7ed, 0x31 },
+    { 0x1d7ee, 0x32 },
+    { 0x1d7ef, 0x33 },
+    { 0x1d7f0, 0x34 },
+    { 0x1d7f1, 0x35 },
+    { 0x1d7f2, 0x36 },
+    { 0x1d7f3, 0x37 },
+    { 0x1d7f4, 0x38 },
+    { 0x1d7f5, 0x39 },
+    { 0x1d7f6, 0x30 },
+    { 0x1d7f7, 0x31 },
+    { 0x1d7f8, 0x32 },
+    { 0x1d7f9, 0x33 },
+    { 0x1d7fa, 0x34 },
+    { 0x1d7fb, 0x35 },
+    { 0x1d7fc, 0x36 },
+    { 0x1d7fd, 0x37 },
+    { 0x1d7fe, 0x38 },
+    { 0x1d7ff, 0x39 },
+    { 0x1e900, 0x1e922 },
+    { 0x1e901, 0x1e923 },
+    { 0x1e902, 0x1e924 },
+    { 0x1e903, 0x1e925 },
+    { 0x1e904, 0x1e926 },
+    { 0x1e905, 0x1e927 },
+    { 0x1e906, 0x1e928 },
+    { 0x1e907, 0x1e929 },
+    { 0x1e908, 0x1e92a },
+    { 0x1e909, 0x1e92b },
+    { 0x1e90a, 0x1e92c },
+    { 0x1e90b, 0x1e92d },
+    { 0x1e90c, 0x1e92e },
+    { 0x1e90d, 0x1e92f },
+    { 0x1e90e, 0x1e930 },
+    { 0x1e90f, 0x1e931 },
+    { 0x1e910, 0x1e932 },
+    { 0x1e911, 0x1e933 },
+    { 0x1e912, 0x1e934 },
+    { 0x1e913, 0x1e935 },
+    { 0x1e914, 0x1e936 },
+    { 0x1e915, 0x1e937 },
+    { 0x1e916, 0x1e938 },
+    { 0x1e917, 0x1e939 },
+    { 0x1e918, 0x1e93a },
+    { 0x1e919, 0x1e93b },
+    { 0x1e91a, 0x1e93c },
+    { 0x1e91b, 0x1e93d },
+    { 0x1e91c, 0x1e93e },
+    { 0x1e91d, 0x1e93f },
+    { 0x1e91e, 0x1e940 },
+    { 0x1e91f, 0x1e941 },
+    { 0x1e920, 0x1e942 },
+    { 0x1e921, 0x1e943 },
+    { 0x1ee00, 0x627 },
+    { 0x1ee01, 0x628 },
+    { 0x1ee02, 0x62c },
+    { 0x1ee03, 0x62f },
+    { 0x1ee05, 0x648 },
+    { 0x1ee06, 0x632 },
+    { 0x1ee07, 0x62d },
+    { 0x1ee08, 0x637 },
+    { 0x1ee09, 0x64a },
+    { 0x1ee0a, 0x643 },
+    { 0x1ee0b, 0x644 },
+    { 0x1ee0c, 0x645 },
+    { 0x1ee0d, 0x646 },
+    { 0x1ee0e, 0x633 },
+    { 0x1ee0f, 0x639 },
+    { 0x1ee10, 0x641 },
+    { 0x1ee11, 0x635 },
+    { 0x1ee12, 0x642 },
+    { 0x1ee13, 0x631 },
+    { 0x1ee14, 0x634 },
+    { 0x1ee15, 0x62a },
+    { 0x1ee16, 0x62b },
+    { 0x1ee17, 0x62e },
+    { 0x1ee18, 0x630 },
+    { 0x1ee19, 0x636 },
+    { 0x1ee1a, 0x638 },
+    { 0x1ee1b, 0x63a },
+    { 0x1ee1c, 0x66e },
+    { 0x1ee1d, 0x6ba },
+    { 0x1ee1e, 0x6a1 },
+    { 0x1ee1f, 0x66f },
+    { 0x1ee21, 0x628 },
+    { 0x1ee22, 0x62c },
+    { 0x1ee24, 0x647 },
+    { 0x1ee27, 0x62d },
+    { 0x1ee29, 0x64a },
+    { 0x1ee2a, 0x643 },
+    { 0x1ee2b, 0x644 },
+    { 0x1ee2c, 0x645 },
+    { 0x1ee2d, 0x646 },
+    { 0x1ee2e, 0x633 },
+    { 0x1ee2f, 0x639 },
+    { 0x1ee30, 0x641 },
+    { 0x1ee31, 0x635 },
+    { 0x1ee32, 0x642 },
+    { 0x1ee34, 0x634 },
+    { 0x1ee35, 0x62a },
+    { 0x1ee36, 0x62b },
+    { 0x1ee37, 0x62e },
+    { 0x1ee39, 0x636 },
+    { 0x1ee3b, 0x63a },
+    { 0x1ee42, 0x62c },
+    { 0x1ee47, 0x62d },
+    { 0x1ee49, 0x64a },
+    { 0x1ee4b, 0x644 },
+    { 0x1ee4d, 0x646 },
+    { 0x1ee4e, 0x633 },
+    { 0x1ee4f, 0x639 },
+    { 0x1ee51, 0x635 },
+    { 0x1ee52, 0x642 },
+    { 0x1ee54, 0x634 },
+    { 0x1ee57, 0x62e },
+    { 0x1ee59, 0x636 },
+    { 0x1ee5b, 0x63a },
+    { 0x1ee5d, 0x6ba },
+    { 0x1ee5f, 0x66f },
+    { 0x1ee61, 0x628 },
+    { 0x1ee62, 0x62c },
+    { 0x1ee64, 0x647 },
+    { 0x1ee67, 0x62d },
+    { 0x1ee68, 0x637 },
+    { 0x1ee69, 0x64a },
+    { 0x1ee6a, 0x643 },
+    { 0x1ee6c, 0x645 },
+    { 0x1ee6d, 0x646 },
+    { 0x1ee6e, 0x633 },
+    { 0x1ee6f, 0x639 },
+    { 0x1ee70, 0x641 },
+    { 0x1ee71, 0x635 },
+    { 0x1ee72, 0x642 },
+    { 0x1ee74, 0x634 },
+    { 0x1ee75, 0x62a },
+    { 0x1ee76, 0x62b },
+    { 0x1ee77, 0x62e },
+    { 0x1ee79, 0x636 },
+    { 0x1ee7a, 0x638 },
+    { 0x1ee7b, 0x63a },
+    { 0x1ee7c, 0x66e },
+    { 0x1ee7e, 0x6a1 },
+    { 0x1ee80, 0x627 },
+    { 0x1ee81, 0x628 },
+    { 0x1ee82, 0x62c },
+    { 0x1ee83, 0x62f },
+    { 0x1ee84, 0x647 },
+    { 0x1ee85, 0x648 },
+    { 0x1ee86, 0x632 },
+    { 0x1ee87, 0x62d },
+    { 0x1ee88, 0x637 },
+    { 0x1ee89, 0x64a },
+    { 0x1ee8b, 0x644 },
+    { 0x1ee8c, 0x645 },
+    { 0x1ee8d, 0x646 },
+    { 0x1ee8e, 0x633 },
+    { 0x1ee8f, 0x639 },
+    { 0x1ee90, 0x641 },
+    { 0x1ee91, 0x635 },
+    { 0x1ee92, 0x642 },
+    { 0x1ee93, 0x631 },
+    { 0x1ee94, 0x634 },
+    { 0x1ee95, 0x62a },
+    { 0x1ee96, 0x62b },
+    { 0x1ee97, 0x62e },
+    { 0x1ee98, 0x630 },
+    { 0x1ee99, 0x636 },
+    { 0x1ee9a, 0x638 },
+    { 0x1ee9b, 0x63a },
+    { 0x1eea1, 0x628 },
+    { 0x1eea2, 0x62c },
+    { 0x1eea3, 0x62f },
+    { 0x1eea5, 0x648 },
+    { 0x1eea6, 0x632 },
+    { 0x1eea7, 0x62d },
+    { 0x1eea8, 0x637 },
+    { 0x1eea9, 0x64a },
+    { 0x1eeab, 0x644 },
+    { 0x1eeac, 0x645 },
+    { 0x1eead, 0x646 },
+    { 0x1eeae, 0x633 },
+    { 0x1eeaf, 0x639 },
+    { 0x1eeb0, 0x641 },
+    { 0x1eeb1, 0x635 },
+    { 0x1eeb2, 0x642 },
+    { 0x1eeb3, 0x631 },
+    { 0x1eeb4, 0x634 },
+    { 0x1eeb5, 0x62a },
+    { 0x1eeb6, 0x62b },
+    { 0x1eeb7, 0x62e },
+    { 0x1eeb8, 0x630 },
+    { 0x1eeb9, 0x636 },
+    { 0x1eeba, 0x638 },
+    { 0x1eebb, 0x63a },
+    { 0x1f12b, 0x63 },
+    { 0x1f12c, 0x72 },
+    { 0x1f130, 0x61 },
+    { 0x1f131, 0x62 },
+    { 0x1f132, 0x63 },
+    { 0x1f133, 0x64 },
+    { 0x1f134, 0x65 },
+    { 0x1f135, 0x66 },
+    { 0x1f136, 0x67 },
+    { 0x1f137, 0x68 },
+    { 0x1f138, 0x69 },
+    { 0x1f139, 0x6a },
+    { 0x1f13a, 0x6b },
+    { 0x1f13b, 0x6c },
+    { 0x1f13c, 0x6d },
+    { 0x1f13d, 0x6e },
+    { 0x1f13e, 0x6f },
+    { 0x1f13f, 0x70 },
+    { 0x1f140, 0x71 },
+    { 0x1f141, 0x72 },
+    { 0x1f142, 0x73 },
+    { 0x1f143, 0x74 },
+    { 0x1f144, 0x75 },
+    { 0x1f145, 0x76 },
+    { 0x1f146, 0x77 },
+    { 0x1f147, 0x78 },
+    { 0x1f148, 0x79 },
+    { 0x1f149, 0x7a },
+    { 0x1f202, 0x30b5 },
+    { 0x1f210, 0x624b },
+    { 0x1f211, 0x5b57 },
+    { 0x1f212, 0x53cc },
+    { 0x1f214, 0x4e8c },
+    { 0x1f215, 0x591a },
+    { 0x1f216, 0x89e3 },
+    { 0x1f217, 0x5929 },
+    { 0x1f218, 0x4ea4 },
+    { 0x1f219, 0x6620 },
+    { 0x1f21a, 0x7121 },
+    { 0x1f21b, 0x6599 },
+    { 0x1f21c, 0x524d },
+    { 0x1f21d, 0x5f8c },
+    { 0x1f21e, 0x518d },
+    { 0x1f21f, 0x65b0 },
+    { 0x1f220, 0x521d },
+    { 0x1f221, 0x7d42 },
+    { 0x1f222, 0x751f },
+    { 0x1f223, 0x8ca9 },
+    { 0x1f224, 0x58f0 },
+    { 0x1f225, 0x5439 },
+    { 0x1f226, 0x6f14 },
+    { 0x1f227, 0x6295 },
+    { 0x1f228, 0x6355 },
+    { 0x1f229, 0x4e00 },
+    { 0x1f22a, 0x4e09 },
+    { 0x1f22b, 0x904a },
+    { 0x1f22c, 0x5de6 },
+    { 0x1f22d, 0x4e2d },
+    { 0x1f22e, 0x53f3 },
+    { 0x1f22f, 0x6307 },
+    { 0x1f230, 0x8d70 },
+    { 0x1f231, 0x6253 },
+    { 0x1f232, 0x7981 },
+    { 0x1f233, 0x7a7a },
+    { 0x1f234, 0x5408 },
+    { 0x1f235, 0x6e80 },
+    { 0x1f236, 0x6709 },
+    { 0x1f237, 0x6708 },
+    { 0x1f238, 0x7533 },
+    { 0x1f239, 0x5272 },
+    { 0x1f23a, 0x55b6 },
+    { 0x1f23b, 0x914d },
+    { 0x1f250, 0x5f97 },
+    { 0x1f251, 0x53ef },
+    { 0x1fbf0, 0x30 },
+    { 0x1fbf1, 0x31 },
+    { 0x1fbf2, 0x32 },
+    { 0x1fbf3, 0x33 },
+    { 0x1fbf4, 0x34 },
+    { 0x1fbf5, 0x35 },
+    { 0x1fbf6, 0x36 },
+    { 0x1fbf7, 0x37 },
+    { 0x1fbf8, 0x38 },
+    { 0x1fbf9, 0x39 },
+};
+
+// characters folding to several characters
+static const struct {
+    uint32_t cp;
+    const char *text;
+} fold_texts[] = {
+    { 0x1c4, "\x64\x7a" },
+    { 0x1c5, "\x64\x7a" },
+    { 0x1c6, "\x64\x7a" },
+    { 0x1c7, "\x6c\x6a" },
+    { 0x1c8, "\x6c\x6a" },
+    { 0x1c9, "\x6c\x6a" },
+    { 0x1ca, "\x6e\x6a" },
+    { 0x1cb, "\x6e\x6a" },
+    { 0x1cc, "\x6e\x6a" },
+    { 0x1f1, "\x64\x7a" },
+    { 0x1f2, "\x64\x7a" },
+    { 0x1f3, "\x64\x7a" },
+    { 0x1e9a, "\x61\xca\xbe" },
+    { 0x2025, "\x2e\x2e" },
+    { 0x2026, "\x2e\x2e\x2e" },
+    { 0x203c, "\x21\x21" },
+    { 0x2047, "\x3f\x3f" },
+    { 0x2048, "\x3f\x21" },
+    { 0x2049, "\x21\x3f" },
+    { 0x20a8, "\x72\x73" },
+    { 0x2100, "\x61\x2f\x63" },
+    { 0x2101, "\x61\x2f\x73" },
+    { 0x2103, "\xc2\xb0\x63" },
+    { 0x2105, "\x63\x2f\x6f" },
+    { 0x2106, "\x63\x2f\x75" },
+    { 0x2109, "\xc2\xb0\x66" },
+    { 0x2116, "\x6e\x6f" },
+    { 0x2120, "\x73\x6d" },
+    { 0x2121, "\x74\x65\x6c" },
+    { 0x2122, "\x74\x6d" },
+    { 0x213b, "\x66\x61\x78" },
+    { 0x2161, "\x69\x69" },
+    { 0x2162, "\x69\x69\x69" },
+    { 0x2163, "\x69\x76" },
+    { 0x2165, "\x76\x69" },
+    { 0x2166, "\x76\x69\x69" },
+    { 0x2168, "\x69\x78" },
+    { 0x216a, "\x78\x69" },
+    { 0x216b, "\x78\x69\x69" },
+    { 0x2171, "\x69\x69" },
+    { 0x2172, "\x69\x69\x69" },
+    { 0x2173, "\x69\x76" },
+    { 0x2175, "\x76\x69" },
+    { 0x2176, "\x76\x69\x69" },
+    { 0x2178, "\x69\x78" },
+    { 0x217a, "\x78\x69" },
+    { 0x217b, "\x78\x69\x69" },
+    { 0x2469, "\x31\x30" },
+    { 0x246a, "\x31\x31" },
+    { 0x246b, "\x31\x32" },
+    { 0x246c, "\x31\x33" },
+    { 0x246d, "\x31\x34" },
+    { 0x246e, "\x31\x35" },
+    { 0x246f, "\x31\x36" },
+    { 0x2470, "\x31\x37" },
+    { 0x2471, "\x31\x38" },
+    { 0x2472, "\x31\x39" },
+    { 0x2473, "\x32\x30" },
+    { 0x2474, "\x28\x31\x29" },
+    { 0x2475, "\x28\x32\x29" },
+    { 0x2476, "\x28\x33\x29" },
+    { 0x2477, "\x28\x34\x29" },
+    { 0x2478, "\x28\x35\x29" },
+    { 0x2479, "\x28\x36\x29" },
+    { 0x247a, "\x28\x37\x29" },
+    { 0x247b, "\x28\x38\x29" },
+    { 0x247c, "\x28\x39\x29" },
+    { 0x2488, "\x31\x2e" },
+    { 0x2489, "\x32\x2e" },
+    { 0x248a, "\x33\x2e" },
+    { 0x248b, "\x34\x2e" },
+    { 0x248c, "\x35\x2e" },
+    { 0x248d, "\x36\x2e" },
+    { 0x248e, "\x37\x2e" },
+    { 0x248f, "\x38\x2e" },
+    { 0x2490, "\x39\x2e" },
+    { 0x2491, "\x31\x30\x2e" },
+    { 0x2492, "\x31\x31\x2e" },
+    { 0x2493, "\x31\x32\x2e" },
+    { 0x2494, "\x31\x33\x2e" },
+    { 0x2495, "\x31\x34\x2e" },
+    { 0x2496, "\x31\x35\x2e" },
+    { 0x2497, "\x31\x36\x2e" },
+    { 0x2498, "\x31\x37\x2e" },
+    { 0x2499, "\x31\x38\x2e" },
+    { 0x249a, "\x31\x39\x2e" },
+    { 0x249b, "\x32\x30\x2e" },
+    { 0x249c, "\x28\x61\x29" },
+    { 0x249d, "\x28\x62\x29" },
+    { 0x249e, "\x28\x63\x29" },
+    { 0x249f, "\x28\x64\x29" },
+    { 0x24a0, "\x28\x65\x29" },
+    { 0x24a1, "\x28\x66\x29" },
+    { 0x24a2, "\x28\x67\x29" },
+    { 0x24a3, "\x28\x68\x29" },
+    { 0x24a4, "\x28\x69\x29" },
+    { 0x24a5, "\x28\x6a\x29" },
+    { 0x24a6, "\x28\x6b\x29" },
+    { 0x24a7, "\x28\x6c\x29" },
+    { 0x24a8, "\x28\x6d\x29" },
+    { 0x24a9, "\x28\x6e\x29" },
+    { 0x24aa, "\x28\x6f\x29" },
+    { 0x24ab, "\x28\x70\x29" },
+    { 0x24ac, "\x28\x71\x29" },
+    { 0x24ad, "\x28\x72\x29" },
+    { 0x24ae, "\x28\x73\x29" },
+    { 0x24af, "\x28\x74\x29" },
+    { 0x24b0, "\x28\x75\x29" },
+    { 0x24b1, "\x28\x76\x29" },
+    { 0x24b2, "\x28\x77\x29" },
+    { 0x24b3, "\x28\x78\x29" },
+    { 0x24b4, "\x28\x79\x29" },
+    { 0x24b5, "\x28\x7a\x29" },
+    { 0x2a74, "\x3a\x3a\x3d" },
+    { 0x2a75, "\x3d\x3d" },
+    { 0x2a76, "\x3d\x3d\x3d" },
+    { 0x3250, "\x70\x74\x65" },
+    { 0x3251, "\x32\x31" },
+    { 0x3252, "\x32\x32" },
+    { 0x3253, "\x32\x33" },
+    { 0x3254, "\x32\x34" },
+    { 0x3255, "\x32\x35" },
+    { 0x3256, "\x32\x36" },
+    { 0x3257, "\x32\x37" },
+    { 0x3258, "\x32\x38" },
+    { 0x3259, "\x32\x39" },
+    { 0x325a, "\x33\x30" },
+    { 0x325b, "\x33\x31" },
+    { 0x325c, "\x33\x32" },
+    { 0x325d, "\x33\x33" },
+    { 0x325e, "\x33\x34" },
+    { 0x325f, "\x33\x35" },
+    { 0x32b1, "\x33\x36" },
+    { 0x32b2, "\x33\x37" },
+    { 0x32b3, "\x33\x38" },
+    { 0x32b4, "\x33\x39" },
+    { 0x32b5, "\x34\x30" },
+    { 0x32b6, "\x34\x31" },
+    { 0x32b7, "\x34\x32" },
+    { 0x32b8, "\x34\x33" },
+    { 0x32b9, "\x34\x34" },
+    { 0x32ba, "\x34\x35" },
+    { 0x32bb, "\x34\x36" },
+    { 0x32bc, "\x34\x37" },
+    { 0x32bd, "\x34\x38" },
+    { 0x32be, "\x34\x39" },
+    { 0x32bf, "\x35\x30" },
+    { 0x32cc, "\x68\x67" },
+    { 0x32cd, "\x65\x72\x67" },
+    { 0x32ce, "\x65\x76" },
+    { 0x32cf, "\x6c\x74\x64" },
+    { 0x3371, "\x68\x70\x61" },
+    { 0x3372, "\x64\x61" },
+    { 0x3373, "\x61\x75" },
+    { 0x3374, "\x62\x61\x72" },
+    { 0x3375, "\x6f\x76" },
+    { 0x3376, "\x70\x63" },
+    { 0x3377, "\x64\x6d" },
+    { 0x3378, "\x64\x6d\x32" },
+    { 0x3379, "\x64\x6d\x33" },
+    { 0x337a, "\x69\x75" },
+    { 0x3380, "\x70\x61" },
+    { 0x3381, "\x6e\x61" },
+    { 0x3382, "\xce\xbc\x61" },
+    { 0x3383, "\x6d\x61" },
+    { 0x3384, "\x6b\x61" },
+    { 0x3385, "\x6b\x62" },
+    { 0x3386, "\x6d\x62" },
+    { 0x3387, "\x67\x62" },
+    { 0x3388, "\x63\x61\x6c" },
+    { 0x338a, "\x70\x66" },
+    { 0x338b, "\x6e\x66" },
+    { 0x338c, "\xce\xbc\x66" },
+    { 0x338d, "\xce\xbc\x67" },
+    { 0x338e, "\x6d\x67" },
+    { 0x338f, "\x6b\x67" },
+    { 0x3390, "\x68\x7a" },
+    { 0x3391, "\x6b\x68\x7a" },
+    { 0x3392, "\x6d\x68\x7a" },
+    { 0x3393, "\x67\x68\x7a" },
+    { 0x3394, "\x74\x68\x7a" },
+    { 0x3395, "\xce\xbc\x6c" },
+    { 0x3396, "\x6d\x6c" },
+    { 0x3397, "\x64\x6c" },
+    { 0x3398, "\x6b\x6c" },
+    { 0x3399, "\x66\x6d" },
+    { 0x339a, "\x6e\x6d" },
+    { 0x339b, "\xce\xbc\x6d" },
+    { 0x339c, "\x6d\x6d" },
+    { 0x339d, "\x63\x6d" },
+    { 0x339e, "\x6b\x6d" },
+    { 0x339f, "\x6d\x6d\x32" },
+    { 0x33a0, "\x63\x6d\x32" },
+    { 0x33a1, "\x6d\x32" },
+    { 0x33a2, "\x6b\x6d\x32" },
+    { 0x33a3, "\x6d\x6d\x33" },
+    { 0x33a4, "\x63\x6d\x33" },
+    { 0x33a5, "\x6d\x33" },
+    { 0x33a6, "\x6b\x6d\x33" },
+    { 0x33a9, "\x70\x61" },
+    { 0x33aa, "\x6b\x70\x61" },
+    { 0x33ab, "\x6d\x70\x61" },
+    { 0x33ac, "\x67\x70\x61" },
+    { 0x33ad, "\x72\x61\x64" },
+    { 0x33b0, "\x70\x73" },
+    { 0x33b1, "\x6e\x73" },
+    { 0x33b2, "\xce\xbc\x73" },
+    { 0x33b3, "\x6d\x73" },
+    { 0x33b4, "\x70\x76" },
+    { 0x33b5, "\x6e\x76" },
+    { 0x33b6, "\xce\xbc\x76" },
+    { 0x33b7, "\x6d\x76" },
+    { 0x33b8, "\x6b\x76" },
+    { 0x33b9, "\x6d\x76" },
+    { 0x33ba, "\x70\x77" },
+    { 0x33bb, "\x6e\x77" },
+    { 0x33bc, "\xce\xbc\x77" },
+    { 0x33bd, "\x6d\x77" },
+    { 0x33be, "\x6b\x77" },
+    { 0x33bf, "\x6d\x77" },
+    { 0x33c0, "\x6b\xcf\x89" },
+    { 0x33c1, "\x6d\xcf\x89" },
+    { 0x33c3, "\x62\x71" },
+    { 0x33c4, "\x63\x63" },
+    { 0x33c5, "\x63\x64" },
+    { 0x33c7, "\x63\x6f\x2e" },
+    { 0x33c8, "\x64\x62" },
+    { 0x33c9, "\x67\x79" },
+    { 0x33ca, "\x68\x61" },
+    { 0x33cb, "\x68\x70" },
+    { 0x33cc, "\x69\x6e" },
+    { 0x33cd, "\x6b\x6b" },
+    { 0x33ce, "\x6b\x6d" },
+    { 0x33cf, "\x6b\x74" },
+    { 0x33d0, "\x6c\x6d" },
+    { 0x33d1, "\x6c\x6e" },
+    { 0x33d2, "\x6c\x6f\x67" },
+    { 0x33d3, "\x6c\x78" },
+    { 0x33d4, "\x6d\x62" },
+    { 0x33d5, "\x6d\x69\x6c" },
+    { 0x33d6, "\x6d\x6f\x6c" },
+    { 0x33d7, "\x70\x68" },
+    { 0x33d9, "\x70\x70\x6d" },
+    { 0x33da, "\x70\x72" },
+    { 0x33db, "\x73\x72" },
+    { 0x33dc, "\x73\x76" },
+    { 0x33dd, "\x77\x62" },
+    { 0x33ff, "\x67\x61\x6c" },
+    { 0xfe19, "\x2e\x2e\x2e" },
+    { 0xfe30, "\x2e\x2e" },
+    { 0xfe70, "\x20\xd9\x8b" },
+    { 0xfe72, "\x20\xd9\x8c" },
+    { 0xfe74, "\x20\xd9\x8d" },
+    { 0xfe76, "\x20\xd9\x8e" },
+    { 0xfe78, "\x20\xd9\x8f" },
+    { 0xfe7a, "\x20\xd9\x90" },
+    { 0xfe7c, "\x20\xd9\x91" },
+    { 0xfe7e, "\x20\xd9\x92" },
+    { 0x1f100, "\x30\x2e" },
+    { 0x1f101, "\x30\x2c" },
+    { 0x1f102, "\x31\x2c" },
+    { 0x1f103, "\x32\x2c" },
+    { 0x1f104, "\x33\x2c" },
+    { 0x1f105, "\x34\x2c" },
+    { 0x1f106, "\x35\x2c" },
+    { 0x1f107, "\x36\x2c" },
+    { 0x1f108, "\x37\x2c" },
+    { 0x1f109, "\x38\x2c" },
+    { 0x1f10a, "\x39\x2c" },
+    { 0x1f110, "\x28\x61\x29" },
+    { 0x1f111, "\x28\x62\x29" },
+    { 0x1f112, "\x28\x63\x29" },
+    { 0x1f113, "\x28\x64\x29" },
+    { 0x1f114, "\x28\x65\x29" },
+    { 0x1f115, "\x28\x66\x29" },
+    { 0x1f116, "\x28\x67\x29" },
+    { 0x1f117, "\x28\x68\x29" },
+    { 0x1f118, "\x28\x69\x29" },
+    { 0x1f119, "\x28\x6a\x29" },
+    { 0x1f11a, "\x28\x6b\x29" },
+    { 0x1f11b, "\x28\x6c\x29" },
+    { 0x1f11c, "\x28\x6d\x29" },
+    { 0x1f11d, "\x28\x6e\x29" },
+    { 0x1f11e, "\x28\x6f\x29" },
+    { 0x1f11f, "\x28\x70\x29" },
+    { 0x1f120, "\x28\x71\x29" },
+    { 0x1f121, "\x28\x72\x29" },
+    { 0x1f122, "\x28\x73\x29" },
+    { 0x1f123, "\x28\x74\x29" },
+    { 0x1f124, "\x28\x75\x29" },
+    { 0x1f125, "\x28\x76\x29" },
+    { 0x1f126, "\x28\x77\x29" },
+    { 0x1f127, "\x28\x78\x29" },
+    { 0x1f128, "\x28\x79\x29" },
+    { 0x1f129, "\x28\x7a\x29" },
+    { 0x1f12d, "\x63\x64" },
+    { 0x1f12e, "\x77\x7a" },
+    { 0x1f14a, "\x68\x76" },
+    { 0x1f14b, "\x6d\x76" },
+    { 0x1f14c, "\x73\x64" },
+    { 0x1f14d, "\x73\x73" },
+    { 0x1f14e, "\x70\x70\x76" },
+    { 0x1f14f, "\x77\x63" },
+    { 0x1f16a, "\x6d\x63" },
+    { 0x1f16b, "\x6d\x64" },
+    { 0x1f16c, "\x6d\x72" },
+    { 0x1f190, "\x64\x6a" },
+};
+
+#endif
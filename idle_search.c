@@ -0,0 +1,290 @@
+/*
+    Quick Search Plugin for DeaDBeeF audio player
+    Copyright (C) 2014 Christian Boxdörfer <christian.boxdoerfer@posteo.de>
+
+    This program is free software; you can redistribute it and/or
+    modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation; either version 2
+    of the License, or (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+*/
+
+#include <stdlib.h>
+#include <string.h>
+#include <glib.h>
+
+#include "quick_search.h"
+#include "idle_search.h"
+#include "search_index.h"
+#include "result_cache.h"
+#include "search_stats.h"
+#include "trace_event.h"
+
+// tracks tokenized at once when a shard has to be built
+#define CHUNK_TRACKS 1024
+// positions deselected, or selected from a cached result, at once
+#define CHUNK_POSITIONS 16384
+// time a slice may keep the main loop busy. A slice runs at least one step,
+// and a few steps take longer: creating the index of a playlist, finishing
+// the build of a shard, matching a shard and storing the result of a
+// playlist grow with its tracks or its hits.
+#define SLICE_USEC 4000
+
+typedef struct {
+    int generation;
+    char *text;
+    qs_query_t *query;
+    ddb_playlist_t **plts;
+    int plt_count;
+    // playlist and shard searched next
+    int plt;
+    int shard;
+    // whether the search of the current playlist started, and its
+    // modification index at that time
+    int started;
+    int mod_idx;
+    // whether its old selection is cleared, and the position to continue
+    // clearing it or selecting the cached result with
+    int deselected;
+    int pos;
+    // its result if that was cached when it started
+    qs_set_t *cached;
+    // hits of the current playlist so far
+    uint32_t *hits;
+    int count;
+    int alloc;
+    // time spent on the current playlist and hits of all playlists done
+    int64_t match_usec;
+    int total;
+    guint source;
+    qs_idle_cb cb;
+    void *user_data;
+} qs_idle_job_t;
+
+static qs_idle_job_t *job = NULL;
+static int latest_generation = 0;
+
+static void
+job_free (qs_idle_job_t *j)
+{
+    if (j->source) {
+        g_source_remove (j->source);
+    }
+    for (int i = 0; i < j->plt_count; i++) {
+        deadbeef->plt_unref (j->plts[i]);
+    }
+    free (j->plts);
+    free (j->text);
+    qs_query_free (j->query);
+    free (j->hits);
+    qs_set_free (j->cached);
+    free (j);
+}
+
+static void
+restart_playlist (qs_idle_job_t *j)
+{
+    j->shard = 0;
+    j->started = 0;
+    j->deselected = 0;
+    j->pos = 0;
+    j->count = 0;
+    qs_set_free (j->cached);
+    j->cached = NULL;
+}
+
+static void
+next_playlist (qs_idle_job_t *j)
+{
+    j->plt++;
+    restart_playlist (j);
+}
+
+static int
+add_hits (qs_idle_job_t *j, const uint32_t *hits, int count)
+{
+    if (j->count + count > j->alloc) {
+        int alloc = j->alloc ? j->alloc : 1024;
+        while (alloc < j->count + count) {
+            alloc *= 2;
+        }
+        uint32_t *new_hits = realloc (j->hits, alloc * sizeof (uint32_t));
+        if (!new_hits) {
+            return -1;
+        }
+        j->hits = new_hits;
+        j->alloc = alloc;
+    }
+    memcpy (j->hits + j->count, hits, count * sizeof (uint32_t));
+    j->count += count;
+    return 0;
+}
+
+// does one chunk of work, returns the number of tracks it selected
+static int
+step (qs_idle_job_t *j)
+{
+    ddb_playlist_t *plt = j->plts[j->plt];
+    if (j->started && j->mod_idx != deadbeef->plt_get_modification_idx (plt)) {
+        // the positions found so far are stale
+        restart_playlist (j);
+    }
+    qs_plt_index_t *idx = qs_index_prepare (plt);
+    if (!idx) {
+        deadbeef->plt_search_process (plt, j->text);
+        next_playlist (j);
+        return 1;
+    }
+    if (!j->started) {
+        // copied, the cache may drop it before it is selected
+        const qs_set_t *cached;
+        if (qs_cache_lookup (plt, j->query->key, &cached) >= 0) {
+            j->cached = qs_set_copy (cached);
+        }
+        j->started = 1;
+        j->mod_idx = deadbeef->plt_get_modification_idx (plt);
+    }
+    if (!j->deselected) {
+        j->pos = qs_index_deselect (idx, j->pos, CHUNK_POSITIONS);
+        if (j->pos < 0) {
+            j->deselected = 1;
+            j->pos = 0;
+        }
+        return 0;
+    }
+    if (j->cached) {
+        j->pos = qs_index_select_set (idx, j->cached, j->pos, CHUNK_POSITIONS);
+        if (j->pos >= 0) {
+            return 0;
+        }
+        int count = qs_set_count (j->cached);
+        qs_index_set_result_set (idx, j->cached);
+        j->total += count;
+        next_playlist (j);
+        return count;
+    }
+
+    if (j->shard < qs_index_shard_count (idx)) {
+        int res = qs_index_build_shard (idx, j->shard, CHUNK_TRACKS);
+        uint32_t *hits = NULL;
+        int count = -1;
+        if (res > 0) {
+            count = qs_index_query_shard (idx, j->shard, j->query, &hits);
+        }
+        else if (res == 0) {
+            return 0;
+        }
+        if (count < 0 || add_hits (j, hits, count) < 0) {
+            free (hits);
+            qs_index_apply (idx, j->text, NULL, -1);
+            next_playlist (j);
+            return 1;
+        }
+        qs_index_select (idx, hits, count);
+        free (hits);
+        j->shard++;
+        return count;
+    }
+
+    qs_index_sort_hits (idx, j->hits, j->count);
+    qs_index_set_result (idx, j->hits, j->count);
+    qs_cache_store (plt, j->query->key, j->hits, j->count);
+    j->total += j->count;
+    next_playlist (j);
+    return 0;
+}
+
+static gboolean
+slice (gpointer user_data)
+{
+    qs_idle_job_t *j = job;
+    gint64 deadline = g_get_monotonic_time () + SLICE_USEC;
+    int selected = 0;
+    int64_t start = qs_stats_now ();
+    deadbeef->pl_lock ();
+    qs_stats_since (QS_STAT_LOCK_WAIT, start);
+    int64_t locked = qs_stats_now ();
+    while (j->plt < j->plt_count) {
+        int plt = j->plt;
+        int64_t step_start = qs_stats_now ();
+        selected += step (j);
+        if (step_start) {
+            j->match_usec += qs_stats_now () - step_start;
+            if (j->plt != plt) {
+                qs_stats_record (QS_STAT_MATCH, j->match_usec);
+                j->match_usec = 0;
+            }
+        }
+        if (g_get_monotonic_time () >= deadline) {
+            break;
+        }
+    }
+    qs_stats_since (QS_STAT_LOCK_HOLD, locked);
+    deadbeef->pl_unlock ();
+    qs_trace_complete ("idle slice", start, j->text, "selected", selected);
+
+    int done = j->plt >= j->plt_count;
+    if (done) {
+        qs_stats_record (QS_STAT_HITS, j->total);
+        // the source is removed by returning FALSE
+        j->source = 0;
+        job = NULL;
+    }
+    if ((done || selected) && j->cb) {
+        j->cb (j->generation, done, j->user_data);
+    }
+    if (done) {
+        job_free (j);
+        return FALSE;
+    }
+    return TRUE;
+}
+
+int
+qs_idle_submit (const char *text, ddb_playlist_t **plts, int plt_count, qs_idle_cb cb, void *user_data)
+{
+    qs_idle_cancel ();
+    int generation = ++latest_generation;
+    qs_idle_job_t *j = calloc (1, sizeof (qs_idle_job_t));
+    if (j) {
+        j->text = strdup (text ? text : "");
+        j->query = j->text ? qs_query_compile (j->text) : NULL;
+    }
+    if (!j || !j->query) {
+        trace ("quick_search: failed to start idle search\n");
+        for (int i = 0; i < plt_count; i++) {
+            deadbeef->plt_unref (plts[i]);
+        }
+        free (plts);
+        if (j) {
+            free (j->text);
+            free (j);
+        }
+        return generation;
+    }
+    j->generation = generation;
+    j->plts = plts;
+    j->plt_count = plt_count;
+    j->cb = cb;
+    j->user_data = user_data;
+    j->source = g_idle_add (slice, NULL);
+    job = j;
+    return generation;
+}
+
+void
+qs_idle_cancel (void)
+{
+    if (job) {
+        job_free (job);
+        job = NULL;
+    }
+}
@@ -0,0 +1,44 @@
+/*
+    Quick Search Plugin for DeaDBeeF audio player
+    Copyright (C) 2014 Christian Boxdörfer <christian.boxdoerfer@posteo.de>
+
+    This program is free software; you can redistribute it and/or
+    modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation; either version 2
+    of the License, or (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+*/
+
+#ifndef __QS_IDLE_SEARCH_H
+#define __QS_IDLE_SEARCH_H
+
+#include <deadbeef/deadbeef.h>
+
+// Cooperative alternative to the search worker: the search runs on the main
+// loop in idle callbacks, each tokenizing or querying a chunk of tracks for a
+// few milliseconds under pl_lock. For setups where a background thread must
+// not touch the playlists.
+
+// called on the main loop after a slice selected more matches (done == 0)
+// and once the search is complete (done == 1)
+typedef void (*qs_idle_cb) (int generation, int done, void *user_data);
+
+// starts searching for text in the given playlists (taking over the
+// references) and returns the generation of the search. The previous idle
+// search gets cancelled.
+int
+qs_idle_submit (const char *text, ddb_playlist_t **plts, int plt_count, qs_idle_cb cb, void *user_data);
+
+// cancels the running idle search, if any
+void
+qs_idle_cancel (void);
+
+#endif
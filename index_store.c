@@ -0,0 +1,306 @@
+/*
+    Quick Search Plugin for DeaDBeeF audio player
+    Copyright (C) 2014 Christian Boxdörfer <christian.boxdoerfer@posteo.de>
+
+    This program is free software; you can redistribute it and/or
+    modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation; either version 2
+    of the License, or (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+*/
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "quick_search.h"
+#include "index_store.h"
+
+#define STORE_MAGIC "QSINDEX"
+// bump whenever the layout of the file or of the shard records changes, or
+// the way metadata gets folded and tokenized
+#define STORE_VERSION 6
+#define STORE_BYTE_ORDER 0x01020304
+// sessions a record is kept without being used
+#define MAX_AGE 4
+
+typedef struct {
+    char magic[8];
+    uint32_t version;
+    uint32_t byte_order;
+    uint64_t record_count;
+    uint64_t table_offset;
+} qs_store_header_t;
+
+// the table at the end of the file, sorted by fingerprint
+typedef struct {
+    uint64_t fingerprint;
+    uint64_t offset;
+    uint64_t size;
+    uint32_t age;
+    uint32_t reserved;
+} qs_store_entry_t;
+
+static void *map = NULL;
+static size_t map_size = 0;
+static const qs_store_entry_t *table = NULL;
+static uint64_t table_count = 0;
+
+static FILE *out = NULL;
+static char *out_path = NULL;
+static char *tmp_path = NULL;
+static uint64_t out_pos = 0;
+static qs_store_entry_t *entries = NULL;
+static uint64_t entry_count = 0;
+static uint64_t entry_alloc = 0;
+
+static int
+cmp_entry (const void *a, const void *b)
+{
+    const qs_store_entry_t *x = a;
+    const qs_store_entry_t *y = b;
+    return x->fingerprint < y->fingerprint ? -1 : x->fingerprint > y->fingerprint;
+}
+
+static const qs_store_entry_t *
+find_entry (const qs_store_entry_t *list, uint64_t count, uint64_t fingerprint)
+{
+    qs_store_entry_t key = { .fingerprint = fingerprint };
+    return count ? bsearch (&key, list, count, sizeof (qs_store_entry_t), cmp_entry) : NULL;
+}
+
+int
+qs_store_open (const char *path)
+{
+    if (map) {
+        return 0;
+    }
+    int fd = open (path, O_RDONLY);
+    if (fd < 0) {
+        return -1;
+    }
+    struct stat st;
+    if (fstat (fd, &st) < 0 || st.st_size < (off_t)sizeof (qs_store_header_t)) {
+        close (fd);
+        return -1;
+    }
+    void *m = mmap (NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    // the mapping stays valid without the descriptor
+    close (fd);
+    if (m == MAP_FAILED) {
+        return -1;
+    }
+
+    size_t size = st.st_size;
+    const qs_store_header_t *header = m;
+    uint64_t table_size = header->record_count * sizeof (qs_store_entry_t);
+    if (memcmp (header->magic, STORE_MAGIC, sizeof (STORE_MAGIC))
+            || header->version != STORE_VERSION
+            || header->byte_order != STORE_BYTE_ORDER
+            || header->record_count > size / sizeof (qs_store_entry_t)
+            || header->table_offset % 8
+            || header->table_offset > size || table_size > size - header->table_offset) {
+        trace ("quick_search: ignoring index file %s\n", path);
+        munmap (m, size);
+        return -1;
+    }
+    const qs_store_entry_t *t = (const qs_store_entry_t *)((const char *)m + header->table_offset);
+    for (uint64_t i = 0; i < header->record_count; i++) {
+        if (t[i].offset % 8 || t[i].offset > header->table_offset
+                || t[i].size > header->table_offset - t[i].offset
+                || (i && t[i].fingerprint <= t[i - 1].fingerprint)) {
+            trace ("quick_search: damaged index file %s\n", path);
+            munmap (m, size);
+            return -1;
+        }
+    }
+    map = m;
+    map_size = size;
+    table = t;
+    table_count = header->record_count;
+    trace ("quick_search: mapped %llu index records\n", (unsigned long long)table_count);
+    return 0;
+}
+
+const void *
+qs_store_find (uint64_t fingerprint, size_t *size)
+{
+    const qs_store_entry_t *e = find_entry (table, table_count, fingerprint);
+    if (!e) {
+        return NULL;
+    }
+    *size = e->size;
+    return (const char *)map + e->offset;
+}
+
+static int
+write_padded (const void *data, size_t size)
+{
+    static const char zeros[8];
+    size_t pad = (8 - size % 8) % 8;
+    if (fwrite (data, 1, size, out) != size || fwrite (zeros, 1, pad, out) != pad) {
+        return -1;
+    }
+    out_pos += size + pad;
+    return 0;
+}
+
+static void
+drop_output (void)
+{
+    if (out) {
+        fclose (out);
+        out = NULL;
+        unlink (tmp_path);
+    }
+    free (out_path);
+    out_path = NULL;
+    free (tmp_path);
+    tmp_path = NULL;
+    free (entries);
+    entries = NULL;
+    entry_count = 0;
+    entry_alloc = 0;
+}
+
+int
+qs_store_begin (const char *path)
+{
+    drop_output ();
+    out_path = strdup (path);
+    tmp_path = malloc (strlen (path) + 5);
+    if (!out_path || !tmp_path) {
+        drop_output ();
+        return -1;
+    }
+    sprintf (tmp_path, "%s.tmp", path);
+    out = fopen (tmp_path, "wb");
+    if (!out) {
+        drop_output ();
+        return -1;
+    }
+    // the header is written once the table is known
+    qs_store_header_t header;
+    memset (&header, 0, sizeof (header));
+    out_pos = 0;
+    if (write_padded (&header, sizeof (header)) < 0) {
+        drop_output ();
+        return -1;
+    }
+    return 0;
+}
+
+static int
+add_entry (uint64_t fingerprint, const void *data, size_t size, uint32_t age)
+{
+    if (!out) {
+        return -1;
+    }
+    if (entry_count >= entry_alloc) {
+        uint64_t alloc = entry_alloc ? entry_alloc * 2 : 64;
+        qs_store_entry_t *e = realloc (entries, alloc * sizeof (qs_store_entry_t));
+        if (!e) {
+            return -1;
+        }
+        entries = e;
+        entry_alloc = alloc;
+    }
+    qs_store_entry_t *e = &entries[entry_count];
+    memset (e, 0, sizeof (qs_store_entry_t));
+    e->fingerprint = fingerprint;
+    e->offset = out_pos;
+    e->size = size;
+    e->age = age;
+    if (write_padded (data, size) < 0) {
+        return -1;
+    }
+    entry_count++;
+    return 0;
+}
+
+int
+qs_store_add (uint64_t fingerprint, const void *data, size_t size)
+{
+    for (uint64_t i = 0; i < entry_count; i++) {
+        // identical shards of different playlists
+        if (entries[i].fingerprint == fingerprint) {
+            return 0;
+        }
+    }
+    return add_entry (fingerprint, data, size, 0);
+}
+
+int
+qs_store_commit (void)
+{
+    if (!out) {
+        return -1;
+    }
+    qsort (entries, entry_count, sizeof (qs_store_entry_t), cmp_entry);
+    uint64_t added = entry_count;
+    for (uint64_t i = 0; i < table_count; i++) {
+        if (table[i].age + 1 < MAX_AGE && !find_entry (entries, added, table[i].fingerprint)) {
+            if (add_entry (table[i].fingerprint, (const char *)map + table[i].offset, table[i].size, table[i].age + 1) < 0) {
+                drop_output ();
+                return -1;
+            }
+        }
+    }
+    qsort (entries, entry_count, sizeof (qs_store_entry_t), cmp_entry);
+
+    qs_store_header_t header;
+    memset (&header, 0, sizeof (header));
+    memcpy (header.magic, STORE_MAGIC, sizeof (STORE_MAGIC));
+    header.version = STORE_VERSION;
+    header.byte_order = STORE_BYTE_ORDER;
+    header.record_count = entry_count;
+    header.table_offset = out_pos;
+    if (write_padded (entries, entry_count * sizeof (qs_store_entry_t)) < 0
+            || fseek (out, 0, SEEK_SET) < 0
+            || fwrite (&header, 1, sizeof (header), out) != sizeof (header)
+            || fflush (out) < 0 || fsync (fileno (out)) < 0) {
+        drop_output ();
+        return -1;
+    }
+    fclose (out);
+    out = NULL;
+    // an existing mapping keeps the old file alive
+    int res = rename (tmp_path, out_path);
+    if (res < 0) {
+        unlink (tmp_path);
+    }
+    trace ("quick_search: saved %llu index records\n", (unsigned long long)entry_count);
+    drop_output ();
+    return res < 0 ? -1 : 0;
+}
+
+void
+qs_store_abort (void)
+{
+    drop_output ();
+}
+
+void
+qs_store_close (void)
+{
+    drop_output ();
+    if (map) {
+        munmap (map, map_size);
+    }
+    map = NULL;
+    map_size = 0;
+    table = NULL;
+    table_count = 0;
+}
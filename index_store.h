@@ -0,0 +1,65 @@
+/*
+    Quick Search Plugin for DeaDBeeF audio player
+    Copyright (C) 2014 Christian Boxdörfer <christian.boxdoerfer@posteo.de>
+
+    This program is free software; you can redistribute it and/or
+    modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation; either version 2
+    of the License, or (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+*/
+
+#ifndef __QS_INDEX_STORE_H
+#define __QS_INDEX_STORE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Persistent store of serialized index shards, kept in a single file in the
+// plugin cache directory. Records are identified by a fingerprint of their
+// content and memory-mapped when the store gets opened, so they can be used
+// without copying. Records which no shard asked for in a couple of sessions
+// are dropped when the store is saved.
+// The functions aren't thread safe, except for qs_store_find.
+
+// maps the store at path, returns -1 if it doesn't exist, is from another
+// version of the plugin or is damaged
+int
+qs_store_open (const char *path);
+
+// returns the record with the fingerprint and sets *size, or returns NULL.
+// The record stays valid until qs_store_close, even if the store is saved in
+// the meantime.
+const void *
+qs_store_find (uint64_t fingerprint, size_t *size);
+
+// starts writing a new version of the store at path, returns -1 on failure
+int
+qs_store_begin (const char *path);
+
+// adds a record to the store being written
+int
+qs_store_add (uint64_t fingerprint, const void *data, size_t size);
+
+// copies the records of the open store which weren't added to the new one,
+// unless they went unused for too long, and replaces the file
+int
+qs_store_commit (void);
+
+// drops the store being written
+void
+qs_store_abort (void);
+
+// unmaps the store and drops a store being written
+void
+qs_store_close (void);
+
+#endif
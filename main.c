@@ -28,21 +28,41 @@
 #include <deadbeef/gtkui_api.h>
 
 #include "support.h"
-
-//#define trace(...) { fprintf(stderr, __VA_ARGS__); }
-#define trace(fmt,...)
+#include "quick_search.h"
+#include "search_index.h"
+#include "search_worker.h"
+#include "result_sync.h"
+#include "idle_search.h"
+#include "change_notify.h"
+#include "search_delay.h"
+#include "result_cache.h"
+#include "search_stats.h"
+#include "trace_event.h"
+#include "match.h"
 
 #define CONFSTR_APPEND_SEARCH_STRING "quick_search.append_search_string"
 #define CONFSTR_SEARCH_IN "quick_search.search_in"
 #define CONFSTR_AUTOSEARCH "quick_search.autosearch"
 #define CONFSTR_HISTORY_SIZE "quick_search.history_size"
+#define CONFSTR_SEARCH_THREADS "quick_search.search_threads"
+#define CONFSTR_SNAPSHOT_SEARCH "quick_search.snapshot_search"
+#define CONFSTR_IDLE_SEARCH "quick_search.idle_search"
+#define CONFSTR_SEARCH_STATS "quick_search.search_stats"
+#define CONFSTR_SEARCH_TRACE "quick_search.search_trace"
+
+// the stats file gets rewritten at most that often while searching
+#define STATS_WRITE_USEC 10000000
 
 static DB_misc_t plugin;
-static DB_functions_t *deadbeef = NULL;
+DB_functions_t *deadbeef = NULL;
 static ddb_gtkui_t *gtkui_plugin = NULL;
 static GtkWidget *searchentry = NULL;
 static int search_delay_timer = 0;
 static ddb_playlist_t *last_active_plt = NULL;
+// cleared when a playlist gets deleted, last_active_plt is checked again then
+static int last_active_plt_checked = 1;
+static ddb_playlist_t *quick_search_plt = NULL;
+static int quick_search_plt_valid = 0;
 
 static gboolean new_plt_button_state = FALSE;
 static ddb_playlist_t *added_plt = NULL;
@@ -51,17 +71,12 @@ static const char *uuid = "779e2992-3e6e-40d4-9f2e-de06466142a0";
 static char cache_path[PATH_MAX];
 static int cache_path_size;
 
-// search in modes
-enum search_in_mode_t {
-    SEARCH_INLINE = 0,
-    SEARCH_PLAYLIST = 1,
-    SEARCH_ALL_PLAYLISTS = 2,
-};
-
 static int config_search_in = SEARCH_INLINE;
 static int config_autosearch = TRUE;
 static int config_append_search_string = FALSE;
 static int config_history_size = 10;
+static int config_idle_search = FALSE;
+static int config_search_trace = FALSE;
 
 typedef struct {
     ddb_gtkui_widget_t base;
@@ -129,6 +144,36 @@ get_file_descriptor (const char *path, const char *fname, const char *mode)
     return fp;
 }
 
+// returns the path of the file fname in the cache dir, or NULL without a
+// cache dir. The buffer is reused by the next call.
+static const char *
+get_cache_file_path (const char *fname)
+{
+    static char path[PATH_MAX];
+    if (!cache_path_size || snprintf (path, sizeof (path), "%s%s", cache_path, fname) >= (int)sizeof (path)) {
+        return NULL;
+    }
+    return path;
+}
+
+// starts or stops writing <cache>/quick_search/trace.json when the setting
+// changes, a trace cut short because it got too big isn't restarted
+static void
+update_tracing (void)
+{
+    int enable = deadbeef->conf_get_int (CONFSTR_SEARCH_TRACE, FALSE);
+    if (enable == config_search_trace) {
+        return;
+    }
+    config_search_trace = enable;
+    if (enable) {
+        qs_trace_start (get_cache_file_path ("trace.json"));
+    }
+    else {
+        qs_trace_stop ();
+    }
+}
+
 static void
 load_history_entries (gpointer user_data)
 {
@@ -179,47 +224,38 @@ save_history_entries (gpointer user_data)
 static gboolean
 is_quick_search_playlist (ddb_playlist_t *plt)
 {
+    if (!plt) {
+        return FALSE;
+    }
+    // the message thread invalidates the handle under pl_lock
     deadbeef->pl_lock ();
-    if (plt && deadbeef->plt_find_meta (plt, "quick_search") != NULL
-            && !strcmp (deadbeef->plt_find_meta (plt, "quick_search"), uuid)) {
-        deadbeef->pl_unlock ();
-        return TRUE;
+    gboolean res = plt == quick_search_plt && quick_search_plt_valid;
+    if (!res) {
+        const char *meta = deadbeef->plt_find_meta (plt, "quick_search");
+        res = meta && !strcmp (meta, uuid);
     }
     deadbeef->pl_unlock ();
-    return FALSE;
+    return res;
 }
 
 static ddb_playlist_t *
 get_last_active_playlist ()
 {
     deadbeef->pl_lock ();
-    ddb_playlist_t *plt = NULL;
-    if (!last_active_plt) {
-        plt = deadbeef->plt_get_curr ();
-    }
-    else {
-        // check if playlist got removed
-        int valid = 0;
-        int plt_count = deadbeef->plt_get_count();
-        for (int i = 0; i < plt_count; i++) {
-            ddb_playlist_t *plt_temp = deadbeef->plt_get_for_idx (i);
-            if (!plt_temp) {
-                continue;
-            }
-            if (plt_temp == last_active_plt) {
-                valid = 1;
-            }
-            deadbeef->plt_unref (plt_temp);
-        }
-        if (valid) {
-            plt = last_active_plt;
-            deadbeef->plt_ref (plt);
-        }
-        else {
+    if (last_active_plt && !last_active_plt_checked) {
+        // a playlist got removed since the last check, see if it was ours
+        if (deadbeef->plt_get_idx (last_active_plt) < 0) {
             deadbeef->plt_unref (last_active_plt);
             last_active_plt = NULL;
-            plt = deadbeef->plt_get_curr ();
         }
+        last_active_plt_checked = 1;
+    }
+    ddb_playlist_t *plt = last_active_plt;
+    if (plt) {
+        deadbeef->plt_ref (plt);
+    }
+    else {
+        plt = deadbeef->plt_get_curr ();
     }
     deadbeef->pl_unlock ();
     return plt;
@@ -235,10 +271,22 @@ set_last_active_playlist (ddb_playlist_t *plt)
         }
         last_active_plt = plt;
         deadbeef->plt_ref (last_active_plt);
+        last_active_plt_checked = 1;
     }
     deadbeef->pl_unlock ();
 }
 
+// called from the message thread when a playlist got deleted, the handles
+// kept by the GTK thread are checked again under pl_lock on their next use
+static void
+playlist_deleted (void)
+{
+    deadbeef->pl_lock ();
+    last_active_plt_checked = 0;
+    quick_search_plt_valid = 0;
+    deadbeef->pl_unlock ();
+}
+
 static int
 add_new_playlist (const char *title) {
     if (!title) {
@@ -248,46 +296,78 @@ add_new_playlist (const char *title) {
     return deadbeef->plt_add (cnt, title);
 }
 
-static int
+// returns a reference to the quick search playlist, creating it if necessary
+static ddb_playlist_t *
 get_quick_search_playlist () {
-    // find existing one
     deadbeef->pl_lock ();
+    if (quick_search_plt && quick_search_plt_valid) {
+        deadbeef->plt_ref (quick_search_plt);
+        deadbeef->pl_unlock ();
+        return quick_search_plt;
+    }
+    if (quick_search_plt) {
+        deadbeef->plt_unref (quick_search_plt);
+        quick_search_plt = NULL;
+    }
+
+    // find existing one
+    ddb_playlist_t *found = NULL;
     int plt_count = deadbeef->plt_get_count();
-    for (int i = 0; i < plt_count; i++) {
+    for (int i = 0; i < plt_count && !found; i++) {
         ddb_playlist_t *plt = deadbeef->plt_get_for_idx (i);
         if (plt) {
             if (is_quick_search_playlist (plt)) {
+                found = plt;
+            }
+            else {
                 deadbeef->plt_unref (plt);
-                deadbeef->pl_unlock ();
-                return i;
             }
-            deadbeef->plt_unref (plt);
         }
     }
 
-    // add new playlist
-    int idx = deadbeef->plt_add (plt_count, "Quick Search");
-    ddb_playlist_t *plt = deadbeef->plt_get_for_idx (idx);
-    // use a uuid to identify quick_search list
-    deadbeef->plt_add_meta (plt, "quick_search", uuid);
-    deadbeef->plt_unref (plt);
+    if (!found) {
+        // add new playlist
+        int idx = deadbeef->plt_add (plt_count, "Quick Search");
+        found = deadbeef->plt_get_for_idx (idx);
+        if (found) {
+            // use a uuid to identify quick_search list
+            deadbeef->plt_add_meta (found, "quick_search", uuid);
+        }
+    }
+
+    // keep the handle until a playlist gets deleted, adding or moving
+    // playlists doesn't affect it
+    if (found) {
+        quick_search_plt = found;
+        deadbeef->plt_ref (quick_search_plt);
+        quick_search_plt_valid = 1;
+    }
+    deadbeef->pl_unlock ();
+    return found;
+}
+
+static void
+forget_quick_search_playlist ()
+{
+    deadbeef->pl_lock ();
+    if (quick_search_plt) {
+        deadbeef->plt_unref (quick_search_plt);
+        quick_search_plt = NULL;
+    }
+    quick_search_plt_valid = 0;
     deadbeef->pl_unlock ();
-    return idx;
 }
 
 static void
 set_default_quick_search_playlist_title ()
 {
     deadbeef->pl_lock ();
-    int plt_idx = get_quick_search_playlist ();
-    if (plt_idx >= 0) {
-        ddb_playlist_t *plt = deadbeef->plt_get_for_idx (plt_idx);
-        if (plt) {
-            char new_title[1024] = "";
-            snprintf (new_title, sizeof (new_title), "%s", "Quick Search");
-            deadbeef->plt_set_title (plt, new_title);
-            deadbeef->plt_unref (plt);
-        }
+    ddb_playlist_t *plt = get_quick_search_playlist ();
+    if (plt) {
+        char new_title[1024] = "";
+        snprintf (new_title, sizeof (new_title), "%s", "Quick Search");
+        deadbeef->plt_set_title (plt, new_title);
+        deadbeef->plt_unref (plt);
     }
     deadbeef->pl_unlock ();
 }
@@ -322,45 +402,153 @@ append_search_string_to_plt_title (ddb_playlist_t *plt, const char *search_strin
     deadbeef->pl_unlock ();
 }
 
+typedef struct {
+    DB_playItem_t **tracks;
+    int count;
+    int alloc;
+} track_list_t;
+
 static void
-copy_selected_tracks (ddb_playlist_t *from, ddb_playlist_t *to)
+append_selected_tracks (ddb_playlist_t *from, track_list_t *list)
 {
-    if (!from || !to) {
+    if (!from) {
         return;
     }
     deadbeef->pl_lock ();
-    deadbeef->plt_set_curr (to);
-
     int sel_count = deadbeef->plt_get_sel_count (deadbeef->plt_get_idx (from));
-    uint32_t *track_list = malloc ((sel_count) * sizeof (uint32_t));
-    if (track_list) {
-        int track_idx = 0;
-        int i = 0;
-        DB_playItem_t *it = deadbeef->plt_get_first (from, PL_MAIN);
-        for (; it; track_idx++) {
-            if (deadbeef->pl_is_selected (it)) {
-                track_list[i] = track_idx;
-                i++;
-            }
-            DB_playItem_t *next = deadbeef->pl_get_next (it, PL_MAIN);
+    if (list->count + sel_count > list->alloc) {
+        int alloc = list->count + sel_count;
+        DB_playItem_t **tracks = realloc (list->tracks, alloc * sizeof (DB_playItem_t *));
+        if (!tracks) {
+            deadbeef->pl_unlock ();
+            return;
+        }
+        list->tracks = tracks;
+        list->alloc = alloc;
+    }
+    DB_playItem_t *it = deadbeef->plt_get_first (from, PL_MAIN);
+    while (it) {
+        DB_playItem_t *next = deadbeef->pl_get_next (it, PL_MAIN);
+        if (deadbeef->pl_is_selected (it) && list->count < list->alloc) {
+            // the list keeps the reference
+            list->tracks[list->count++] = it;
+        }
+        else {
             deadbeef->pl_item_unref (it);
-            it = next;
         }
-        DB_playItem_t *after = deadbeef->plt_get_first (to, PL_MAIN);
-        deadbeef->plt_copy_items (to, PL_MAIN, from, after, track_list, sel_count);
-        if (after) {
-            deadbeef->pl_item_unref (after);
+        it = next;
+    }
+    deadbeef->pl_unlock ();
+}
+
+// appends the result of the last search in from without walking the
+// playlist, falls back to its selected tracks if the index doesn't have it
+static void
+append_result_tracks (ddb_playlist_t *from, track_list_t *list)
+{
+    DB_playItem_t **tracks;
+    int count = qs_index_result_tracks (from, &tracks);
+    if (count < 0) {
+        append_selected_tracks (from, list);
+        return;
+    }
+    if (list->count + count > list->alloc) {
+        int alloc = list->count + count;
+        DB_playItem_t **grown = realloc (list->tracks, alloc * sizeof (DB_playItem_t *));
+        if (!grown) {
+            for (int i = 0; i < count; i++) {
+                deadbeef->pl_item_unref (tracks[i]);
+            }
+            free (tracks);
+            return;
         }
-        free (track_list);
+        list->tracks = grown;
+        list->alloc = alloc;
+    }
+    // the list keeps the references
+    memcpy (list->tracks + list->count, tracks, count * sizeof (DB_playItem_t *));
+    list->count += count;
+    free (tracks);
+}
+
+static void
+free_track_list (track_list_t *list)
+{
+    for (int i = 0; i < list->count; i++) {
+        deadbeef->pl_item_unref (list->tracks[i]);
+    }
+    free (list->tracks);
+    list->tracks = NULL;
+    list->count = 0;
+    list->alloc = 0;
+}
+
+// the first page of a result goes into the target playlist right away, the
+// rest follows in batches from the main loop
+#define FIRST_PAGE_TRACKS 200
+#define STREAM_BATCH_TRACKS 2000
+
+// result still being copied into stream_plt
+static track_list_t stream_result = { NULL, 0, 0 };
+static ddb_playlist_t *stream_plt = NULL;
+static guint stream_source = 0;
+
+static void
+stream_stop (void)
+{
+    if (stream_source) {
+        g_source_remove (stream_source);
+        stream_source = 0;
+    }
+    deadbeef->pl_lock ();
+    if (stream_plt) {
+        deadbeef->plt_unref (stream_plt);
+        stream_plt = NULL;
+    }
+    free_track_list (&stream_result);
+    deadbeef->pl_unlock ();
+}
+
+static gboolean
+stream_batch (gpointer user_data)
+{
+    int pending = 0;
+    int changes = 0;
+    int64_t start = qs_stats_now ();
+    deadbeef->pl_lock ();
+    // the playlist might have been deleted in the meantime
+    if (deadbeef->plt_get_idx (stream_plt) >= 0) {
+        changes = qs_sync_continue (stream_plt, stream_result.tracks, stream_result.count,
+                STREAM_BATCH_TRACKS, &pending);
     }
     deadbeef->pl_unlock ();
+    qs_stats_since (QS_STAT_COPY, start);
+    qs_trace_complete ("copy batch", start, NULL, "pending", pending);
+
+    if (changes) {
+        qs_notify_add (QS_CHANGE_CONTENT);
+        start = qs_stats_now ();
+        qs_notify_flush ();
+        qs_stats_since (QS_STAT_NOTIFY, start);
+        qs_trace_complete ("send events", start, NULL, NULL, 0);
+    }
+    if (!pending || !changes) {
+        // removed by returning FALSE
+        stream_source = 0;
+        stream_stop ();
+        return FALSE;
+    }
+    return TRUE;
 }
 
 static void
 on_add_quick_search_list ()
 {
+    stream_stop ();
+    int64_t start = qs_stats_now ();
     deadbeef->pl_lock ();
     int new_plt_idx = -1;
+    ddb_playlist_t *plt_to = NULL;
     if (new_plt_button_state) {
         if (added_plt == NULL) {
             new_plt_idx = add_new_playlist ("Quick Search*");
@@ -371,16 +559,24 @@ on_add_quick_search_list ()
         }
     }
     else {
-        new_plt_idx = get_quick_search_playlist ();
+        plt_to = get_quick_search_playlist ();
         if (added_plt) {
             deadbeef->plt_unref (added_plt);
             added_plt = NULL;
         }
     }
 
-    ddb_playlist_t *plt_to = deadbeef->plt_get_for_idx (new_plt_idx);
+    if (new_plt_idx >= 0) {
+        plt_to = deadbeef->plt_get_for_idx (new_plt_idx);
+    }
 
+    int changes = 0;
+    int copied = 0;
     if (plt_to) {
+        // the target playlist only gets the difference to the previous
+        // result, tracks found again keep their copies
+        track_list_t result = { NULL, 0, 0 };
+        int have_source = 0;
         if (config_search_in != SEARCH_ALL_PLAYLISTS) {
             ddb_playlist_t *plt_from = get_last_active_playlist ();
             if (plt_from) {
@@ -390,15 +586,12 @@ on_add_quick_search_list ()
                     deadbeef->pl_unlock ();
                     return;
                 }
-                deadbeef->plt_set_scroll (plt_to, 0);
-                deadbeef->plt_clear (plt_to);
-                copy_selected_tracks (plt_from, plt_to);
+                append_result_tracks (plt_from, &result);
                 deadbeef->plt_unref (plt_from);
+                have_source = 1;
             }
         }
         else if (config_search_in == SEARCH_ALL_PLAYLISTS) {
-            deadbeef->plt_set_scroll (plt_to, 0);
-            deadbeef->plt_clear (plt_to);
             int plt_count = deadbeef->plt_get_count ();
             for (int i = 0; i < plt_count; i++) {
                 ddb_playlist_t *plt_from = deadbeef->plt_get_for_idx (i);
@@ -406,52 +599,134 @@ on_add_quick_search_list ()
                     continue;
                 }
                 if (!is_quick_search_playlist (plt_from)) {
-                    copy_selected_tracks (plt_from, plt_to);
+                    append_result_tracks (plt_from, &result);
+                    have_source = 1;
                 }
                 deadbeef->plt_unref (plt_from);
             }
         }
+        if (have_source) {
+            deadbeef->plt_set_scroll (plt_to, 0);
+            deadbeef->plt_set_curr (plt_to);
+            int pending;
+            copied = result.count;
+            changes = qs_sync_playlist (plt_to, result.tracks, result.count, FIRST_PAGE_TRACKS, &pending);
+            if (pending) {
+                // the stream takes over the result
+                stream_result = result;
+                result.tracks = NULL;
+                result.count = 0;
+                stream_plt = plt_to;
+                deadbeef->plt_ref (stream_plt);
+                stream_source = g_idle_add (stream_batch, NULL);
+            }
+        }
+        free_track_list (&result);
+        qs_stats_since (QS_STAT_COPY, start);
+        qs_trace_complete ("copy result", start, NULL, "tracks", copied);
+
         if (config_append_search_string && config_search_in != SEARCH_INLINE) {
             const gchar *text = gtk_entry_get_text (GTK_ENTRY (searchentry));
+            start = qs_stats_now ();
             append_search_string_to_plt_title (plt_to, text);
+            qs_stats_since (QS_STAT_TITLE, start);
+            qs_trace_complete ("set title", start, text, NULL, 0);
+            changes++;
         }
 
         deadbeef->plt_unref (plt_to);
     }
     deadbeef->pl_unlock ();
 
-#if (DDB_API_LEVEL >= 8)
-    deadbeef->sendmessage (DB_EV_PLAYLISTCHANGED, 0, DDB_PLAYLIST_CHANGE_CONTENT, 0);
-#else
-    deadbeef->sendmessage (DB_EV_PLAYLISTCHANGED, 0, 0, 0);
-#endif
+    // sent once the search result is complete
+    if (changes) {
+        qs_notify_add (QS_CHANGE_CONTENT);
+    }
 }
 
-static void
-on_searchentry_activate                (GtkEntry        *entry,
-                                        gpointer         user_data)
+// returns the position of the first selected track at or after from, or at
+// or before it if backward is set, or -1. Only needed when the index doesn't
+// have the result of the search.
+static int
+find_selected (ddb_playlist_t *plt, int from, int backward)
 {
+    DB_playItem_t *it = deadbeef->plt_get_item_for_idx (plt, from, PL_MAIN);
+    while (it) {
+        if (deadbeef->pl_is_selected (it)) {
+            deadbeef->pl_item_unref (it);
+            return from;
+        }
+        DB_playItem_t *next = backward ? deadbeef->pl_get_prev (it, PL_MAIN) : deadbeef->pl_get_next (it, PL_MAIN);
+        deadbeef->pl_item_unref (it);
+        it = next;
+        from += backward ? -1 : 1;
+    }
+    return -1;
+}
+
+static int64_t
+find_hit (ddb_playlist_t *plt, int from, int backward)
+{
+    int64_t pos = qs_index_find_hit (plt, from, backward);
+    return pos == -2 ? find_selected (plt, from, backward) : pos;
+}
+
+// moves the cursor of the last active playlist to the first hit of the
+// search if dir is 0, otherwise to the next (dir > 0) or previous hit from
+// the cursor, wrapping around at the ends. Returns the position, -1 if
+// there's no hit or -2 if there's no playlist to look in.
+static int64_t
+jump_to_hit (int dir)
+{
+    int64_t pos = -2;
     deadbeef->pl_lock ();
     ddb_playlist_t *plt = get_last_active_playlist ();
-    if (plt) {
-        DB_playItem_t *it = deadbeef->plt_get_first (plt, PL_MAIN);
-        while (it) {
-            if (deadbeef->pl_is_selected (it)) {
-                break;
+    int count = plt ? deadbeef->plt_get_item_count (plt, PL_MAIN) : 0;
+    if (count > 0) {
+        pos = -1;
+        int cursor = dir ? deadbeef->plt_get_cursor (plt, PL_MAIN) : -1;
+        if (dir >= 0) {
+            pos = find_hit (plt, cursor + 1, 0);
+            if (pos < 0 && cursor >= 0) {
+                pos = find_hit (plt, 0, 0);
             }
-            DB_playItem_t *next = deadbeef->pl_get_next (it, PL_MAIN);
-            deadbeef->pl_item_unref (it);
-            it = next;
-            if (!it) {
-                deadbeef->sendmessage (DB_EV_PLAY_NUM, 0, 0, 0);
+        }
+        else {
+            pos = cursor > 0 ? find_hit (plt, cursor - 1, 1) : -1;
+            if (pos < 0) {
+                pos = find_hit (plt, count - 1, 1);
             }
         }
+    }
+    if (pos >= 0) {
+        deadbeef->plt_set_cursor (plt, PL_MAIN, pos);
+#if (DDB_API_LEVEL >= 8)
+        DB_playItem_t *it = deadbeef->plt_get_item_for_idx (plt, pos, PL_MAIN);
         if (it) {
-            deadbeef->pl_item_unref (it);
+            // lets the playlist widgets scroll to the cursor, the event
+            // takes over the reference
+            ddb_event_track_t *ev = (ddb_event_track_t *)deadbeef->event_alloc (DB_EV_CURSOR_MOVED);
+            ev->track = it;
+            deadbeef->event_send ((ddb_event_t *)ev, PL_MAIN, 0);
         }
+#endif
+    }
+    if (plt) {
         deadbeef->plt_unref (plt);
     }
     deadbeef->pl_unlock ();
+    return pos;
+}
+
+static void
+on_searchentry_activate                (GtkEntry        *entry,
+                                        gpointer         user_data)
+{
+    // the result of the search knows its first hit, the playlist only has
+    // to be walked if the index doesn't have it
+    if (jump_to_hit (0) == -1) {
+        deadbeef->sendmessage (DB_EV_PLAY_NUM, 0, 0, 0);
+    }
 }
 
 static void
@@ -531,7 +806,7 @@ searchentry_perform_autosearch ()
     switch (config_search_in) {
 #if (DDB_API_LEVEL >= 8)
         case SEARCH_INLINE:
-            deadbeef->sendmessage (DB_EV_FOCUS_SELECTION, 0, PL_MAIN, 0);
+            qs_notify_add (QS_CHANGE_FOCUS);
             break;
 #endif
         case SEARCH_PLAYLIST:
@@ -557,11 +832,8 @@ on_searchentry_key_press_event           (GtkWidget       *widget,
         if (!config_autosearch) {
             GtkEntry *entry = GTK_ENTRY (widget);
             const gchar *text = gtk_entry_get_text (entry);
-            if (search_delay_timer) {
-                g_source_remove (search_delay_timer);
-                search_delay_timer = 0;
-            }
-            search_delay_timer = g_timeout_add (100, search_process, (void *)text);
+            // explicitly asked for, no need to wait for further input
+            search_process ((void *)text);
         }
         else {
             on_searchentry_activate (NULL, 0);
@@ -573,18 +845,109 @@ on_searchentry_key_press_event           (GtkWidget       *widget,
         }
         return TRUE;
     }
+#if GTK_CHECK_VERSION(3,0,0)
+    if (event->keyval == GDK_KEY_F3) {
+#else
+    if (event->keyval == GDK_F3) {
+#endif
+        jump_to_hit (event->state & GDK_SHIFT_MASK ? -1 : 1);
+        return TRUE;
+    }
     return FALSE;
 }
 
 static void
 update_list ()
 {
-#if (DDB_API_LEVEL >= 8)
-    deadbeef->sendmessage (DB_EV_PLAYLISTCHANGED, 0, DDB_PLAYLIST_CHANGE_SELECTION, 0);
-    deadbeef->sendmessage (DB_EV_PLAYLISTCHANGED, 0, DDB_PLAYLIST_CHANGE_SEARCHRESULT, 0);
-#else
-    deadbeef->sendmessage (DB_EV_PLAYLISTCHANGED, 0, 0, 0);
-#endif
+    qs_notify_add (QS_CHANGE_SELECTION | QS_CHANGE_SEARCHRESULT);
+}
+
+static int search_generation = 0;
+static char *search_text = NULL;
+// start time and scope of the search in flight, 0 if there is none
+static gint64 search_started = 0;
+static int search_scope = SEARCH_INLINE;
+// whether the latest search runs on the main loop instead of the worker
+static int search_idle = FALSE;
+static gint64 stats_written = 0;
+
+static void
+publish_result (void)
+{
+    int64_t published = qs_stats_now ();
+    update_list ();
+    searchentry_perform_autosearch ();
+    if (config_autosearch && search_text && !strcmp (search_text, "")){
+        deadbeef->pl_lock ();
+        ddb_playlist_t *plt = get_last_active_playlist ();
+        if (plt) {
+            // the deletion message might still be queued
+            if (deadbeef->plt_get_idx (plt) >= 0) {
+                deadbeef->plt_set_curr (plt);
+            }
+            deadbeef->plt_unref (plt);
+        }
+        deadbeef->pl_unlock ();
+    }
+    gint64 started = search_started;
+    if (search_started) {
+        qs_delay_record (search_scope, g_get_monotonic_time () - search_started);
+        search_started = 0;
+    }
+    int64_t start = qs_stats_now ();
+    qs_notify_flush ();
+    qs_stats_since (QS_STAT_NOTIFY, start);
+    qs_trace_complete ("send events", start, NULL, "events", qs_notify_count ());
+    trace ("quick_search: search sent %d redraw events\n", qs_notify_count ());
+    if (start) {
+        gint64 now = g_get_monotonic_time ();
+        if (started) {
+            qs_stats_record (QS_STAT_TOTAL, now - started);
+        }
+        qs_stats_record (QS_STAT_EVENTS, qs_notify_count ());
+        if (qs_stats_enabled () && now - stats_written >= STATS_WRITE_USEC) {
+            qs_stats_set (QS_GAUGE_INDEX_MEMORY, qs_index_memory ());
+            qs_stats_write (get_cache_file_path ("stats"));
+            stats_written = now;
+        }
+    }
+    qs_trace_complete ("publish result", published, search_text, NULL, 0);
+}
+
+// runs on the main loop once the worker finished the latest search
+static gboolean
+search_finished (gpointer userdata)
+{
+    int generation = GPOINTER_TO_INT (userdata);
+    if (!search_idle && generation == search_generation && qs_worker_is_current (generation)) {
+        publish_result ();
+    }
+    return FALSE;
+}
+
+static void
+search_done (int generation, void *user_data)
+{
+    g_idle_add (search_finished, GINT_TO_POINTER (generation));
+}
+
+// shows the matches of an idle search as they come in
+static void
+idle_search_progress (int generation, int done, void *user_data)
+{
+    if (!search_idle || generation != search_generation) {
+        return;
+    }
+    if (done) {
+        publish_result ();
+    }
+    else {
+        update_list ();
+        int64_t start = qs_stats_now ();
+        qs_notify_flush ();
+        qs_stats_since (QS_STAT_NOTIFY, start);
+        qs_trace_complete ("send events", start, NULL, "events", qs_notify_count ());
+    }
 }
 
 static gboolean
@@ -595,7 +958,13 @@ search_process (gpointer userdata) {
     }
     g_return_val_if_fail (userdata != NULL, FALSE);
 
+    // a search in flight may hold pl_lock until it notices that it is stale
+    qs_worker_cancel ();
+
+    int64_t start = qs_stats_now ();
     const char *text = userdata;
+    ddb_playlist_t **plts = NULL;
+    int plt_count = 0;
     deadbeef->pl_lock ();
     if (config_search_in != SEARCH_ALL_PLAYLISTS) {
         ddb_playlist_t *plt = deadbeef->plt_get_curr ();
@@ -608,8 +977,13 @@ search_process (gpointer userdata) {
                 set_last_active_playlist (plt);
             }
             if (plt) {
-                deadbeef->plt_search_process (plt, text);
-                deadbeef->plt_unref (plt);
+                plts = malloc (sizeof (ddb_playlist_t *));
+                if (plts) {
+                    plts[plt_count++] = plt;
+                }
+                else {
+                    deadbeef->plt_unref (plt);
+                }
             }
         }
     }
@@ -619,34 +993,58 @@ search_process (gpointer userdata) {
             set_last_active_playlist (plt_curr);
             deadbeef->plt_unref (plt_curr);
         }
-        int plt_count = deadbeef->plt_get_count ();
-        for (int i = 0; i < plt_count; i++) {
+        int count = deadbeef->plt_get_count ();
+        plts = malloc ((count > 0 ? count : 1) * sizeof (ddb_playlist_t *));
+        for (int i = 0; plts && i < count; i++) {
             ddb_playlist_t *plt = deadbeef->plt_get_for_idx (i);
             if (!plt) {
                 continue;
             }
             if (!is_quick_search_playlist (plt)) {
-                deadbeef->plt_deselect_all (plt);
-                deadbeef->plt_search_process (plt, text);
+                plts[plt_count++] = plt;
+            }
+            else {
+                deadbeef->plt_unref (plt);
             }
-            deadbeef->plt_unref (plt);
         }
     }
     deadbeef->pl_unlock ();
 
-    update_list ();
-    searchentry_perform_autosearch ();
-    if (config_autosearch && !strcmp (text, "")){
-        ddb_playlist_t *plt = get_last_active_playlist ();
-        if (plt) {
-            deadbeef->plt_set_curr (plt);
-            deadbeef->plt_unref (plt);
-        }
+    // the matching runs on the search worker, search_finished picks up the
+    // result unless the text changed in the meantime
+    gint64 now = g_get_monotonic_time ();
+    if (search_started) {
+        // the search in flight gets cancelled, it took at least that long
+        qs_delay_record (search_scope, now - search_started);
+    }
+    // clearing the text is cheap whatever the scope, it tells nothing
+    search_started = strcmp (text, "") ? now : 0;
+    search_scope = config_search_in;
+
+    free (search_text);
+    search_text = strdup (text);
+    qs_notify_begin ();
+    // only one kind of search may change the selection at a time
+    search_idle = config_idle_search;
+    if (search_idle) {
+        search_generation = qs_idle_submit (text, plts, plt_count, idle_search_progress, NULL);
+    }
+    else {
+        qs_idle_cancel ();
+        search_generation = qs_worker_submit (text, plts, plt_count);
     }
+    qs_trace_complete ("search_process", start, text, "playlists", plt_count);
 
     return FALSE;
 }
 
+static gboolean
+search_delay_fired (gpointer userdata)
+{
+    qs_trace_instant ("delay timer", userdata, NULL, 0);
+    return search_process (userdata);
+}
+
 static void
 on_searchentry_changed                 (GtkEditable     *editable,
                                         gpointer         user_data)
@@ -658,7 +1056,15 @@ on_searchentry_changed                 (GtkEditable     *editable,
             g_source_remove (search_delay_timer);
             search_delay_timer = 0;
         }
-        search_delay_timer = g_timeout_add (100, search_process, (void *)text);
+        // the delay depends on how long recent searches in this scope took
+        int delay = qs_delay_get (config_search_in);
+        qs_trace_instant ("keystroke", text, "delay", delay);
+        if (delay > 0) {
+            search_delay_timer = g_timeout_add (delay, search_delay_fired, (void *)text);
+        }
+        else {
+            search_process ((void *)text);
+        }
     }
 }
 
@@ -699,6 +1105,32 @@ quick_search_on_action (DB_plugin_action_t *action, int ctx)
     return 0;
 }
 
+static int
+#if (DDB_API_LEVEL >= 11)
+quick_search_on_next_hit (DB_plugin_action_t *action, ddb_action_context_t ctx)
+#else
+quick_search_on_next_hit (DB_plugin_action_t *action, int ctx)
+#endif
+{
+    if (initialized) {
+        jump_to_hit (1);
+    }
+    return 0;
+}
+
+static int
+#if (DDB_API_LEVEL >= 11)
+quick_search_on_prev_hit (DB_plugin_action_t *action, ddb_action_context_t ctx)
+#else
+quick_search_on_prev_hit (DB_plugin_action_t *action, int ctx)
+#endif
+{
+    if (initialized) {
+        jump_to_hit (-1);
+    }
+    return 0;
+}
+
 static void
 quick_search_set_placeholder_text ()
 {
@@ -853,33 +1285,106 @@ quick_search_message (ddb_gtkui_widget_t *widget, uint32_t id, uintptr_t ctx, ui
             config_search_in = deadbeef->conf_get_int (CONFSTR_SEARCH_IN, FALSE);
             config_autosearch = deadbeef->conf_get_int (CONFSTR_AUTOSEARCH, TRUE);
             config_append_search_string = deadbeef->conf_get_int (CONFSTR_APPEND_SEARCH_STRING, FALSE);
+            config_idle_search = deadbeef->conf_get_int (CONFSTR_IDLE_SEARCH, FALSE);
+            qs_stats_enable (deadbeef->conf_get_int (CONFSTR_SEARCH_STATS, FALSE));
+            update_tracing ();
+            qs_worker_set_threads (deadbeef->conf_get_int (CONFSTR_SEARCH_THREADS, 0));
+            qs_worker_set_snapshot (deadbeef->conf_get_int (CONFSTR_SNAPSHOT_SEARCH, TRUE));
 
             if ((!config_append_search_string) && (config_search_in != SEARCH_INLINE)) {
                 set_default_quick_search_playlist_title ();
             }
             break;
+        case DB_EV_PLAYLISTCHANGED:
+#if (DDB_API_LEVEL >= 8)
+            if (p1 == DDB_PLAYLIST_CHANGE_DELETED) {
+                playlist_deleted ();
+                qs_index_prune ();
+                qs_cache_prune ();
+            }
+            else if (p1 == DDB_PLAYLIST_CHANGE_CONTENT) {
+                // keeps the next search from paying for the changes
+                qs_index_update ();
+            }
+#else
+            playlist_deleted ();
+            qs_index_prune ();
+            qs_cache_prune ();
+            qs_index_update ();
+#endif
+            break;
+        case DB_EV_TRACKINFOCHANGED:
+            // the index notices content changes through the modification
+            // index of the playlist, but not metadata updates
+            {
+                ddb_event_track_t *ev = (ddb_event_track_t *)ctx;
+                if (ev && ev->track) {
+                    qs_index_update_track (ev->track);
+                }
+                else {
+                    qs_index_invalidate (NULL);
+                }
+            }
+            qs_cache_invalidate (NULL);
+            break;
     }
     return 0;
 }
 
 
 #if GTK_CHECK_VERSION(3,0,0)
+static DB_plugin_action_t
+quick_search_prev_hit_action_gtk3 = {
+    .title = "Quick search: previous hit (GTK3)",
+    .name = "quick_search_prev_hit_gtk3",
+    .flags = DB_ACTION_COMMON,
+    .callback2 = quick_search_on_prev_hit,
+    .next = NULL
+};
+
+static DB_plugin_action_t
+quick_search_next_hit_action_gtk3 = {
+    .title = "Quick search: next hit (GTK3)",
+    .name = "quick_search_next_hit_gtk3",
+    .flags = DB_ACTION_COMMON,
+    .callback2 = quick_search_on_next_hit,
+    .next = &quick_search_prev_hit_action_gtk3
+};
+
 static DB_plugin_action_t
 quick_search_action_gtk3 = {
     .title = "Quick search (GTK3)",
     .name = "quick_search_gtk3",
     .flags = DB_ACTION_COMMON,
     .callback2 = quick_search_on_action,
-    .next = NULL
+    .next = &quick_search_next_hit_action_gtk3
 };
 #else
+static DB_plugin_action_t
+quick_search_prev_hit_action = {
+    .title = "Quick search: previous hit",
+    .name = "quick_search_prev_hit",
+    .flags = DB_ACTION_COMMON,
+    .callback2 = quick_search_on_prev_hit,
+    .next = NULL
+};
+
+static DB_plugin_action_t
+quick_search_next_hit_action = {
+    .title = "Quick search: next hit",
+    .name = "quick_search_next_hit",
+    .flags = DB_ACTION_COMMON,
+    .callback2 = quick_search_on_next_hit,
+    .next = &quick_search_prev_hit_action
+};
+
 static DB_plugin_action_t
 quick_search_action = {
     .title = "Quick search",
     .name = "quick_search",
     .flags = DB_ACTION_COMMON,
     .callback2 = quick_search_on_action,
-    .next = NULL
+    .next = &quick_search_next_hit_action
 };
 #endif
 
@@ -898,6 +1403,9 @@ quick_search_init (ddb_gtkui_widget_t *ww) {
     w_quick_search_t *w = (w_quick_search_t *)ww;
 
     cache_path_size = make_cache_dir (cache_path, sizeof (cache_path));
+    if (get_cache_file_path ("index")) {
+        qs_index_load (get_cache_file_path ("index"));
+    }
 
 #if GTK_CHECK_VERSION(3,2,0)
     GtkWidget *hbox = gtk_box_new (GTK_ORIENTATION_VERTICAL, 3);
@@ -952,6 +1460,9 @@ quick_search_init (ddb_gtkui_widget_t *ww) {
     config_search_in = deadbeef->conf_get_int (CONFSTR_SEARCH_IN, FALSE);
     config_autosearch = deadbeef->conf_get_int (CONFSTR_AUTOSEARCH, TRUE);
     config_append_search_string = deadbeef->conf_get_int (CONFSTR_APPEND_SEARCH_STRING, FALSE);
+    config_idle_search = deadbeef->conf_get_int (CONFSTR_IDLE_SEARCH, FALSE);
+    qs_stats_enable (deadbeef->conf_get_int (CONFSTR_SEARCH_STATS, FALSE));
+    update_tracing ();
     quick_search_set_placeholder_text ();
     quick_search_create_popup_menu (w);
     load_history_entries (w);
@@ -962,10 +1473,12 @@ quick_search_init (ddb_gtkui_widget_t *ww) {
 static void
 quick_search_destroy (ddb_gtkui_widget_t *w) {
     w_quick_search_t *ww = (w_quick_search_t *)w;
+    deadbeef->pl_lock ();
     if (last_active_plt) {
         deadbeef->plt_unref (last_active_plt);
         last_active_plt = NULL;
     }
+    deadbeef->pl_unlock ();
     if (ww->prev_query) {
         free (ww->prev_query);
         ww->prev_query = NULL;
@@ -974,15 +1487,24 @@ quick_search_destroy (ddb_gtkui_widget_t *w) {
         g_source_remove (search_delay_timer);
         search_delay_timer = 0;
     }
+    if (search_text) {
+        free (search_text);
+        search_text = NULL;
+    }
 }
 
 static void
 quick_search_cleanup () {
     deadbeef->pl_lock();
-    int plt_idx = get_quick_search_playlist ();
-    if (plt_idx >= 0) {
-        deadbeef->plt_remove(plt_idx);
+    ddb_playlist_t *plt = get_quick_search_playlist ();
+    if (plt) {
+        int plt_idx = deadbeef->plt_get_idx (plt);
+        if (plt_idx >= 0) {
+            deadbeef->plt_remove(plt_idx);
+        }
+        deadbeef->plt_unref (plt);
     }
+    forget_quick_search_playlist ();
     deadbeef->pl_unlock();
 }
 
@@ -1017,6 +1539,9 @@ quick_search_connect (void)
             //printf ("fb api2\n");
             // 0.6+, use the new widget API
             gtkui_plugin->w_reg_widget ("Quick search", DDB_WF_SINGLE_INSTANCE, w_quick_search_create, "quick_search", NULL);
+            qs_worker_set_threads (deadbeef->conf_get_int (CONFSTR_SEARCH_THREADS, 0));
+            qs_worker_set_snapshot (deadbeef->conf_get_int (CONFSTR_SNAPSHOT_SEARCH, TRUE));
+            qs_worker_start (search_done, NULL);
             return 0;
         }
     }
@@ -1026,11 +1551,33 @@ quick_search_connect (void)
 static const char settings_dlg[] =
     "property \"Append search string to playlist name \" checkbox " CONFSTR_APPEND_SEARCH_STRING " 0 ;\n"
     "property \"History size: \" spinbtn[0,20,1] " CONFSTR_HISTORY_SIZE " 10 ;\n"
+    "property \"Search threads (0 = one per CPU core): \" spinbtn[0,64,1] " CONFSTR_SEARCH_THREADS " 0 ;\n"
+    "property \"Search on the main loop instead of a thread \" checkbox " CONFSTR_IDLE_SEARCH " 0 ;\n"
+    "property \"Release the playlist lock while matching \" checkbox " CONFSTR_SNAPSHOT_SEARCH " 1 ;\n"
+    "property \"Write search timings to the cache directory \" checkbox " CONFSTR_SEARCH_STATS " 0 ;\n"
+    "property \"Write a trace of the searches to the cache directory \" checkbox " CONFSTR_SEARCH_TRACE " 0 ;\n"
 ;
 
 static int
 quick_search_disconnect (void)
 {
+    qs_worker_stop ();
+    qs_idle_cancel ();
+    stream_stop ();
+    qs_sync_reset ();
+    qs_delay_reset ();
+    if (get_cache_file_path ("index")) {
+        qs_index_save (get_cache_file_path ("index"));
+    }
+    if (qs_stats_enabled ()) {
+        qs_stats_set (QS_GAUGE_INDEX_MEMORY, qs_index_memory ());
+        qs_stats_write (get_cache_file_path ("stats"));
+    }
+    qs_stats_free ();
+    qs_trace_free ();
+    config_search_trace = FALSE;
+    qs_index_free ();
+    qs_cache_free ();
     quick_search_cleanup();
     gtkui_plugin = NULL;
     return 0;
@@ -1078,12 +1625,14 @@ static DB_misc_t plugin = {
 DB_plugin_t *
 ddb_misc_quick_search_GTK2_load (DB_functions_t *ddb) {
     deadbeef = ddb;
+    qs_match_init ();
     return &plugin.plugin;
 }
 #else
 DB_plugin_t *
 ddb_misc_quick_search_GTK3_load (DB_functions_t *ddb) {
     deadbeef = ddb;
+    qs_match_init ();
     return &plugin.plugin;
 }
 #endif
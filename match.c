@@ -0,0 +1,302 @@
+/*
+    Quick Search Plugin for DeaDBeeF audio player
+    Copyright (C) 2014 Christian Boxdörfer <christian.boxdoerfer@posteo.de>
+
+    This program is free software; you can redistribute it and/or
+    modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation; either version 2
+    of the License, or (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+*/
+
+#include <string.h>
+
+#include "match.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define QS_MATCH_X86 1
+#include <immintrin.h>
+#endif
+
+typedef int (*qs_find_fn) (const char *hay, int len, const char *needle, int needle_len);
+
+static inline int
+lower_ascii (unsigned char c)
+{
+    return (c >= 'A' && c <= 'Z') ? c + 0x20 : c;
+}
+
+// compares hay with the needle, ignoring the case of ascii letters in hay
+static inline int
+equal_ci (const char *hay, const char *needle, int len)
+{
+    for (int i = 0; i < len; i++) {
+        if (lower_ascii (hay[i]) != (unsigned char)needle[i]) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+// checks the bytes between the first and the last one, which are known to
+// match already
+static inline int
+verify (const char *hay, const char *needle, int needle_len)
+{
+    return equal_ci (hay + 1, needle + 1, needle_len > 2 ? needle_len - 2 : 0);
+}
+
+static int
+find_scalar (const char *hay, int len, const char *needle, int needle_len)
+{
+    unsigned char first = needle[0];
+    unsigned char last = needle[needle_len - 1];
+    for (int i = 0; i + needle_len <= len; i++) {
+        if (lower_ascii (hay[i]) == first && lower_ascii (hay[i + needle_len - 1]) == last
+                && verify (hay + i, needle, needle_len)) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+#ifdef QS_MATCH_X86
+// or-ing a byte with the case bit of a lower case letter maps both cases of
+// that letter to the lower case one, other bytes are compared as they are
+static inline char
+case_bit (char c)
+{
+    return (c >= 'a' && c <= 'z') ? 0x20 : 0;
+}
+
+// the short values left over by the vector loops are copied into a zero
+// padded buffer (a zero byte never matches the needle), so that the vector
+// loads don't read past their end
+#define TAIL_SIZE 128
+
+// compares the first and the last byte of the needle with 16 positions at
+// once, the remaining bytes are only checked where both match. Returns 1 on
+// a match, otherwise -(i + 1) with i being the first position not looked at
+// yet, or 0 if padded is set and hay is readable up to len + 15 bytes.
+__attribute__((target("sse2")))
+static int
+scan_sse2 (const char *hay, int len, const char *needle, int needle_len, int padded)
+{
+    const __m128i first = _mm_set1_epi8 (needle[0]);
+    const __m128i first_case = _mm_set1_epi8 (case_bit (needle[0]));
+    const __m128i last = _mm_set1_epi8 (needle[needle_len - 1]);
+    const __m128i last_case = _mm_set1_epi8 (case_bit (needle[needle_len - 1]));
+    int end = padded ? len - needle_len + 1 : len - needle_len - 15 + 1;
+    int i = 0;
+    for (; i < end; i += 16) {
+        __m128i a = _mm_or_si128 (_mm_loadu_si128 ((const __m128i *)(hay + i)), first_case);
+        __m128i b = _mm_or_si128 (_mm_loadu_si128 ((const __m128i *)(hay + i + needle_len - 1)), last_case);
+        unsigned mask = _mm_movemask_epi8 (_mm_and_si128 (_mm_cmpeq_epi8 (a, first), _mm_cmpeq_epi8 (b, last)));
+        while (mask) {
+            int bit = __builtin_ctz (mask);
+            if (verify (hay + i + bit, needle, needle_len)) {
+                return 1;
+            }
+            mask &= mask - 1;
+        }
+    }
+    return padded ? 0 : -i - 1;
+}
+
+// runs scan on hay and then on a padded copy of what's left over, or the
+// scalar loop if that doesn't fit into the buffer
+#define FIND_WITH_TAIL(scan, hay, len, needle, needle_len, width) \
+    do { \
+        int r = scan (hay, len, needle, needle_len, 0); \
+        if (r >= 0) { \
+            return r; \
+        } \
+        int done = -r - 1; \
+        int rest = len - done; \
+        if (rest < needle_len) { \
+            return 0; \
+        } \
+        if (rest + width > TAIL_SIZE) { \
+            return find_scalar (hay + done, rest, needle, needle_len); \
+        } \
+        char tail[TAIL_SIZE]; \
+        memcpy (tail, hay + done, rest); \
+        memset (tail + rest, 0, width); \
+        return scan (tail, rest, needle, needle_len, 1); \
+    } while (0)
+
+__attribute__((target("sse2")))
+static int
+find_sse2 (const char *hay, int len, const char *needle, int needle_len)
+{
+    FIND_WITH_TAIL (scan_sse2, hay, len, needle, needle_len, 16);
+}
+
+__attribute__((target("avx2")))
+static int
+scan_avx2 (const char *hay, int len, const char *needle, int needle_len)
+{
+    const __m256i first = _mm256_set1_epi8 (needle[0]);
+    const __m256i first_case = _mm256_set1_epi8 (case_bit (needle[0]));
+    const __m256i last = _mm256_set1_epi8 (needle[needle_len - 1]);
+    const __m256i last_case = _mm256_set1_epi8 (case_bit (needle[needle_len - 1]));
+    int end = len - needle_len - 31 + 1;
+    int i = 0;
+    for (; i < end; i += 32) {
+        __m256i a = _mm256_or_si256 (_mm256_loadu_si256 ((const __m256i *)(hay + i)), first_case);
+        __m256i b = _mm256_or_si256 (_mm256_loadu_si256 ((const __m256i *)(hay + i + needle_len - 1)), last_case);
+        unsigned mask = (unsigned)_mm256_movemask_epi8 (_mm256_and_si256 (_mm256_cmpeq_epi8 (a, first), _mm256_cmpeq_epi8 (b, last)));
+        while (mask) {
+            int bit = __builtin_ctz (mask);
+            if (verify (hay + i + bit, needle, needle_len)) {
+                return 1;
+            }
+            mask &= mask - 1;
+        }
+    }
+    return -i - 1;
+}
+
+__attribute__((target("avx2")))
+static int
+find_avx2 (const char *hay, int len, const char *needle, int needle_len)
+{
+    int r = scan_avx2 (hay, len, needle, needle_len);
+    if (r >= 0) {
+        return r;
+    }
+    // the rest is shorter than 32 bytes plus the needle. Handing it to the
+    // sse2 code (which isn't vex encoded) costs more than it saves because of
+    // the switch between avx and sse state.
+    int done = -r - 1;
+    return find_scalar (hay + done, len - done, needle, needle_len);
+}
+
+// lower cases the ascii letters of 16 bytes
+__attribute__((target("sse4.2")))
+static inline __m128i
+lower16 (__m128i v)
+{
+    __m128i upper = _mm_and_si128 (_mm_cmpgt_epi8 (v, _mm_set1_epi8 ('A' - 1)),
+            _mm_cmplt_epi8 (v, _mm_set1_epi8 ('Z' + 1)));
+    return _mm_or_si128 (v, _mm_and_si128 (upper, _mm_set1_epi8 (0x20)));
+}
+
+// lets pcmpestri find the first position in each block where the (first 16
+// bytes of the) needle start, including partial matches at the block end
+__attribute__((target("sse4.2")))
+static int
+scan_sse42 (const char *hay, int len, const char *needle, int needle_len, int padded)
+{
+    char pattern[16] = { 0 };
+    int pattern_len = needle_len < 16 ? needle_len : 16;
+    memcpy (pattern, needle, pattern_len);
+    const __m128i pat = _mm_loadu_si128 ((const __m128i *)pattern);
+    int end = padded ? len - needle_len + 1 : len - 15;
+    int i = 0;
+    while (i < end) {
+        __m128i block = lower16 (_mm_loadu_si128 ((const __m128i *)(hay + i)));
+        int idx = _mm_cmpestri (pat, pattern_len, block, 16, _SIDD_UBYTE_OPS | _SIDD_CMP_EQUAL_ORDERED);
+        if (idx == 16) {
+            i += 16;
+            continue;
+        }
+        if (i + idx + needle_len <= len && lower_ascii (hay[i + idx + needle_len - 1]) == (unsigned char)needle[needle_len - 1]
+                && verify (hay + i + idx, needle, needle_len)) {
+            return 1;
+        }
+        i += idx + 1;
+    }
+    return padded ? 0 : -i - 1;
+}
+
+__attribute__((target("sse4.2")))
+static int
+find_sse42 (const char *hay, int len, const char *needle, int needle_len)
+{
+    FIND_WITH_TAIL (scan_sse42, hay, len, needle, needle_len, 16);
+}
+#endif
+
+typedef struct {
+    const char *name;
+    qs_find_fn find;
+} qs_match_impl_t;
+
+static const qs_match_impl_t impls[] = {
+    { "scalar", find_scalar },
+#ifdef QS_MATCH_X86
+    { "sse2", find_sse2 },
+    { "sse4.2", find_sse42 },
+    { "avx2", find_avx2 },
+#endif
+};
+
+static const qs_match_impl_t *impl = &impls[0];
+
+static int
+impl_supported (const qs_match_impl_t *i)
+{
+#ifdef QS_MATCH_X86
+    __builtin_cpu_init ();
+    if (i->find == find_sse2) {
+        return __builtin_cpu_supports ("sse2");
+    }
+    if (i->find == find_sse42) {
+        return __builtin_cpu_supports ("sse4.2");
+    }
+    if (i->find == find_avx2) {
+        return __builtin_cpu_supports ("avx2");
+    }
+#endif
+    return 1;
+}
+
+void
+qs_match_init (void)
+{
+    // the table is ordered from slowest to fastest
+    for (int i = 0; i < (int)(sizeof (impls) / sizeof (impls[0])); i++) {
+        if (impl_supported (&impls[i])) {
+            impl = &impls[i];
+        }
+    }
+}
+
+const char *
+qs_match_impl (void)
+{
+    return impl->name;
+}
+
+int
+qs_match_set_impl (const char *name)
+{
+    for (int i = 0; i < (int)(sizeof (impls) / sizeof (impls[0])); i++) {
+        if (!strcmp (impls[i].name, name) && impl_supported (&impls[i])) {
+            impl = &impls[i];
+            return 0;
+        }
+    }
+    return -1;
+}
+
+int
+qs_match (const char *hay, int len, const char *needle, int needle_len)
+{
+    if (needle_len <= 0) {
+        return 1;
+    }
+    if (needle_len > len) {
+        return 0;
+    }
+    return impl->find (hay, len, needle, needle_len);
+}
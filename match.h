@@ -0,0 +1,47 @@
+/*
+    Quick Search Plugin for DeaDBeeF audio player
+    Copyright (C) 2014 Christian Boxdörfer <christian.boxdoerfer@posteo.de>
+
+    This program is free software; you can redistribute it and/or
+    modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation; either version 2
+    of the License, or (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+*/
+
+#ifndef __QS_MATCH_H
+#define __QS_MATCH_H
+
+// Case insensitive substring matching of metadata values. On x86 the
+// haystack is compared 16 or 32 bytes at a time (SSE2, SSE4.2 or AVX2,
+// whatever the cpu supports), elsewhere a scalar loop is used.
+
+// picks the fastest implementation supported by the cpu, called once when
+// the plugin gets loaded
+void
+qs_match_init (void);
+
+// returns whether the folded needle (see qs_fold) occurs in the first len
+// bytes of hay. Only ascii letters are compared case insensitively, so hay
+// has to be folded as well unless it's plain ascii.
+int
+qs_match (const char *hay, int len, const char *needle, int needle_len);
+
+// returns the name of the implementation in use
+const char *
+qs_match_impl (void);
+
+// switches to the named implementation ("scalar", "sse2", "sse4.2" or
+// "avx2"), returns -1 if it isn't available on this cpu
+int
+qs_match_set_impl (const char *name);
+
+#endif
@@ -0,0 +1,321 @@
+/*
+    Quick Search Plugin for DeaDBeeF audio player
+    Copyright (C) 2014 Christian Boxdörfer <christian.boxdoerfer@posteo.de>
+
+    This program is free software; you can redistribute it and/or
+    modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation; either version 2
+    of the License, or (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+*/
+
+#include <ctype.h>
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
+#include "query.h"
+#include "fold.h"
+
+typedef struct {
+    const char *name;
+    const char * const *keys;
+} qs_field_alias_t;
+
+static const char * const artist_keys[] = { "artist", NULL };
+static const char * const album_artist_keys[] = { "album artist", "albumartist", "band", NULL };
+static const char * const album_keys[] = { "album", NULL };
+static const char * const title_keys[] = { "title", NULL };
+static const char * const genre_keys[] = { "genre", NULL };
+static const char * const year_keys[] = { "year", "date", "original_release_year", NULL };
+static const char * const comment_keys[] = { "comment", NULL };
+static const char * const composer_keys[] = { "composer", NULL };
+static const char * const performer_keys[] = { "performer", NULL };
+static const char * const track_keys[] = { "track", "tracknumber", NULL };
+static const char * const disc_keys[] = { "disc", "discnumber", NULL };
+
+static const qs_field_alias_t field_aliases[] = {
+    { "artist", artist_keys },
+    { "albumartist", album_artist_keys },
+    { "album_artist", album_artist_keys },
+    { "band", album_artist_keys },
+    { "album", album_keys },
+    { "title", title_keys },
+    { "genre", genre_keys },
+    { "year", year_keys },
+    { "date", year_keys },
+    { "comment", comment_keys },
+    { "composer", composer_keys },
+    { "performer", performer_keys },
+    { "track", track_keys },
+    { "tracknumber", track_keys },
+    { "disc", disc_keys },
+    { "discnumber", disc_keys },
+};
+
+// returns the keys of the field named by the len bytes at name
+static const char * const *
+find_field (const char *name, int len)
+{
+    for (int i = 0; i < (int)(sizeof (field_aliases) / sizeof (field_aliases[0])); i++) {
+        if ((int)strlen (field_aliases[i].name) == len && !strncasecmp (field_aliases[i].name, name, len)) {
+            return field_aliases[i].keys;
+        }
+    }
+    return NULL;
+}
+
+// returns the length of a field prefix (name and colon) at s, or 0
+static int
+field_prefix (const char *s, const char * const **keys)
+{
+    int len = 0;
+    while (isalpha ((unsigned char)s[len]) || s[len] == '_') {
+        len++;
+    }
+    if (!len || s[len] != ':' || !s[len + 1] || isspace ((unsigned char)s[len + 1])) {
+        return 0;
+    }
+    *keys = find_field (s, len);
+    return *keys ? len + 1 : 0;
+}
+
+static int
+is_or (const char *s)
+{
+    return s[0] == 'O' && s[1] == 'R' && (!s[2] || isspace ((unsigned char)s[2]));
+}
+
+// returns whether text uses any of the query syntax, anything else is
+// searched for as a whole
+static int
+uses_syntax (const char *text)
+{
+    const char *s = text;
+    while (*s) {
+        while (isspace ((unsigned char)*s)) {
+            s++;
+        }
+        if (!*s) {
+            break;
+        }
+        const char * const *keys;
+        if (*s == '"' || (*s == '-' && s[1] && !isspace ((unsigned char)s[1]))
+                || (s != text && is_or (s) && s[2]) || field_prefix (s, &keys)) {
+            return 1;
+        }
+        while (*s && !isspace ((unsigned char)*s)) {
+            s++;
+        }
+    }
+    return 0;
+}
+
+// parses "lo..hi" with either bound being optional, returns 0 on success
+static int
+parse_range (const char *s, int len, long *lo, long *hi)
+{
+    const char *dots = NULL;
+    for (int i = 0; i + 1 < len; i++) {
+        if (s[i] == '.' && s[i + 1] == '.') {
+            dots = s + i;
+            break;
+        }
+    }
+    if (!dots || len == 2) {
+        return -1;
+    }
+    *lo = LONG_MIN;
+    *hi = LONG_MAX;
+    char *end;
+    if (dots > s) {
+        *lo = strtol (s, &end, 10);
+        if (end != dots) {
+            return -1;
+        }
+    }
+    if (dots + 2 < s + len) {
+        *hi = strtol (dots + 2, &end, 10);
+        if (end != s + len) {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+static char *
+fold_copy (const char *s, int len, int *out_len)
+{
+    char *folded = malloc (len + 1);
+    if (folded) {
+        *out_len = qs_fold (s, len, folded, len + 1);
+    }
+    return folded;
+}
+
+static qs_pred_t *
+add_pred (qs_alt_t *alt)
+{
+    qs_pred_t *preds = realloc (alt->preds, (alt->pred_count + 1) * sizeof (qs_pred_t));
+    if (!preds) {
+        return NULL;
+    }
+    alt->preds = preds;
+    qs_pred_t *pred = &preds[alt->pred_count++];
+    memset (pred, 0, sizeof (qs_pred_t));
+    return pred;
+}
+
+static qs_alt_t *
+add_alt (qs_query_t *query)
+{
+    qs_alt_t *alts = realloc (query->alts, (query->alt_count + 1) * sizeof (qs_alt_t));
+    if (!alts) {
+        return NULL;
+    }
+    query->alts = alts;
+    qs_alt_t *alt = &alts[query->alt_count++];
+    memset (alt, 0, sizeof (qs_alt_t));
+    return alt;
+}
+
+static int
+parse (qs_query_t *query, const char *text)
+{
+    qs_alt_t *alt = NULL;
+    const char *s = text;
+    while (*s) {
+        while (isspace ((unsigned char)*s)) {
+            s++;
+        }
+        if (!*s) {
+            break;
+        }
+        if (is_or (s)) {
+            // an empty alternative would match everything, skip it
+            if (alt && alt->pred_count) {
+                alt = NULL;
+            }
+            s += 2;
+            continue;
+        }
+        if (!alt && !(alt = add_alt (query))) {
+            return -1;
+        }
+        qs_pred_t *pred = add_pred (alt);
+        if (!pred) {
+            return -1;
+        }
+        if (*s == '-' && s[1] && !isspace ((unsigned char)s[1])) {
+            pred->negate = 1;
+            s++;
+        }
+        s += field_prefix (s, &pred->fields);
+
+        const char *value = s;
+        int len;
+        int quoted = *s == '"';
+        if (quoted) {
+            value = ++s;
+            while (*s && *s != '"') {
+                s++;
+            }
+            len = s - value;
+            if (*s) {
+                s++;
+            }
+        }
+        else {
+            while (*s && !isspace ((unsigned char)*s)) {
+                s++;
+            }
+            len = s - value;
+        }
+
+        if (pred->fields && !quoted && !parse_range (value, len, &pred->lo, &pred->hi)) {
+            pred->type = QS_PRED_RANGE;
+            continue;
+        }
+        pred->type = QS_PRED_TEXT;
+        pred->text = fold_copy (value, len, &pred->text_len);
+        if (!pred->text) {
+            return -1;
+        }
+        if (!pred->text_len) {
+            // an empty phrase like a quote just typed would match every
+            // track, or none of them negated
+            free (pred->text);
+            alt->pred_count--;
+        }
+    }
+    // a trailing OR or empty phrases leave nothing behind
+    if (alt && !alt->pred_count) {
+        free (alt->preds);
+        query->alt_count--;
+    }
+    return 0;
+}
+
+qs_query_t *
+qs_query_compile (const char *text)
+{
+    qs_query_t *query = calloc (1, sizeof (qs_query_t));
+    if (!query) {
+        return NULL;
+    }
+    int len = strlen (text);
+    query->text = fold_copy (text, len, &query->text_len);
+    if (!query->text) {
+        qs_query_free (query);
+        return NULL;
+    }
+    if (uses_syntax (text) && parse (query, text) < 0) {
+        qs_query_free (query);
+        return NULL;
+    }
+    if (query->alt_count) {
+        // the folded text loses the difference between OR and or, the
+        // prefix keeps it apart from plain text
+        query->key = malloc (len + 2);
+        if (query->key) {
+            query->key[0] = 1;
+            memcpy (query->key + 1, text, len + 1);
+        }
+    }
+    else {
+        // nothing but syntax, search for the text itself
+        query->key = strdup (query->text);
+    }
+    if (!query->key) {
+        qs_query_free (query);
+        return NULL;
+    }
+    return query;
+}
+
+void
+qs_query_free (qs_query_t *query)
+{
+    if (!query) {
+        return;
+    }
+    for (int a = 0; a < query->alt_count; a++) {
+        for (int p = 0; p < query->alts[a].pred_count; p++) {
+            free (query->alts[a].preds[p].text);
+        }
+        free (query->alts[a].preds);
+    }
+    free (query->alts);
+    free (query->text);
+    free (query->key);
+    free (query);
+}
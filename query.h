@@ -0,0 +1,76 @@
+/*
+    Quick Search Plugin for DeaDBeeF audio player
+    Copyright (C) 2014 Christian Boxdörfer <christian.boxdoerfer@posteo.de>
+
+    This program is free software; you can redistribute it and/or
+    modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation; either version 2
+    of the License, or (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+*/
+
+#ifndef __QS_QUERY_H
+#define __QS_QUERY_H
+
+// Search queries. Plain text is matched as a whole against every searchable
+// field, like plt_search_process does. Text using the query syntax is
+// compiled into a list of alternatives, each a list of predicates which all
+// have to match:
+//
+//   artist:foo album:"bar baz" -live year:1990..1999 OR genre:jazz
+//
+// field:text and "quoted text" restrict a predicate to a field or keep
+// words together, -term negates it, field:lo..hi compares the number a
+// field starts with, and OR separates alternatives.
+
+enum {
+    QS_PRED_TEXT,
+    QS_PRED_RANGE,
+};
+
+typedef struct {
+    int type;
+    int negate;
+    // metadata keys the predicate looks at, NULL for all searchable fields
+    const char * const *fields;
+    // folded text for QS_PRED_TEXT
+    char *text;
+    int text_len;
+    // inclusive bounds for QS_PRED_RANGE
+    long lo;
+    long hi;
+} qs_pred_t;
+
+// all predicates have to match
+typedef struct {
+    qs_pred_t *preds;
+    int pred_count;
+} qs_alt_t;
+
+typedef struct {
+    // identifies the query, e.g. for caching its result
+    char *key;
+    // folded text of a plain query
+    char *text;
+    int text_len;
+    // alternatives of a query using the syntax, none for plain text
+    qs_alt_t *alts;
+    int alt_count;
+} qs_query_t;
+
+// returns the compiled query, or NULL if out of memory
+qs_query_t *
+qs_query_compile (const char *text);
+
+void
+qs_query_free (qs_query_t *query);
+
+#endif
@@ -0,0 +1,156 @@
+/*
+    Quick Search Plugin for DeaDBeeF audio player
+    Copyright (C) 2014 Christian Boxdörfer <christian.boxdoerfer@posteo.de>
+
+    This program is free software; you can redistribute it and/or
+    modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation; either version 2
+    of the License, or (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+*/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "quick_search.h"
+#include "result_cache.h"
+
+#define MAX_ENTRIES 64
+// upper bound for the memory of all entries together
+#define MAX_BYTES (4 << 20)
+
+typedef struct {
+    ddb_playlist_t *plt;
+    int mod_idx;
+    char *key;
+    qs_set_t *hits;
+    size_t size;
+    unsigned last_used;
+} qs_cache_entry_t;
+
+static qs_cache_entry_t entries[MAX_ENTRIES];
+static int entry_count = 0;
+static size_t total_size = 0;
+static unsigned use_serial = 0;
+
+static void
+entry_drop (int i)
+{
+    qs_cache_entry_t *e = &entries[i];
+    deadbeef->plt_unref (e->plt);
+    free (e->key);
+    qs_set_free (e->hits);
+    total_size -= e->size;
+    entries[i] = entries[--entry_count];
+}
+
+static int
+find_entry (ddb_playlist_t *plt, const char *key)
+{
+    for (int i = 0; i < entry_count; i++) {
+        if (entries[i].plt == plt && !strcmp (entries[i].key, key)) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static void
+drop_least_recent (void)
+{
+    int lru = 0;
+    for (int i = 1; i < entry_count; i++) {
+        if (entries[i].last_used < entries[lru].last_used) {
+            lru = i;
+        }
+    }
+    entry_drop (lru);
+}
+
+int
+qs_cache_lookup (ddb_playlist_t *plt, const char *key, const qs_set_t **hits)
+{
+    int i = find_entry (plt, key);
+    if (i < 0) {
+        return -1;
+    }
+    if (entries[i].mod_idx != deadbeef->plt_get_modification_idx (plt)) {
+        entry_drop (i);
+        return -1;
+    }
+    entries[i].last_used = ++use_serial;
+    *hits = entries[i].hits;
+    return qs_set_count (entries[i].hits);
+}
+
+void
+qs_cache_store (ddb_playlist_t *plt, const char *key, const uint32_t *hits, int count)
+{
+    if (count < 0) {
+        return;
+    }
+    char *copy_key = strdup (key);
+    qs_set_t *set = qs_set_from_sorted (hits, count);
+    size_t size = qs_set_memory (set);
+    if (!copy_key || !set || size > MAX_BYTES) {
+        free (copy_key);
+        qs_set_free (set);
+        return;
+    }
+
+    int i = find_entry (plt, key);
+    if (i >= 0) {
+        entry_drop (i);
+    }
+    while (entry_count > 0 && (entry_count >= MAX_ENTRIES || total_size + size > MAX_BYTES)) {
+        drop_least_recent ();
+    }
+
+    qs_cache_entry_t *e = &entries[entry_count++];
+    e->plt = plt;
+    deadbeef->plt_ref (plt);
+    e->mod_idx = deadbeef->plt_get_modification_idx (plt);
+    e->key = copy_key;
+    e->hits = set;
+    e->size = size;
+    e->last_used = ++use_serial;
+    total_size += size;
+}
+
+void
+qs_cache_invalidate (ddb_playlist_t *plt)
+{
+    deadbeef->pl_lock ();
+    for (int i = entry_count - 1; i >= 0; i--) {
+        if (!plt || entries[i].plt == plt) {
+            entry_drop (i);
+        }
+    }
+    deadbeef->pl_unlock ();
+}
+
+void
+qs_cache_prune (void)
+{
+    deadbeef->pl_lock ();
+    for (int i = entry_count - 1; i >= 0; i--) {
+        if (deadbeef->plt_get_idx (entries[i].plt) < 0) {
+            entry_drop (i);
+        }
+    }
+    deadbeef->pl_unlock ();
+}
+
+void
+qs_cache_free (void)
+{
+    qs_cache_invalidate (NULL);
+}
@@ -0,0 +1,55 @@
+/*
+    Quick Search Plugin for DeaDBeeF audio player
+    Copyright (C) 2014 Christian Boxdörfer <christian.boxdoerfer@posteo.de>
+
+    This program is free software; you can redistribute it and/or
+    modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation; either version 2
+    of the License, or (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+*/
+
+#ifndef __QS_RESULT_CACHE_H
+#define __QS_RESULT_CACHE_H
+
+#include <stdint.h>
+#include <deadbeef/deadbeef.h>
+
+#include "result_set.h"
+
+// Bounded LRU cache of search results. An entry holds the set of positions
+// of the tracks of one playlist which match a query, identified by the key
+// of the compiled query (see qs_query_t), and is only valid for the
+// playlist's modification index it was stored with.
+// The functions have to be called with pl_lock held, except for
+// qs_cache_invalidate, qs_cache_prune and qs_cache_free which take it.
+
+// returns the number of cached hits for the query in plt and points *hits at them
+// (owned by the cache, valid until it gets changed), or -1 if there are none
+int
+qs_cache_lookup (ddb_playlist_t *plt, const char *key, const qs_set_t **hits);
+
+// stores the count ascending positions in hits
+void
+qs_cache_store (ddb_playlist_t *plt, const char *key, const uint32_t *hits, int count);
+
+// drops the entries of plt, or all entries if plt is NULL
+void
+qs_cache_invalidate (ddb_playlist_t *plt);
+
+// drops the entries of playlists which got removed
+void
+qs_cache_prune (void);
+
+void
+qs_cache_free (void);
+
+#endif
@@ -0,0 +1,596 @@
+/*
+    Quick Search Plugin for DeaDBeeF audio player
+    Copyright (C) 2014 Christian Boxdörfer <christian.boxdoerfer@posteo.de>
+
+    This program is free software; you can redistribute it and/or
+    modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation; either version 2
+    of the License, or (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+*/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "result_set.h"
+
+// a group of up to that many positions takes less memory as an array
+#define ARRAY_MAX 4096
+#define BITMAP_WORDS (65536 / 64)
+
+enum {
+    OP_AND,
+    OP_OR,
+    OP_ANDNOT,
+};
+
+// the positions sharing the upper 16 bits key, either as sorted lower
+// bits in values or as a bitmap in bits
+typedef struct {
+    uint16_t key;
+    int count;
+    uint16_t *values;
+    uint64_t *bits;
+} qs_group_t;
+
+struct qs_set_s {
+    qs_group_t *groups;
+    int group_count;
+    int group_alloc;
+    int count;
+};
+
+static int
+popcount64 (uint64_t x)
+{
+#if defined(__GNUC__)
+    return __builtin_popcountll (x);
+#else
+    int count = 0;
+    while (x) {
+        x &= x - 1;
+        count++;
+    }
+    return count;
+#endif
+}
+
+static int
+clz64 (uint64_t x)
+{
+#if defined(__GNUC__)
+    return __builtin_clzll (x);
+#else
+    int n = 0;
+    while (!(x & ((uint64_t)1 << 63))) {
+        x <<= 1;
+        n++;
+    }
+    return n;
+#endif
+}
+
+static int
+ctz64 (uint64_t x)
+{
+#if defined(__GNUC__)
+    return __builtin_ctzll (x);
+#else
+    int n = 0;
+    while (!(x & 1)) {
+        x >>= 1;
+        n++;
+    }
+    return n;
+#endif
+}
+
+static void
+group_free (qs_group_t *g)
+{
+    free (g->values);
+    free (g->bits);
+}
+
+// appends a group taking over values or bits, which are freed on failure
+static int
+add_group (qs_set_t *set, uint16_t key, int count, uint16_t *values, uint64_t *bits)
+{
+    if (!count) {
+        free (values);
+        free (bits);
+        return 0;
+    }
+    if (set->group_count == set->group_alloc) {
+        int alloc = set->group_alloc ? set->group_alloc * 2 : 4;
+        qs_group_t *groups = realloc (set->groups, alloc * sizeof (qs_group_t));
+        if (!groups) {
+            free (values);
+            free (bits);
+            return -1;
+        }
+        set->groups = groups;
+        set->group_alloc = alloc;
+    }
+    qs_group_t *g = &set->groups[set->group_count++];
+    g->key = key;
+    g->count = count;
+    g->values = values;
+    g->bits = bits;
+    set->count += count;
+    return 0;
+}
+
+// adds the group made of the count bits, as an array if that's smaller
+static int
+add_bitmap (qs_set_t *set, uint16_t key, uint64_t *bits, int count)
+{
+    if (count > ARRAY_MAX) {
+        return add_group (set, key, count, NULL, bits);
+    }
+    uint16_t *values = malloc ((count > 0 ? count : 1) * sizeof (uint16_t));
+    if (!values) {
+        free (bits);
+        return -1;
+    }
+    int n = 0;
+    for (int w = 0; w < BITMAP_WORDS && n < count; w++) {
+        uint64_t word = bits[w];
+        while (word) {
+            values[n++] = (uint16_t)(w * 64 + ctz64 (word));
+            word &= word - 1;
+        }
+    }
+    free (bits);
+    return add_group (set, key, count, values, NULL);
+}
+
+static int
+copy_group (qs_set_t *set, const qs_group_t *g)
+{
+    if (g->bits) {
+        uint64_t *bits = malloc (BITMAP_WORDS * sizeof (uint64_t));
+        if (!bits) {
+            return -1;
+        }
+        memcpy (bits, g->bits, BITMAP_WORDS * sizeof (uint64_t));
+        return add_group (set, g->key, g->count, NULL, bits);
+    }
+    uint16_t *values = malloc (g->count * sizeof (uint16_t));
+    if (!values) {
+        return -1;
+    }
+    memcpy (values, g->values, g->count * sizeof (uint16_t));
+    return add_group (set, g->key, g->count, values, NULL);
+}
+
+// returns the bitmap of the group, a copy if it's an array
+static uint64_t *
+group_bits (const qs_group_t *g, int copy)
+{
+    if (g->bits && !copy) {
+        return g->bits;
+    }
+    uint64_t *bits = calloc (BITMAP_WORDS, sizeof (uint64_t));
+    if (!bits) {
+        return NULL;
+    }
+    if (g->bits) {
+        memcpy (bits, g->bits, BITMAP_WORDS * sizeof (uint64_t));
+    }
+    else {
+        for (int i = 0; i < g->count; i++) {
+            bits[g->values[i] >> 6] |= (uint64_t)1 << (g->values[i] & 63);
+        }
+    }
+    return bits;
+}
+
+static int
+combine_arrays (qs_set_t *set, const qs_group_t *a, const qs_group_t *b, int op)
+{
+    int max = op == OP_OR ? a->count + b->count : a->count;
+    uint16_t *values = malloc ((max > 0 ? max : 1) * sizeof (uint16_t));
+    if (!values) {
+        return -1;
+    }
+    int i = 0;
+    int j = 0;
+    int n = 0;
+    while (i < a->count && j < b->count) {
+        if (a->values[i] < b->values[j]) {
+            if (op != OP_AND) {
+                values[n++] = a->values[i];
+            }
+            i++;
+        }
+        else if (a->values[i] > b->values[j]) {
+            if (op == OP_OR) {
+                values[n++] = b->values[j];
+            }
+            j++;
+        }
+        else {
+            if (op != OP_ANDNOT) {
+                values[n++] = a->values[i];
+            }
+            i++;
+            j++;
+        }
+    }
+    while (op != OP_AND && i < a->count) {
+        values[n++] = a->values[i++];
+    }
+    while (op == OP_OR && j < b->count) {
+        values[n++] = b->values[j++];
+    }
+    if (n <= ARRAY_MAX) {
+        return add_group (set, a->key, n, values, NULL);
+    }
+    // a union of two arrays can outgrow an array
+    uint64_t *bits = calloc (BITMAP_WORDS, sizeof (uint64_t));
+    if (!bits) {
+        free (values);
+        return -1;
+    }
+    for (int k = 0; k < n; k++) {
+        bits[values[k] >> 6] |= (uint64_t)1 << (values[k] & 63);
+    }
+    free (values);
+    return add_group (set, a->key, n, NULL, bits);
+}
+
+static int
+combine_groups (qs_set_t *set, const qs_group_t *a, const qs_group_t *b, int op)
+{
+    if (!a->bits && !b->bits) {
+        return combine_arrays (set, a, b, op);
+    }
+    uint64_t *bits = group_bits (a, 1);
+    uint64_t *other = group_bits (b, 0);
+    if (!bits || !other) {
+        free (bits);
+        if (other != b->bits) {
+            free (other);
+        }
+        return -1;
+    }
+    int count = 0;
+    for (int w = 0; w < BITMAP_WORDS; w++) {
+        switch (op) {
+        case OP_AND:
+            bits[w] &= other[w];
+            break;
+        case OP_OR:
+            bits[w] |= other[w];
+            break;
+        default:
+            bits[w] &= ~other[w];
+            break;
+        }
+        count += popcount64 (bits[w]);
+    }
+    if (other != b->bits) {
+        free (other);
+    }
+    return add_bitmap (set, a->key, bits, count);
+}
+
+static qs_set_t *
+combine (const qs_set_t *a, const qs_set_t *b, int op)
+{
+    qs_set_t *set = qs_set_new ();
+    if (!set) {
+        return NULL;
+    }
+    int i = 0;
+    int j = 0;
+    int res = 0;
+    while (res == 0 && (i < a->group_count || j < b->group_count)) {
+        const qs_group_t *ga = i < a->group_count ? &a->groups[i] : NULL;
+        const qs_group_t *gb = j < b->group_count ? &b->groups[j] : NULL;
+        if (ga && (!gb || ga->key < gb->key)) {
+            if (op != OP_AND) {
+                res = copy_group (set, ga);
+            }
+            i++;
+        }
+        else if (!ga || gb->key < ga->key) {
+            if (op == OP_OR) {
+                res = copy_group (set, gb);
+            }
+            j++;
+        }
+        else {
+            res = combine_groups (set, ga, gb, op);
+            i++;
+            j++;
+        }
+        if (op != OP_OR && i >= a->group_count) {
+            // nothing left that could end up in the result
+            break;
+        }
+    }
+    if (res < 0) {
+        qs_set_free (set);
+        return NULL;
+    }
+    return set;
+}
+
+qs_set_t *
+qs_set_new (void)
+{
+    return calloc (1, sizeof (qs_set_t));
+}
+
+qs_set_t *
+qs_set_from_sorted (const uint32_t *values, int count)
+{
+    qs_set_t *set = qs_set_new ();
+    if (!set) {
+        return NULL;
+    }
+    int i = 0;
+    while (i < count) {
+        uint16_t key = values[i] >> 16;
+        int end = i;
+        while (end < count && (values[end] >> 16) == key) {
+            end++;
+        }
+        int res;
+        if (end - i > ARRAY_MAX) {
+            uint64_t *bits = calloc (BITMAP_WORDS, sizeof (uint64_t));
+            if (bits) {
+                for (int k = i; k < end; k++) {
+                    bits[(values[k] & 0xffff) >> 6] |= (uint64_t)1 << (values[k] & 63);
+                }
+            }
+            res = bits ? add_group (set, key, end - i, NULL, bits) : -1;
+        }
+        else {
+            uint16_t *lows = malloc ((end - i) * sizeof (uint16_t));
+            if (lows) {
+                for (int k = i; k < end; k++) {
+                    lows[k - i] = values[k] & 0xffff;
+                }
+            }
+            res = lows ? add_group (set, key, end - i, lows, NULL) : -1;
+        }
+        if (res < 0) {
+            qs_set_free (set);
+            return NULL;
+        }
+        i = end;
+    }
+    return set;
+}
+
+qs_set_t *
+qs_set_copy (const qs_set_t *set)
+{
+    qs_set_t *copy = qs_set_new ();
+    if (!copy) {
+        return NULL;
+    }
+    for (int i = 0; set && i < set->group_count; i++) {
+        if (copy_group (copy, &set->groups[i]) < 0) {
+            qs_set_free (copy);
+            return NULL;
+        }
+    }
+    return copy;
+}
+
+void
+qs_set_free (qs_set_t *set)
+{
+    if (!set) {
+        return;
+    }
+    for (int i = 0; i < set->group_count; i++) {
+        group_free (&set->groups[i]);
+    }
+    free (set->groups);
+    free (set);
+}
+
+int
+qs_set_count (const qs_set_t *set)
+{
+    return set ? set->count : 0;
+}
+
+// returns the index of the first group with a key >= key
+static int
+find_group (const qs_set_t *set, uint16_t key)
+{
+    int lo = 0;
+    int hi = set->group_count;
+    while (lo < hi) {
+        int mid = (lo + hi) / 2;
+        if (set->groups[mid].key < key) {
+            lo = mid + 1;
+        }
+        else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+// returns the index of the first value >= low in the array group
+static int
+find_value (const qs_group_t *g, uint16_t low)
+{
+    int lo = 0;
+    int hi = g->count;
+    while (lo < hi) {
+        int mid = (lo + hi) / 2;
+        if (g->values[mid] < low) {
+            lo = mid + 1;
+        }
+        else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+int
+qs_set_contains (const qs_set_t *set, uint32_t value)
+{
+    if (!set) {
+        return 0;
+    }
+    int i = find_group (set, value >> 16);
+    if (i >= set->group_count || set->groups[i].key != value >> 16) {
+        return 0;
+    }
+    const qs_group_t *g = &set->groups[i];
+    uint16_t low = value & 0xffff;
+    if (g->bits) {
+        return (g->bits[low >> 6] >> (low & 63)) & 1;
+    }
+    int k = find_value (g, low);
+    return k < g->count && g->values[k] == low;
+}
+
+int64_t
+qs_set_next (const qs_set_t *set, uint32_t from)
+{
+    if (!set) {
+        return -1;
+    }
+    for (int i = find_group (set, from >> 16); i < set->group_count; i++) {
+        const qs_group_t *g = &set->groups[i];
+        // later groups start at their first position
+        int low = g->key == from >> 16 ? (int)(from & 0xffff) : 0;
+        if (g->bits) {
+            int w = low >> 6;
+            uint64_t word = g->bits[w] & (~(uint64_t)0 << (low & 63));
+            while (!word && ++w < BITMAP_WORDS) {
+                word = g->bits[w];
+            }
+            if (word) {
+                return ((int64_t)g->key << 16) | (w * 64 + ctz64 (word));
+            }
+        }
+        else {
+            int k = find_value (g, low);
+            if (k < g->count) {
+                return ((int64_t)g->key << 16) | g->values[k];
+            }
+        }
+    }
+    return -1;
+}
+
+int64_t
+qs_set_prev (const qs_set_t *set, uint32_t from)
+{
+    if (!set) {
+        return -1;
+    }
+    int i = find_group (set, from >> 16);
+    if (i == set->group_count || set->groups[i].key != from >> 16) {
+        // the group of from isn't there, start with the one before
+        i--;
+    }
+    for (; i >= 0; i--) {
+        const qs_group_t *g = &set->groups[i];
+        // earlier groups start at their last position
+        int low = g->key == from >> 16 ? (int)(from & 0xffff) : 0xffff;
+        if (g->bits) {
+            int w = low >> 6;
+            uint64_t word = g->bits[w] & (~(uint64_t)0 >> (63 - (low & 63)));
+            while (!word && --w >= 0) {
+                word = g->bits[w];
+            }
+            if (word) {
+                return ((int64_t)g->key << 16) | (w * 64 + 63 - clz64 (word));
+            }
+        }
+        else {
+            // the first value > low, the one before it is the answer
+            int k = find_value (g, low);
+            if (k < g->count && g->values[k] == low) {
+                k++;
+            }
+            if (k > 0) {
+                return ((int64_t)g->key << 16) | g->values[k - 1];
+            }
+        }
+    }
+    return -1;
+}
+
+qs_set_t *
+qs_set_and (const qs_set_t *a, const qs_set_t *b)
+{
+    return combine (a, b, OP_AND);
+}
+
+qs_set_t *
+qs_set_or (const qs_set_t *a, const qs_set_t *b)
+{
+    return combine (a, b, OP_OR);
+}
+
+qs_set_t *
+qs_set_andnot (const qs_set_t *a, const qs_set_t *b)
+{
+    return combine (a, b, OP_ANDNOT);
+}
+
+int
+qs_set_to_array (const qs_set_t *set, uint32_t **values)
+{
+    int count = qs_set_count (set);
+    *values = malloc ((count > 0 ? count : 1) * sizeof (uint32_t));
+    if (!*values) {
+        return -1;
+    }
+    int n = 0;
+    for (int i = 0; set && i < set->group_count; i++) {
+        const qs_group_t *g = &set->groups[i];
+        uint32_t high = (uint32_t)g->key << 16;
+        if (g->bits) {
+            for (int w = 0; w < BITMAP_WORDS; w++) {
+                uint64_t word = g->bits[w];
+                while (word) {
+                    (*values)[n++] = high | (w * 64 + ctz64 (word));
+                    word &= word - 1;
+                }
+            }
+        }
+        else {
+            for (int k = 0; k < g->count; k++) {
+                (*values)[n++] = high | g->values[k];
+            }
+        }
+    }
+    return n;
+}
+
+size_t
+qs_set_memory (const qs_set_t *set)
+{
+    if (!set) {
+        return 0;
+    }
+    size_t size = sizeof (qs_set_t) + set->group_alloc * sizeof (qs_group_t);
+    for (int i = 0; i < set->group_count; i++) {
+        const qs_group_t *g = &set->groups[i];
+        size += g->bits ? BITMAP_WORDS * sizeof (uint64_t) : g->count * sizeof (uint16_t);
+    }
+    return size;
+}
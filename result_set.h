@@ -0,0 +1,81 @@
+/*
+    Quick Search Plugin for DeaDBeeF audio player
+    Copyright (C) 2014 Christian Boxdörfer <christian.boxdoerfer@posteo.de>
+
+    This program is free software; you can redistribute it and/or
+    modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation; either version 2
+    of the License, or (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+*/
+
+#ifndef __QS_RESULT_SET_H
+#define __QS_RESULT_SET_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Compressed set of track positions. The positions are grouped by their
+// upper 16 bits, each group is kept as a sorted array while it's sparse and
+// as a bitmap once that's smaller, like a Roaring bitmap. Counting takes
+// constant time, the set operations work on whole groups at once.
+// Sets aren't changed after they've been made, functions returning a set
+// return NULL when running out of memory.
+typedef struct qs_set_s qs_set_t;
+
+qs_set_t *
+qs_set_new (void);
+
+// makes a set of count ascending positions
+qs_set_t *
+qs_set_from_sorted (const uint32_t *values, int count);
+
+qs_set_t *
+qs_set_copy (const qs_set_t *set);
+
+void
+qs_set_free (qs_set_t *set);
+
+int
+qs_set_count (const qs_set_t *set);
+
+int
+qs_set_contains (const qs_set_t *set, uint32_t value);
+
+// returns the smallest position >= from in the set, or -1
+int64_t
+qs_set_next (const qs_set_t *set, uint32_t from);
+
+// returns the largest position <= from in the set, or -1
+int64_t
+qs_set_prev (const qs_set_t *set, uint32_t from);
+
+// the positions in both a and b
+qs_set_t *
+qs_set_and (const qs_set_t *a, const qs_set_t *b);
+
+// the positions in a, b or both
+qs_set_t *
+qs_set_or (const qs_set_t *a, const qs_set_t *b);
+
+// the positions in a but not in b
+qs_set_t *
+qs_set_andnot (const qs_set_t *a, const qs_set_t *b);
+
+// stores the positions in ascending order in *values (to be freed by the
+// caller) and returns their number, or -1 on failure
+int
+qs_set_to_array (const qs_set_t *set, uint32_t **values);
+
+size_t
+qs_set_memory (const qs_set_t *set);
+
+#endif
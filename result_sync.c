@@ -0,0 +1,298 @@
+/*
+    Quick Search Plugin for DeaDBeeF audio player
+    Copyright (C) 2014 Christian Boxdörfer <christian.boxdoerfer@posteo.de>
+
+    This program is free software; you can redistribute it and/or
+    modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation; either version 2
+    of the License, or (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+*/
+
+#include <stdlib.h>
+#include <stdint.h>
+
+#include "quick_search.h"
+#include "result_sync.h"
+
+// the synced playlist, its source tracks and their copies in playlist order.
+// Both are referenced, so a source pointer can't get reused by another track.
+// While tracks are pending, the copies up to the position the walk over the
+// result reached are at the front and the ones kept beyond it at
+// [tail_start, tail_end), which is where qs_sync_continue picks up.
+static ddb_playlist_t *target = NULL;
+static DB_playItem_t **sources = NULL;
+static DB_playItem_t **copies = NULL;
+static int synced_count = 0;
+static int tail_start = 0;
+static int tail_end = 0;
+static int synced_mod_idx = 0;
+// the number of result tracks and how far the walk over them got
+static int walk_count = 0;
+static int walk_pos = 0;
+
+typedef struct {
+    DB_playItem_t **keys;
+    int size;
+} qs_ptr_set_t;
+
+static uint32_t
+hash_ptr (const void *ptr)
+{
+    uintptr_t v = (uintptr_t)ptr;
+    v ^= v >> 17;
+    v *= 0x9e3779b1u;
+    return (uint32_t)(v ^ (v >> 15));
+}
+
+static int
+ptr_set_init (qs_ptr_set_t *set, DB_playItem_t **items, int count)
+{
+    set->size = 16;
+    while (set->size < count * 2) {
+        set->size *= 2;
+    }
+    set->keys = calloc (set->size, sizeof (DB_playItem_t *));
+    if (!set->keys) {
+        return -1;
+    }
+    for (int i = 0; i < count; i++) {
+        uint32_t b = hash_ptr (items[i]) & (set->size - 1);
+        while (set->keys[b] && set->keys[b] != items[i]) {
+            b = (b + 1) & (set->size - 1);
+        }
+        set->keys[b] = items[i];
+    }
+    return 0;
+}
+
+static int
+ptr_set_has (qs_ptr_set_t *set, DB_playItem_t *it)
+{
+    uint32_t b = hash_ptr (it) & (set->size - 1);
+    while (set->keys[b]) {
+        if (set->keys[b] == it) {
+            return 1;
+        }
+        b = (b + 1) & (set->size - 1);
+    }
+    return 0;
+}
+
+static void
+remove_copy (int i)
+{
+    deadbeef->plt_remove_item (target, copies[i]);
+    deadbeef->pl_item_unref (copies[i]);
+    deadbeef->pl_item_unref (sources[i]);
+}
+
+// moves the kept copies the walk didn't reach next to the others
+static void
+join_tail (void)
+{
+    for (int i = tail_start; i < tail_end; i++) {
+        sources[synced_count] = sources[i];
+        copies[synced_count] = copies[i];
+        synced_count++;
+    }
+    tail_start = tail_end = 0;
+    walk_count = walk_pos = 0;
+}
+
+static void
+drop_state (void)
+{
+    join_tail ();
+    for (int i = 0; i < synced_count; i++) {
+        deadbeef->pl_item_unref (copies[i]);
+        deadbeef->pl_item_unref (sources[i]);
+    }
+    free (sources);
+    sources = NULL;
+    free (copies);
+    copies = NULL;
+    synced_count = 0;
+    if (target) {
+        deadbeef->plt_unref (target);
+        target = NULL;
+    }
+}
+
+void
+qs_sync_reset (void)
+{
+    deadbeef->pl_lock ();
+    drop_state ();
+    deadbeef->pl_unlock ();
+}
+
+static void
+start_over (ddb_playlist_t *plt_to)
+{
+    drop_state ();
+    deadbeef->plt_clear (plt_to);
+    target = plt_to;
+    deadbeef->plt_ref (target);
+}
+
+// walks the result from walk_pos on, keeping the copies in the tail and
+// inserting the missing ones right after their predecessor, until limit
+// tracks got inserted. Returns the number of inserted copies.
+static int
+walk (ddb_playlist_t *plt_to, DB_playItem_t **tracks, int count, int limit, int *pending)
+{
+    DB_playItem_t *after = synced_count ? copies[synced_count - 1] : NULL;
+    int inserted = 0;
+    int changes = 0;
+    int i;
+    for (i = walk_pos; i < count; i++) {
+        if (tail_start < tail_end && sources[tail_start] == tracks[i]) {
+            // the front never overtakes the tail, it has one entry per
+            // track walked at most
+            sources[synced_count] = sources[tail_start];
+            copies[synced_count] = copies[tail_start];
+            after = copies[synced_count];
+            synced_count++;
+            tail_start++;
+            continue;
+        }
+        if (limit >= 0 && inserted >= limit) {
+            break;
+        }
+        inserted++;
+        DB_playItem_t *copy = deadbeef->pl_item_alloc ();
+        if (!copy) {
+            continue;
+        }
+        deadbeef->pl_item_copy (copy, tracks[i]);
+        deadbeef->plt_insert_item (plt_to, after, copy);
+        deadbeef->pl_item_ref (tracks[i]);
+        sources[synced_count] = tracks[i];
+        copies[synced_count] = copy;
+        after = copy;
+        synced_count++;
+        changes++;
+    }
+    walk_pos = i;
+    // the tail holds the kept tracks among the rest
+    *pending = count - i - (tail_end - tail_start);
+    synced_mod_idx = deadbeef->plt_get_modification_idx (plt_to);
+    return changes;
+}
+
+int
+qs_sync_playlist (ddb_playlist_t *plt_to, DB_playItem_t **tracks, int count, int limit, int *pending)
+{
+    *pending = 0;
+    if (!plt_to) {
+        return 0;
+    }
+    deadbeef->pl_lock ();
+    join_tail ();
+    if (target != plt_to || deadbeef->plt_get_modification_idx (plt_to) != synced_mod_idx) {
+        // somebody else changed the playlist, we don't know its content
+        start_over (plt_to);
+    }
+
+    int alloc = count > synced_count ? count : synced_count;
+    DB_playItem_t **new_sources = malloc ((alloc > 0 ? alloc : 1) * sizeof (DB_playItem_t *));
+    DB_playItem_t **new_copies = malloc ((alloc > 0 ? alloc : 1) * sizeof (DB_playItem_t *));
+    int *kept = malloc ((alloc > 0 ? alloc : 1) * sizeof (int));
+    qs_ptr_set_t set = { NULL, 0 };
+    if (!new_sources || !new_copies || !kept || ptr_set_init (&set, tracks, count) < 0) {
+        free (new_sources);
+        free (new_copies);
+        free (kept);
+        free (set.keys);
+        start_over (plt_to);
+        synced_mod_idx = deadbeef->plt_get_modification_idx (plt_to);
+        deadbeef->pl_unlock ();
+        return 0;
+    }
+
+    // the tracks staying in the result have to keep their relative order,
+    // otherwise (e.g. after sorting a source playlist) start over
+    int kept_count = 0;
+    for (int i = 0; i < synced_count; i++) {
+        if (ptr_set_has (&set, sources[i])) {
+            kept[kept_count++] = i;
+        }
+    }
+    int k = 0;
+    for (int i = 0; i < count && k < kept_count; i++) {
+        if (sources[kept[k]] == tracks[i]) {
+            k++;
+        }
+    }
+    free (set.keys);
+
+    int changes = 0;
+    if (k < kept_count) {
+        changes = synced_count;
+        start_over (plt_to);
+        kept_count = 0;
+    }
+    else {
+        // drop the tracks which are no longer part of the result
+        k = 0;
+        for (int i = 0; i < synced_count; i++) {
+            if (k < kept_count && kept[k] == i) {
+                k++;
+                continue;
+            }
+            remove_copy (i);
+            changes++;
+        }
+    }
+
+    // the kept copies form the tail the walk over the new result starts with
+    int tail = alloc - kept_count;
+    for (k = 0; k < kept_count; k++) {
+        new_sources[tail + k] = sources[kept[k]];
+        new_copies[tail + k] = copies[kept[k]];
+    }
+    free (sources);
+    free (copies);
+    free (kept);
+    sources = new_sources;
+    copies = new_copies;
+    synced_count = 0;
+    tail_start = tail;
+    tail_end = alloc;
+    walk_count = count;
+    walk_pos = 0;
+    changes += walk (plt_to, tracks, count, limit, pending);
+    deadbeef->pl_unlock ();
+    trace ("quick_search: synced %d tracks, %d changes, %d pending\n", synced_count, changes, *pending);
+    return changes;
+}
+
+int
+qs_sync_continue (ddb_playlist_t *plt_to, DB_playItem_t **tracks, int count, int limit, int *pending)
+{
+    *pending = 0;
+    if (!plt_to) {
+        return 0;
+    }
+    deadbeef->pl_lock ();
+    if (target != plt_to || deadbeef->plt_get_modification_idx (plt_to) != synced_mod_idx
+            || walk_count != count) {
+        // the walk can't pick up where it left off
+        int changes = qs_sync_playlist (plt_to, tracks, count, limit, pending);
+        deadbeef->pl_unlock ();
+        return changes;
+    }
+    int changes = walk (plt_to, tracks, count, limit, pending);
+    deadbeef->pl_unlock ();
+    trace ("quick_search: synced %d tracks, %d changes, %d pending\n", synced_count + tail_end - tail_start, changes, *pending);
+    return changes;
+}
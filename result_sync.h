@@ -0,0 +1,45 @@
+/*
+    Quick Search Plugin for DeaDBeeF audio player
+    Copyright (C) 2014 Christian Boxdörfer <christian.boxdoerfer@posteo.de>
+
+    This program is free software; you can redistribute it and/or
+    modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation; either version 2
+    of the License, or (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+*/
+
+#ifndef __QS_RESULT_SYNC_H
+#define __QS_RESULT_SYNC_H
+
+#include <deadbeef/deadbeef.h>
+
+// makes plt_to hold copies of the given source tracks in the given order.
+// Only tracks which got dropped from or added to the result since the
+// previous call are removed from or inserted into plt_to. At most limit
+// tracks get inserted (no limit if negative), the number of tracks left out
+// is stored in *pending; calling again with the same tracks inserts the
+// next ones. Returns the number of changed tracks. Needs pl_lock.
+int
+qs_sync_playlist (ddb_playlist_t *plt_to, DB_playItem_t **tracks, int count, int limit, int *pending);
+
+// like qs_sync_playlist, but only inserts the next tracks left pending by the
+// previous call, which has to have been given the same tracks. Takes time in
+// proportion to the tracks inserted rather than to the whole result, unless
+// plt_to changed in the meantime and it has to fall back to a full sync.
+int
+qs_sync_continue (ddb_playlist_t *plt_to, DB_playItem_t **tracks, int count, int limit, int *pending);
+
+// forgets the synced state, the next sync starts from an empty playlist
+void
+qs_sync_reset (void);
+
+#endif
@@ -0,0 +1,90 @@
+/*
+    Quick Search Plugin for DeaDBeeF audio player
+    Copyright (C) 2014 Christian Boxdörfer <christian.boxdoerfer@posteo.de>
+
+    This program is free software; you can redistribute it and/or
+    modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation; either version 2
+    of the License, or (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+*/
+
+#include <stdint.h>
+
+#include "search_delay.h"
+
+#define SCOPE_COUNT 3
+// searches faster than this don't get delayed at all
+#define CHEAP_USEC 16000
+#define MIN_DELAY 30
+#define MAX_DELAY 400
+
+typedef struct {
+    int64_t avg;
+    int64_t last;
+    int samples;
+} scope_cost_t;
+
+static scope_cost_t costs[SCOPE_COUNT];
+
+void
+qs_delay_record (int scope, int64_t usec)
+{
+    if (scope < 0 || scope >= SCOPE_COUNT || usec < 0) {
+        return;
+    }
+    scope_cost_t *c = &costs[scope];
+    if (!c->samples) {
+        c->avg = usec;
+    }
+    else {
+        // exponential moving average, the newest search weighs a quarter
+        c->avg += (usec - c->avg) / 4;
+    }
+    c->last = usec;
+    c->samples++;
+}
+
+int
+qs_delay_get (int scope)
+{
+    if (scope < 0 || scope >= SCOPE_COUNT) {
+        return MIN_DELAY;
+    }
+    scope_cost_t *c = &costs[scope];
+    if (!c->samples) {
+        // nothing known yet, the first search tells how expensive they are
+        return 0;
+    }
+    if (c->last < CHEAP_USEC && c->avg < 2 * CHEAP_USEC) {
+        return 0;
+    }
+    // wait about twice as long as a search takes, so that a search only
+    // starts once the user stopped typing for a moment
+    int64_t delay = c->avg * 2 / 1000;
+    if (delay < MIN_DELAY) {
+        delay = MIN_DELAY;
+    }
+    if (delay > MAX_DELAY) {
+        delay = MAX_DELAY;
+    }
+    return (int)delay;
+}
+
+void
+qs_delay_reset (void)
+{
+    for (int i = 0; i < SCOPE_COUNT; i++) {
+        costs[i].avg = 0;
+        costs[i].last = 0;
+        costs[i].samples = 0;
+    }
+}
@@ -0,0 +1,41 @@
+/*
+    Quick Search Plugin for DeaDBeeF audio player
+    Copyright (C) 2014 Christian Boxdörfer <christian.boxdoerfer@posteo.de>
+
+    This program is free software; you can redistribute it and/or
+    modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation; either version 2
+    of the License, or (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+*/
+
+#ifndef __QS_SEARCH_DELAY_H
+#define __QS_SEARCH_DELAY_H
+
+#include <stdint.h>
+
+// Picks the delay between a keystroke and the search it triggers from the
+// durations of recent searches in the same scope (see search_in_mode_t).
+// Cheap searches run right away, expensive ones wait until typing pauses.
+
+// records that a search in scope took usec microseconds
+void
+qs_delay_record (int scope, int64_t usec);
+
+// returns the delay in milliseconds before searching in scope, 0 means the
+// search should run immediately
+int
+qs_delay_get (int scope);
+
+void
+qs_delay_reset (void);
+
+#endif
@@ -0,0 +1,2617 @@
+/*
+    Quick Search Plugin for DeaDBeeF audio player
+    Copyright (C) 2014 Christian Boxdörfer <christian.boxdoerfer@posteo.de>
+
+    This program is free software; you can redistribute it and/or
+    modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation; either version 2
+    of the License, or (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+*/
+
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
+#include "quick_search.h"
+#include "search_index.h"
+#include "fold.h"
+#include "match.h"
+#include "query.h"
+#include "index_store.h"
+#include "result_set.h"
+
+#define MAX_QUERY_TOKENS 32
+// refine the previous result if it holds at most 1/REFINE_RATIO of the tracks
+#define REFINE_RATIO 16
+// number of tracks per shard, shards can be tokenized and searched in parallel
+#define SHARD_SIZE 16384
+// columns of a shard a field predicate can refer to
+#define MAX_PRED_KEYS 16
+
+typedef struct {
+    char *text;
+    int len;
+    uint32_t *postings;
+    int count;
+    int alloc;
+} qs_token_t;
+
+// folded values of one metadata key, 0-terminated one after the other. The
+// value of the track in slot i is text[starts[i]..starts[i]+lens[i]], which
+// is empty if the track doesn't have the key and holds several 0-terminated
+// strings if the key occurs more than once. Changed values are appended, the
+// space of the old ones is counted as garbage until the column is compacted.
+typedef struct {
+    char *key;
+    // shortcut for comparing keys, never dereferenced
+    const char *key_ptr;
+    char *text;
+    size_t size;
+    size_t alloc;
+    size_t garbage;
+    uint32_t *starts;
+    uint32_t *lens;
+} qs_column_t;
+
+// token index of a set of tracks of the playlist. Tracks are kept in slots
+// which don't move when tracks get added, removed or moved around in the
+// playlist, the postings refer to slots.
+typedef struct {
+    // slots in use, including those of removed tracks
+    int count;
+    int slot_alloc;
+    // tracks and their current playlist positions, NULL and UINT32_MAX for
+    // removed tracks
+    DB_playItem_t **items;
+    uint32_t *pos;
+    int live;
+    // whether the positions ascend with the slots
+    int ordered;
+    int built;
+    // slots tokenized so far while the shard gets built in steps
+    int build_next;
+    // changed since it was built, so it doesn't match its fingerprint anymore
+    int modified;
+    // metadata changed while the index was held, tokenized again once released
+    int outdated;
+    qs_token_t *tokens;
+    int token_count;
+    int token_alloc;
+    // open addressing, token index + 1, 0 marks an empty bucket
+    int *buckets;
+    int bucket_count;
+    // trigrams of the token texts, sorted, with the ascending indexes of the
+    // tokens containing them in tri_tokens[tri_offsets[i]..tri_offsets[i+1]]
+    uint32_t *tri_keys;
+    int *tri_offsets;
+    int *tri_tokens;
+    int tri_count;
+    // tokens added after the trigram lists were built are scanned
+    int tri_token_count;
+    // one column per searchable metadata key found in the shard, so scans
+    // read contiguous memory instead of following the metadata lists
+    qs_column_t *columns;
+    int column_count;
+    int column_alloc;
+    // identifies the content of the shard in the index file
+    uint64_t fingerprint;
+    // tokens, trigrams and columns point into the mapped index file
+    int mapped;
+    // per slot scratch space for set operations
+    uint32_t *marks;
+    uint32_t serial;
+    // folded text and hits of the previous query
+    char *last_query;
+    uint32_t *last_hits;
+    int last_count;
+} qs_shard_t;
+
+// shard and slot of a track
+typedef struct {
+    uint32_t shard;
+    uint32_t slot;
+} qs_loc_t;
+
+struct qs_plt_index_s {
+    ddb_playlist_t *plt;
+    int mod_idx;
+    int dirty;
+    DB_playItem_t **items;
+    qs_loc_t *locs;
+    int item_count;
+    // positions of the tracks, open addressing keyed by the track pointers
+    DB_playItem_t **map_keys;
+    uint32_t *map_positions;
+    int map_size;
+    qs_shard_t *shards;
+    int shard_count;
+    int shard_alloc;
+    // whether the hits of the shards come out in playlist order when
+    // they're simply put one after the other
+    int ordered;
+    // searches querying the index without pl_lock, see qs_index_hold, and
+    // whether metadata changed in the meantime
+    int readers;
+    int held_changes;
+    // positions selected by the last search, valid for result_mod_idx
+    qs_set_t *result;
+    int result_mod_idx;
+    struct qs_plt_index_s *next;
+};
+
+static qs_plt_index_t *indexes = NULL;
+
+int
+qs_is_searchable_key (const char *key)
+{
+    if (key[0] == ':') {
+        return !strcmp (key, ":URI");
+    }
+    if (key[0] == '_' || key[0] == '!') {
+        return 0;
+    }
+    if (!strcasecmp (key, "cuesheet") || !strcasecmp (key, "log")) {
+        return 0;
+    }
+    return 1;
+}
+
+// a metadata field holds several values separated by 0 bytes if the tag
+// occurs more than once, returns the one after value or NULL
+static const char *
+next_value (const DB_metaInfo_t *m, const char *value)
+{
+#if (DDB_API_LEVEL >= 10)
+    value += strlen (value) + 1;
+    return value < m->value + m->valuesize ? value : NULL;
+#else
+    return NULL;
+#endif
+}
+
+// the player only matches the file name of the uri, not the directories
+static const char *
+searchable_value (const DB_metaInfo_t *m, const char *value)
+{
+    if (m->key[0] == ':') {
+        const char *slash = strrchr (value, '/');
+        if (slash) {
+            return slash + 1;
+        }
+    }
+    return value;
+}
+
+static uint32_t
+hash_token (const char *text, int len)
+{
+    uint32_t h = 2166136261u;
+    for (int i = 0; i < len; i++) {
+        h ^= (unsigned char)text[i];
+        h *= 16777619u;
+    }
+    return h;
+}
+
+static int
+grow_buckets (qs_shard_t *shard)
+{
+    int bucket_count = shard->bucket_count ? shard->bucket_count * 2 : 1024;
+    // the buckets of a mapped shard are only set up once it gets changed
+    while (bucket_count < (shard->token_count + 1) * 2) {
+        bucket_count *= 2;
+    }
+    int *buckets = calloc (bucket_count, sizeof (int));
+    if (!buckets) {
+        return -1;
+    }
+    for (int i = 0; i < shard->token_count; i++) {
+        qs_token_t *tok = &shard->tokens[i];
+        uint32_t b = hash_token (tok->text, tok->len) & (bucket_count - 1);
+        while (buckets[b]) {
+            b = (b + 1) & (bucket_count - 1);
+        }
+        buckets[b] = i + 1;
+    }
+    free (shard->buckets);
+    shard->buckets = buckets;
+    shard->bucket_count = bucket_count;
+    return 0;
+}
+
+static qs_token_t *
+find_token (qs_shard_t *shard, const char *text, int len)
+{
+    if (!shard->bucket_count) {
+        return NULL;
+    }
+    uint32_t b = hash_token (text, len) & (shard->bucket_count - 1);
+    while (shard->buckets[b]) {
+        qs_token_t *tok = &shard->tokens[shard->buckets[b] - 1];
+        if (tok->len == len && !memcmp (tok->text, text, len)) {
+            return tok;
+        }
+        b = (b + 1) & (shard->bucket_count - 1);
+    }
+    return NULL;
+}
+
+static qs_token_t *
+get_token (qs_shard_t *shard, const char *text, int len)
+{
+    if ((shard->token_count + 1) * 2 > shard->bucket_count) {
+        if (grow_buckets (shard) < 0) {
+            return NULL;
+        }
+    }
+    uint32_t b = hash_token (text, len) & (shard->bucket_count - 1);
+    while (shard->buckets[b]) {
+        qs_token_t *tok = &shard->tokens[shard->buckets[b] - 1];
+        if (tok->len == len && !memcmp (tok->text, text, len)) {
+            return tok;
+        }
+        b = (b + 1) & (shard->bucket_count - 1);
+    }
+
+    if (shard->token_count >= shard->token_alloc) {
+        int alloc = shard->token_alloc ? shard->token_alloc * 2 : 1024;
+        qs_token_t *tokens = realloc (shard->tokens, alloc * sizeof (qs_token_t));
+        if (!tokens) {
+            return NULL;
+        }
+        shard->tokens = tokens;
+        shard->token_alloc = alloc;
+    }
+    qs_token_t *tok = &shard->tokens[shard->token_count];
+    memset (tok, 0, sizeof (qs_token_t));
+    tok->text = malloc (len + 1);
+    if (!tok->text) {
+        return NULL;
+    }
+    memcpy (tok->text, text, len);
+    tok->text[len] = 0;
+    tok->len = len;
+    shard->buckets[b] = ++shard->token_count;
+    return tok;
+}
+
+// returns the index of the first posting not below slot
+static int
+find_posting (qs_token_t *tok, uint32_t slot)
+{
+    int lo = 0;
+    int hi = tok->count;
+    while (lo < hi) {
+        int mid = (lo + hi) / 2;
+        if (tok->postings[mid] < slot) {
+            lo = mid + 1;
+        }
+        else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+static void
+add_posting (qs_token_t *tok, uint32_t slot)
+{
+    // slots are mostly indexed in order, which appends to the list
+    int i = tok->count;
+    if (tok->count && tok->postings[tok->count - 1] >= slot) {
+        i = find_posting (tok, slot);
+        if (tok->postings[i] == slot) {
+            return;
+        }
+    }
+    if (tok->count >= tok->alloc) {
+        int alloc = tok->alloc ? tok->alloc * 2 : 4;
+        uint32_t *postings = realloc (tok->postings, alloc * sizeof (uint32_t));
+        if (!postings) {
+            return;
+        }
+        tok->postings = postings;
+        tok->alloc = alloc;
+    }
+    memmove (tok->postings + i + 1, tok->postings + i, (tok->count - i) * sizeof (uint32_t));
+    tok->postings[i] = slot;
+    tok->count++;
+}
+
+static void
+remove_posting (qs_token_t *tok, uint32_t slot)
+{
+    int i = find_posting (tok, slot);
+    if (i < tok->count && tok->postings[i] == slot) {
+        memmove (tok->postings + i, tok->postings + i + 1, (tok->count - i - 1) * sizeof (uint32_t));
+        tok->count--;
+    }
+}
+
+// stores offset and length of every maximal run of word characters in the
+// folded string s, returns the number of runs
+static int
+split_tokens (const char *s, int *starts, int *lens, int max)
+{
+    int count = 0;
+    int start = -1;
+    int i = 0;
+    while (1) {
+        uint32_t cp = 0;
+        int n = s[i] ? qs_utf8_decode (s + i, &cp) : 0;
+        int is_word = n && qs_is_word_char (cp);
+        if (is_word && start < 0) {
+            start = i;
+        }
+        else if (!is_word && start >= 0) {
+            if (count >= max) {
+                break;
+            }
+            starts[count] = start;
+            lens[count] = i - start;
+            count++;
+            start = -1;
+        }
+        if (!n) {
+            break;
+        }
+        i += n;
+    }
+    return count;
+}
+
+// adds the words of the folded text to the vocabulary, or removes the slot
+// from their postings
+static void
+index_text (qs_shard_t *shard, uint32_t slot, const char *folded, int remove)
+{
+    int i = 0;
+    int start = -1;
+    while (1) {
+        uint32_t cp = 0;
+        int n = folded[i] ? qs_utf8_decode (folded + i, &cp) : 0;
+        int is_word = n && qs_is_word_char (cp);
+        if (is_word && start < 0) {
+            start = i;
+        }
+        else if (!is_word && start >= 0) {
+            if (remove) {
+                qs_token_t *tok = find_token (shard, folded + start, i - start);
+                if (tok) {
+                    remove_posting (tok, slot);
+                }
+            }
+            else {
+                qs_token_t *tok = get_token (shard, folded + start, i - start);
+                if (tok) {
+                    add_posting (tok, slot);
+                }
+            }
+            start = -1;
+        }
+        if (!n) {
+            break;
+        }
+        i += n;
+    }
+}
+
+// returns the column holding the values of key, adding it if needed
+static qs_column_t *
+shard_column (qs_shard_t *shard, const char *key)
+{
+    for (int i = 0; i < shard->column_count; i++) {
+        qs_column_t *col = &shard->columns[i];
+        if (col->key_ptr == key || !strcmp (col->key, key)) {
+            return col;
+        }
+    }
+    if (shard->column_count >= shard->column_alloc) {
+        int alloc = shard->column_alloc ? shard->column_alloc * 2 : 16;
+        qs_column_t *columns = realloc (shard->columns, alloc * sizeof (qs_column_t));
+        if (!columns) {
+            return NULL;
+        }
+        shard->columns = columns;
+        shard->column_alloc = alloc;
+    }
+    qs_column_t *col = &shard->columns[shard->column_count];
+    memset (col, 0, sizeof (qs_column_t));
+    col->key = strdup (key);
+    col->starts = calloc (shard->slot_alloc > 0 ? shard->slot_alloc : 1, sizeof (uint32_t));
+    col->lens = calloc (shard->slot_alloc > 0 ? shard->slot_alloc : 1, sizeof (uint32_t));
+    if (!col->key || !col->starts || !col->lens) {
+        free (col->key);
+        free (col->starts);
+        free (col->lens);
+        return NULL;
+    }
+    col->key_ptr = key;
+    shard->column_count++;
+    return col;
+}
+
+// appends the folded value of the track in slot i to the column, returns the
+// offset of the value or -1 if the column couldn't be grown
+static long
+append_value (qs_column_t *col, int i, const char *value, int len)
+{
+    // folding never makes the text longer, see qs_fold
+    if (col->size + len + 1 > col->alloc) {
+        size_t alloc = col->alloc ? col->alloc : 1024;
+        while (col->size + len + 1 > alloc) {
+            alloc *= 2;
+        }
+        char *text = realloc (col->text, alloc);
+        if (!text) {
+            return -1;
+        }
+        col->text = text;
+        col->alloc = alloc;
+    }
+    size_t offset = col->size;
+    int folded_len = qs_fold (value, len, col->text + offset, len + 1);
+    col->size += folded_len + 1;
+    // the values of a track are kept together, the ones added before are
+    // right in front unless the key occurs more than once
+    if (!col->lens[i] || col->starts[i] + col->lens[i] != offset) {
+        col->garbage += col->lens[i];
+        col->starts[i] = offset;
+        col->lens[i] = 0;
+    }
+    col->lens[i] += folded_len + 1;
+    return offset;
+}
+
+// releases the unused space of a column
+static void
+finish_column (qs_column_t *col)
+{
+    if (col->size < col->alloc) {
+        char *text = realloc (col->text, col->size ? col->size : 1);
+        if (text) {
+            col->text = text;
+            col->alloc = col->size ? col->size : 1;
+        }
+    }
+}
+
+static void
+forget_result (qs_shard_t *shard)
+{
+    free (shard->last_query);
+    shard->last_query = NULL;
+    free (shard->last_hits);
+    shard->last_hits = NULL;
+    shard->last_count = 0;
+}
+
+static void
+remember_result (qs_shard_t *shard, const char *query, const uint32_t *hits, int count)
+{
+    forget_result (shard);
+    if (!*query) {
+        return;
+    }
+    shard->last_query = strdup (query);
+    shard->last_hits = malloc ((count > 0 ? count : 1) * sizeof (uint32_t));
+    if (!shard->last_query || !shard->last_hits) {
+        forget_result (shard);
+        return;
+    }
+    memcpy (shard->last_hits, hits, count * sizeof (uint32_t));
+    shard->last_count = count;
+}
+
+static uint32_t
+trigram_at (const char *s)
+{
+    const unsigned char *u = (const unsigned char *)s;
+    return ((uint32_t)u[0] << 16) | ((uint32_t)u[1] << 8) | u[2];
+}
+
+static int
+cmp_trigram_pair (const void *a, const void *b)
+{
+    const uint32_t *x = a;
+    const uint32_t *y = b;
+    if (x[0] != y[0]) {
+        return x[0] < y[0] ? -1 : 1;
+    }
+    return x[1] < y[1] ? -1 : x[1] > y[1];
+}
+
+// builds the trigram lists of the vocabulary, so that query tokens of three
+// or more bytes only have to be compared with the tokens sharing their
+// trigrams instead of the whole vocabulary
+static int
+build_trigrams (qs_shard_t *shard)
+{
+    long pair_count = 0;
+    for (int t = 0; t < shard->token_count; t++) {
+        if (shard->tokens[t].len >= 3) {
+            pair_count += shard->tokens[t].len - 2;
+        }
+    }
+    // (trigram, token) pairs
+    uint32_t *pairs = malloc ((pair_count > 0 ? pair_count : 1) * 2 * sizeof (uint32_t));
+    if (!pairs) {
+        return -1;
+    }
+    long n = 0;
+    for (int t = 0; t < shard->token_count; t++) {
+        qs_token_t *tok = &shard->tokens[t];
+        for (int i = 0; i + 3 <= tok->len; i++) {
+            pairs[2 * n] = trigram_at (tok->text + i);
+            pairs[2 * n + 1] = t;
+            n++;
+        }
+    }
+    qsort (pairs, n, 2 * sizeof (uint32_t), cmp_trigram_pair);
+
+    int keys = 0;
+    long unique = 0;
+    for (long i = 0; i < n; i++) {
+        if (i && pairs[2 * i] == pairs[2 * (i - 1)] && pairs[2 * i + 1] == pairs[2 * (i - 1) + 1]) {
+            // a token containing the same trigram more than once
+            continue;
+        }
+        if (!i || pairs[2 * i] != pairs[2 * (i - 1)]) {
+            keys++;
+        }
+        unique++;
+    }
+    shard->tri_keys = malloc ((keys > 0 ? keys : 1) * sizeof (uint32_t));
+    shard->tri_offsets = malloc ((keys + 1) * sizeof (int));
+    shard->tri_tokens = malloc ((unique > 0 ? unique : 1) * sizeof (int));
+    if (!shard->tri_keys || !shard->tri_offsets || !shard->tri_tokens) {
+        free (pairs);
+        return -1;
+    }
+    int k = 0;
+    int u = 0;
+    for (long i = 0; i < n; i++) {
+        if (i && pairs[2 * i] == pairs[2 * (i - 1)] && pairs[2 * i + 1] == pairs[2 * (i - 1) + 1]) {
+            continue;
+        }
+        if (!i || pairs[2 * i] != pairs[2 * (i - 1)]) {
+            shard->tri_keys[k] = pairs[2 * i];
+            shard->tri_offsets[k] = u;
+            k++;
+        }
+        shard->tri_tokens[u++] = pairs[2 * i + 1];
+    }
+    shard->tri_offsets[k] = u;
+    shard->tri_count = keys;
+    shard->tri_token_count = shard->token_count;
+    free (pairs);
+    return 0;
+}
+
+// returns the number of tokens containing trigram and points *tokens at them
+static int
+trigram_tokens (qs_shard_t *shard, uint32_t trigram, const int **tokens)
+{
+    int lo = 0;
+    int hi = shard->tri_count;
+    while (lo < hi) {
+        int mid = (lo + hi) / 2;
+        if (shard->tri_keys[mid] < trigram) {
+            lo = mid + 1;
+        }
+        else {
+            hi = mid;
+        }
+    }
+    if (lo >= shard->tri_count || shard->tri_keys[lo] != trigram) {
+        return 0;
+    }
+    *tokens = shard->tri_tokens + shard->tri_offsets[lo];
+    return shard->tri_offsets[lo + 1] - shard->tri_offsets[lo];
+}
+
+// stores the tokens covered by the trigram lists which contain the query
+// token qt (at least three bytes long) in matched, returns their number
+static int
+match_trigrams (qs_shard_t *shard, const char *qt, int len, int *matched)
+{
+    // start with the rarest trigram of the query token
+    const int *best = NULL;
+    int best_count = -1;
+    for (int i = 0; i + 3 <= len; i++) {
+        const int *tokens = NULL;
+        int n = trigram_tokens (shard, trigram_at (qt + i), &tokens);
+        if (!n) {
+            return 0;
+        }
+        if (best_count < 0 || n < best_count) {
+            best = tokens;
+            best_count = n;
+        }
+    }
+    memcpy (matched, best, best_count * sizeof (int));
+    int count = best_count;
+
+    // intersect with the other trigrams, both lists are sorted
+    for (int i = 0; i + 3 <= len && count > 0; i++) {
+        const int *tokens = NULL;
+        int n = trigram_tokens (shard, trigram_at (qt + i), &tokens);
+        if (tokens == best) {
+            continue;
+        }
+        int kept = 0;
+        int j = 0;
+        for (int c = 0; c < count; c++) {
+            while (j < n && tokens[j] < matched[c]) {
+                j++;
+            }
+            if (j < n && tokens[j] == matched[c]) {
+                matched[kept++] = matched[c];
+            }
+        }
+        count = kept;
+    }
+
+    // the trigrams might appear in a different order, verify the candidates
+    int kept = 0;
+    for (int c = 0; c < count; c++) {
+        qs_token_t *tok = &shard->tokens[matched[c]];
+        if (tok->len >= len && memmem (tok->text, tok->len, qt, len)) {
+            matched[kept++] = matched[c];
+        }
+    }
+    return kept;
+}
+
+// stores the vocabulary entries containing the query token qt in matched
+// (ascending) and returns their number, *cost is set to the length of their
+// postings
+static int
+match_tokens (qs_shard_t *shard, const char *qt, int len, int *matched, long *cost)
+{
+    int count = 0;
+    // too short for trigrams, scan the vocabulary
+    int first_scanned = 0;
+    if (len >= 3 && shard->tri_keys) {
+        count = match_trigrams (shard, qt, len, matched);
+        first_scanned = shard->tri_token_count;
+    }
+    for (int t = first_scanned; t < shard->token_count; t++) {
+        qs_token_t *tok = &shard->tokens[t];
+        if (tok->len >= len && memmem (tok->text, tok->len, qt, len)) {
+            matched[count++] = t;
+        }
+    }
+    *cost = 0;
+    for (int i = 0; i < count; i++) {
+        *cost += shard->tokens[matched[i]].count;
+    }
+    return count;
+}
+
+static void
+shard_clear (qs_shard_t *shard)
+{
+    for (int i = 0; !shard->mapped && i < shard->token_count; i++) {
+        free (shard->tokens[i].text);
+        free (shard->tokens[i].postings);
+    }
+    free (shard->tokens);
+    shard->tokens = NULL;
+    shard->token_count = 0;
+    shard->token_alloc = 0;
+    free (shard->buckets);
+    shard->buckets = NULL;
+    shard->bucket_count = 0;
+    if (!shard->mapped) {
+        free (shard->tri_keys);
+        free (shard->tri_offsets);
+        free (shard->tri_tokens);
+    }
+    shard->tri_keys = NULL;
+    shard->tri_offsets = NULL;
+    shard->tri_tokens = NULL;
+    shard->tri_count = 0;
+    shard->tri_token_count = 0;
+    for (int i = 0; !shard->mapped && i < shard->column_count; i++) {
+        free (shard->columns[i].key);
+        free (shard->columns[i].text);
+        free (shard->columns[i].starts);
+        free (shard->columns[i].lens);
+    }
+    free (shard->columns);
+    shard->columns = NULL;
+    shard->column_count = 0;
+    shard->column_alloc = 0;
+    free (shard->marks);
+    shard->marks = NULL;
+    shard->serial = 0;
+    shard->built = 0;
+    shard->build_next = 0;
+    shard->mapped = 0;
+    shard->modified = 0;
+    forget_result (shard);
+}
+
+// drops the tracks of the shard as well
+static void
+shard_free (qs_shard_t *shard)
+{
+    shard_clear (shard);
+    free (shard->items);
+    free (shard->pos);
+    memset (shard, 0, sizeof (qs_shard_t));
+}
+
+static size_t
+shard_memory (qs_shard_t *shard)
+{
+    size_t size = sizeof (qs_shard_t);
+    size += shard->slot_alloc * (sizeof (DB_playItem_t *) + sizeof (uint32_t));
+    if (shard->marks) {
+        size += shard->slot_alloc * sizeof (uint32_t);
+    }
+    if (shard->mapped) {
+        // only the heap part, the rest is shared with the page cache
+        size += shard->token_count * sizeof (qs_token_t);
+        return size + shard->column_count * sizeof (qs_column_t);
+    }
+    for (int i = 0; i < shard->token_count; i++) {
+        size += shard->tokens[i].len + 1 + shard->tokens[i].alloc * sizeof (uint32_t);
+    }
+    size += shard->token_alloc * sizeof (qs_token_t);
+    size += shard->bucket_count * sizeof (int);
+    if (shard->tri_keys) {
+        size += shard->tri_count * (sizeof (uint32_t) + sizeof (int)) + sizeof (int);
+        size += shard->tri_offsets[shard->tri_count] * sizeof (int);
+    }
+    size += shard->column_alloc * sizeof (qs_column_t);
+    for (int i = 0; i < shard->column_count; i++) {
+        qs_column_t *col = &shard->columns[i];
+        size += strlen (col->key) + 1 + col->alloc + shard->slot_alloc * 2 * sizeof (uint32_t);
+    }
+    if (shard->last_query) {
+        size += strlen (shard->last_query) + 1 + shard->last_count * sizeof (uint32_t);
+    }
+    return size;
+}
+
+
+static uint64_t
+hash_bytes (uint64_t h, const void *data, size_t size)
+{
+    const unsigned char *p = data;
+    for (size_t i = 0; i < size; i++) {
+        h ^= p[i];
+        h *= 1099511628211ull;
+    }
+    return h;
+}
+
+// hashes the searchable metadata of the tracks in slot order, which is all
+// a shard without removed tracks is built from
+static uint64_t
+shard_fingerprint (qs_shard_t *shard)
+{
+    uint64_t h = 14695981039346656037ull;
+    uint32_t count = shard->count;
+    h = hash_bytes (h, &count, sizeof (count));
+    for (int i = 0; i < shard->count; i++) {
+        for (DB_metaInfo_t *m = deadbeef->pl_get_metadata_head (shard->items[i]); m; m = m->next) {
+            if (!qs_is_searchable_key (m->key)) {
+                continue;
+            }
+            h = hash_bytes (h, m->key, strlen (m->key) + 1);
+            for (const char *v = m->value; v; v = next_value (m, v)) {
+                h = hash_bytes (h, v, strlen (v) + 1);
+            }
+        }
+        h = hash_bytes (h, "", 1);
+    }
+    return h;
+}
+
+typedef struct {
+    char *data;
+    size_t size;
+    size_t alloc;
+    int failed;
+} qs_buf_t;
+
+static void
+buf_put_raw (qs_buf_t *buf, const void *data, size_t size)
+{
+    if (buf->failed) {
+        return;
+    }
+    if (buf->size + size > buf->alloc) {
+        size_t alloc = buf->alloc ? buf->alloc : 65536;
+        while (buf->size + size > alloc) {
+            alloc *= 2;
+        }
+        char *new_data = realloc (buf->data, alloc);
+        if (!new_data) {
+            buf->failed = 1;
+            return;
+        }
+        buf->data = new_data;
+        buf->alloc = alloc;
+    }
+    memcpy (buf->data + buf->size, data, size);
+    buf->size += size;
+}
+
+// pads to 4 bytes, so the arrays stay aligned when mapped
+static void
+buf_align (qs_buf_t *buf)
+{
+    static const char zeros[4];
+    buf_put_raw (buf, zeros, (4 - buf->size % 4) % 4);
+}
+
+static void
+buf_put (qs_buf_t *buf, const void *data, size_t size)
+{
+    buf_put_raw (buf, data, size);
+    buf_align (buf);
+}
+
+static void
+buf_put_u32 (qs_buf_t *buf, uint32_t value)
+{
+    buf_put (buf, &value, sizeof (value));
+}
+
+// record layout: counts, token texts, postings, trigram lists (unless
+// tri_count is UINT32_MAX) and the columns, see shard_load
+static int
+shard_save (qs_shard_t *shard, qs_buf_t *buf)
+{
+    buf->size = 0;
+    buf->failed = 0;
+    buf_put_u32 (buf, shard->count);
+    buf_put_u32 (buf, shard->token_count);
+    buf_put_u32 (buf, shard->tri_keys ? (uint32_t)shard->tri_count : UINT32_MAX);
+    buf_put_u32 (buf, shard->column_count);
+
+    uint32_t offset = 0;
+    for (int t = 0; t <= shard->token_count; t++) {
+        buf_put_u32 (buf, offset);
+        offset += t < shard->token_count ? shard->tokens[t].len + 1 : 0;
+    }
+    for (int t = 0; t < shard->token_count; t++) {
+        buf_put_raw (buf, shard->tokens[t].text, shard->tokens[t].len + 1);
+    }
+    buf_align (buf);
+
+    offset = 0;
+    for (int t = 0; t <= shard->token_count; t++) {
+        buf_put_u32 (buf, offset);
+        offset += t < shard->token_count ? shard->tokens[t].count : 0;
+    }
+    for (int t = 0; t < shard->token_count; t++) {
+        buf_put (buf, shard->tokens[t].postings, shard->tokens[t].count * sizeof (uint32_t));
+    }
+
+    if (shard->tri_keys) {
+        buf_put (buf, shard->tri_keys, shard->tri_count * sizeof (uint32_t));
+        buf_put (buf, shard->tri_offsets, (shard->tri_count + 1) * sizeof (int));
+        buf_put (buf, shard->tri_tokens, shard->tri_offsets[shard->tri_count] * sizeof (int));
+    }
+
+    for (int c = 0; c < shard->column_count; c++) {
+        qs_column_t *col = &shard->columns[c];
+        buf_put_u32 (buf, strlen (col->key) + 1);
+        buf_put (buf, col->key, strlen (col->key) + 1);
+        buf_put_u32 (buf, col->size);
+        buf_put (buf, col->text, col->size);
+        buf_put (buf, col->starts, shard->count * sizeof (uint32_t));
+        buf_put (buf, col->lens, shard->count * sizeof (uint32_t));
+    }
+    return buf->failed ? -1 : 0;
+}
+
+typedef struct {
+    const char *data;
+    size_t left;
+} qs_reader_t;
+
+static const void *
+get (qs_reader_t *r, size_t size)
+{
+    size_t padded = (size + 3) & ~(size_t)3;
+    if (padded < size || padded > r->left) {
+        return NULL;
+    }
+    const void *data = r->data;
+    r->data += padded;
+    r->left -= padded;
+    return data;
+}
+
+static const uint32_t *
+get_u32 (qs_reader_t *r, size_t count)
+{
+    if (count > SIZE_MAX / sizeof (uint32_t)) {
+        return NULL;
+    }
+    return get (r, count * sizeof (uint32_t));
+}
+
+// returns whether offsets[0..count] ascend from 0 and end at most at limit
+static int
+valid_offsets (const uint32_t *offsets, uint32_t count, uint32_t limit)
+{
+    if (offsets[0] != 0) {
+        return 0;
+    }
+    for (uint32_t i = 0; i < count; i++) {
+        if (offsets[i + 1] < offsets[i]) {
+            return 0;
+        }
+    }
+    return offsets[count] <= limit;
+}
+
+// points the shard at a record written by shard_save, checking everything
+// the queries rely on, so a damaged file can't make them read out of bounds
+static int
+shard_load (qs_shard_t *shard, const void *data, size_t size)
+{
+    qs_reader_t r = { data, size };
+    const uint32_t *counts = get_u32 (&r, 4);
+    if (!counts || counts[0] != (uint32_t)shard->count || counts[1] > INT32_MAX
+            || (counts[2] > INT32_MAX && counts[2] != UINT32_MAX) || counts[3] > INT32_MAX) {
+        return -1;
+    }
+    uint32_t token_count = counts[1];
+    uint32_t tri_count = counts[2];
+    uint32_t column_count = counts[3];
+
+    const uint32_t *text_offsets = get_u32 (&r, token_count + 1);
+    const char *texts = text_offsets ? get (&r, text_offsets[token_count]) : NULL;
+    if (!texts || !valid_offsets (text_offsets, token_count, UINT32_MAX)) {
+        return -1;
+    }
+    const uint32_t *posting_offsets = get_u32 (&r, token_count + 1);
+    const uint32_t *postings = posting_offsets ? get_u32 (&r, posting_offsets[token_count]) : NULL;
+    if (!postings || !valid_offsets (posting_offsets, token_count, UINT32_MAX)) {
+        return -1;
+    }
+    shard->tokens = calloc (token_count > 0 ? token_count : 1, sizeof (qs_token_t));
+    shard->columns = calloc (column_count > 0 ? column_count : 1, sizeof (qs_column_t));
+    shard->marks = calloc (shard->slot_alloc > 0 ? shard->slot_alloc : 1, sizeof (uint32_t));
+    // from here on shard_clear must not free what points into the file
+    shard->mapped = 1;
+    if (!shard->tokens || !shard->columns || !shard->marks) {
+        return -1;
+    }
+    for (uint32_t t = 0; t < token_count; t++) {
+        qs_token_t *tok = &shard->tokens[t];
+        uint32_t start = text_offsets[t];
+        uint32_t end = text_offsets[t + 1];
+        if (end == start || texts[end - 1] || memchr (texts + start, 0, end - start - 1)) {
+            return -1;
+        }
+        tok->text = (char *)texts + start;
+        tok->len = end - start - 1;
+        tok->postings = (uint32_t *)postings + posting_offsets[t];
+        tok->count = posting_offsets[t + 1] - posting_offsets[t];
+        for (int p = 0; p < tok->count; p++) {
+            if (tok->postings[p] >= (uint32_t)shard->count
+                    || (p && tok->postings[p] <= tok->postings[p - 1])) {
+                return -1;
+            }
+        }
+        shard->token_count++;
+    }
+
+    if (tri_count != UINT32_MAX) {
+        const uint32_t *keys = get_u32 (&r, tri_count);
+        const uint32_t *offsets = keys ? get_u32 (&r, tri_count + 1) : NULL;
+        const uint32_t *tokens = offsets ? get_u32 (&r, offsets[tri_count]) : NULL;
+        if (!tokens || !valid_offsets (offsets, tri_count, INT32_MAX)) {
+            return -1;
+        }
+        for (uint32_t i = 0; i < offsets[tri_count]; i++) {
+            if (tokens[i] >= token_count) {
+                return -1;
+            }
+        }
+        shard->tri_keys = (uint32_t *)keys;
+        shard->tri_offsets = (int *)offsets;
+        shard->tri_tokens = (int *)tokens;
+        shard->tri_count = tri_count;
+        shard->tri_token_count = token_count;
+    }
+
+    for (uint32_t c = 0; c < column_count; c++) {
+        qs_column_t *col = &shard->columns[c];
+        const uint32_t *key_size = get_u32 (&r, 1);
+        const char *key = key_size ? get (&r, *key_size) : NULL;
+        const uint32_t *text_size = key ? get_u32 (&r, 1) : NULL;
+        const char *text = text_size ? get (&r, *text_size) : NULL;
+        const uint32_t *starts = text ? get_u32 (&r, shard->count) : NULL;
+        const uint32_t *lens = starts ? get_u32 (&r, shard->count) : NULL;
+        if (!lens || !*key_size || key[*key_size - 1]) {
+            return -1;
+        }
+        // every value ends with a 0, which stops strtol on range queries
+        for (int i = 0; i < shard->count; i++) {
+            uint64_t end = (uint64_t)starts[i] + lens[i];
+            if (lens[i] && (end > *text_size || text[end - 1])) {
+                return -1;
+            }
+        }
+        col->key = (char *)key;
+        col->text = (char *)text;
+        col->size = *text_size;
+        col->starts = (uint32_t *)starts;
+        col->lens = (uint32_t *)lens;
+        shard->column_count++;
+    }
+    return r.left ? -1 : 0;
+}
+
+// adds the searchable metadata of the track in the slot to the columns and
+// the vocabulary
+static int
+add_content (qs_shard_t *shard, int slot)
+{
+    for (DB_metaInfo_t *m = deadbeef->pl_get_metadata_head (shard->items[slot]); m; m = m->next) {
+        if (!qs_is_searchable_key (m->key)) {
+            continue;
+        }
+        qs_column_t *col = shard_column (shard, m->key);
+        if (!col) {
+            return -1;
+        }
+        for (const char *v = m->value; v; v = next_value (m, v)) {
+            const char *value = searchable_value (m, v);
+            long offset = append_value (col, slot, value, strlen (value));
+            if (offset < 0) {
+                return -1;
+            }
+            index_text (shard, slot, col->text + offset, 0);
+        }
+    }
+    return 0;
+}
+
+// moves the values still in use to the front of the column
+static void
+compact_column (qs_column_t *col, int count)
+{
+    char *text = malloc (col->size - col->garbage > 0 ? col->size - col->garbage : 1);
+    if (!text) {
+        return;
+    }
+    size_t size = 0;
+    for (int i = 0; i < count; i++) {
+        memcpy (text + size, col->text + col->starts[i], col->lens[i]);
+        col->starts[i] = col->lens[i] ? size : 0;
+        size += col->lens[i];
+    }
+    free (col->text);
+    col->text = text;
+    col->size = size;
+    col->alloc = size > 0 ? size : 1;
+    col->garbage = 0;
+}
+
+// removes the values of the track in the slot from the columns and its slot
+// from the postings
+static void
+remove_content (qs_shard_t *shard, int slot)
+{
+    for (int c = 0; c < shard->column_count; c++) {
+        qs_column_t *col = &shard->columns[c];
+        const char *value = col->text + col->starts[slot];
+        const char *end = value + col->lens[slot];
+        while (value < end) {
+            index_text (shard, slot, value, 1);
+            value += strlen (value) + 1;
+        }
+        col->garbage += col->lens[slot];
+        col->lens[slot] = 0;
+        if (col->garbage > 65536 && col->garbage > col->size / 2) {
+            compact_column (col, shard->count);
+        }
+    }
+}
+
+static int
+cmp_uint64 (const void *a, const void *b)
+{
+    uint64_t x = *(const uint64_t *)a;
+    uint64_t y = *(const uint64_t *)b;
+    return x < y ? -1 : x > y;
+}
+
+// drops the slots of removed tracks and orders the others by position, which
+// requires building the shard again
+static int
+compact_slots (qs_plt_index_t *idx, int s)
+{
+    qs_shard_t *shard = &idx->shards[s];
+    // position and slot of each track, sorting them gives the new order
+    uint64_t *order = malloc ((shard->live > 0 ? shard->live : 1) * sizeof (uint64_t));
+    if (!order) {
+        return -1;
+    }
+    int n = 0;
+    for (int i = 0; i < shard->count; i++) {
+        if (shard->items[i]) {
+            order[n++] = (uint64_t)shard->pos[i] << 32 | i;
+        }
+    }
+    qsort (order, n, sizeof (uint64_t), cmp_uint64);
+    shard_clear (shard);
+    DB_playItem_t **items = malloc ((n > 0 ? n : 1) * sizeof (DB_playItem_t *));
+    if (!items) {
+        free (order);
+        return -1;
+    }
+    for (int i = 0; i < n; i++) {
+        items[i] = shard->items[(uint32_t)order[i]];
+        shard->pos[i] = order[i] >> 32;
+        idx->locs[shard->pos[i]].shard = s;
+        idx->locs[shard->pos[i]].slot = i;
+    }
+    memcpy (shard->items, items, n * sizeof (DB_playItem_t *));
+    free (items);
+    free (order);
+    shard->count = n;
+    shard->live = n;
+    shard->ordered = 1;
+    return 0;
+}
+
+// starts building the shard, returns 1 if it got mapped from the index
+// file, 0 if its tracks have to be tokenized and -1 on failure
+static int
+build_begin (qs_plt_index_t *idx, qs_shard_t *shard)
+{
+    shard_clear (shard);
+    if (shard->live < shard->count && compact_slots (idx, shard - idx->shards) < 0) {
+        return -1;
+    }
+    uint64_t fingerprint = shard_fingerprint (shard);
+    size_t size;
+    const void *record = qs_store_find (fingerprint, &size);
+    if (record) {
+        if (shard_load (shard, record, size) == 0) {
+            shard->fingerprint = fingerprint;
+            shard->built = 1;
+            trace ("quick_search: mapped %d tracks, %d tokens\n", shard->count, shard->token_count);
+            return 1;
+        }
+        trace ("quick_search: ignoring damaged index record\n");
+        shard_clear (shard);
+    }
+    shard->fingerprint = fingerprint;
+    shard->marks = calloc (shard->slot_alloc > 0 ? shard->slot_alloc : 1, sizeof (uint32_t));
+    if (!shard->marks) {
+        shard_clear (shard);
+        return -1;
+    }
+    return 0;
+}
+
+// tokenizes the tracks up to the slot end
+static int
+build_tracks (qs_shard_t *shard, int end)
+{
+    for (; shard->build_next < end; shard->build_next++) {
+        if (add_content (shard, shard->build_next) < 0) {
+            shard_clear (shard);
+            return -1;
+        }
+    }
+    return 0;
+}
+
+static void
+build_finish (qs_shard_t *shard)
+{
+    for (int c = 0; c < shard->column_count; c++) {
+        finish_column (&shard->columns[c]);
+    }
+    if (build_trigrams (shard) < 0) {
+        // the vocabulary can still be scanned
+        free (shard->tri_keys);
+        shard->tri_keys = NULL;
+        free (shard->tri_offsets);
+        shard->tri_offsets = NULL;
+        free (shard->tri_tokens);
+        shard->tri_tokens = NULL;
+        shard->tri_count = 0;
+        shard->tri_token_count = 0;
+    }
+    shard->built = 1;
+    trace ("quick_search: indexed %d tracks, %d tokens, %d trigrams, %zu bytes\n",
+            shard->count, shard->token_count, shard->tri_count, shard_memory (shard));
+}
+
+// only reads the metadata of the tracks, see qs_index_query_shard. After
+// that all matching is done on the columns of the shard. Shards whose tracks
+// didn't change since the index file got saved are mapped from it.
+static int
+shard_build (qs_plt_index_t *idx, qs_shard_t *shard)
+{
+    int res = build_begin (idx, shard);
+    if (res != 0) {
+        return res < 0 ? -1 : 0;
+    }
+    if (build_tracks (shard, shard->count) < 0) {
+        return -1;
+    }
+    build_finish (shard);
+    return 0;
+}
+
+// rebuilds the trigram lists once enough tokens were added after building
+// them, until then the new tokens get scanned
+static void
+refresh_trigrams (qs_shard_t *shard)
+{
+    int added = shard->token_count - shard->tri_token_count;
+    if (added < 256 || added < shard->tri_token_count / 8) {
+        return;
+    }
+    free (shard->tri_keys);
+    free (shard->tri_offsets);
+    free (shard->tri_tokens);
+    shard->tri_keys = NULL;
+    shard->tri_offsets = NULL;
+    shard->tri_tokens = NULL;
+    shard->tri_count = 0;
+    shard->tri_token_count = 0;
+    if (build_trigrams (shard) < 0) {
+        free (shard->tri_keys);
+        shard->tri_keys = NULL;
+        free (shard->tri_offsets);
+        shard->tri_offsets = NULL;
+        free (shard->tri_tokens);
+        shard->tri_tokens = NULL;
+        shard->tri_count = 0;
+        shard->tri_token_count = 0;
+    }
+}
+
+// prepares a built shard for a change of its tracks, returns 0 if the
+// change has to be applied to its tokens and columns. Mapped shards are
+// dropped instead and rebuilt by the next query.
+static int
+begin_change (qs_shard_t *shard)
+{
+    // a shard built in steps starts over
+    if (shard->mapped || (!shard->built && shard->build_next)) {
+        shard_clear (shard);
+    }
+    if (!shard->built) {
+        return -1;
+    }
+    forget_result (shard);
+    shard->modified = 1;
+    return 0;
+}
+
+static int
+grow_slots (qs_shard_t *shard)
+{
+    int alloc = shard->slot_alloc ? shard->slot_alloc * 2 : 256;
+    if (alloc > SHARD_SIZE) {
+        alloc = SHARD_SIZE;
+    }
+    DB_playItem_t **items = realloc (shard->items, alloc * sizeof (DB_playItem_t *));
+    if (!items) {
+        return -1;
+    }
+    shard->items = items;
+    uint32_t *pos = realloc (shard->pos, alloc * sizeof (uint32_t));
+    if (!pos) {
+        return -1;
+    }
+    shard->pos = pos;
+    if (shard->marks) {
+        uint32_t *marks = realloc (shard->marks, alloc * sizeof (uint32_t));
+        if (!marks) {
+            return -1;
+        }
+        memset (marks + shard->slot_alloc, 0, (alloc - shard->slot_alloc) * sizeof (uint32_t));
+        shard->marks = marks;
+    }
+    for (int c = 0; c < shard->column_count; c++) {
+        qs_column_t *col = &shard->columns[c];
+        uint32_t *starts = realloc (col->starts, alloc * sizeof (uint32_t));
+        if (!starts) {
+            return -1;
+        }
+        col->starts = starts;
+        uint32_t *lens = realloc (col->lens, alloc * sizeof (uint32_t));
+        if (!lens) {
+            return -1;
+        }
+        col->lens = lens;
+        memset (col->starts + shard->slot_alloc, 0, (alloc - shard->slot_alloc) * sizeof (uint32_t));
+        memset (col->lens + shard->slot_alloc, 0, (alloc - shard->slot_alloc) * sizeof (uint32_t));
+    }
+    shard->slot_alloc = alloc;
+    return 0;
+}
+
+// puts the track at pos into a new slot, returns the slot or -1
+static int
+add_slot (qs_shard_t *shard, DB_playItem_t *it, uint32_t pos)
+{
+    // the columns of a mapped shard can't grow
+    if (shard->mapped) {
+        shard_clear (shard);
+    }
+    if (shard->count >= shard->slot_alloc && grow_slots (shard) < 0) {
+        return -1;
+    }
+    int slot = shard->count++;
+    shard->items[slot] = it;
+    shard->pos[slot] = pos;
+    shard->live++;
+    if (begin_change (shard) == 0) {
+        if (add_content (shard, slot) < 0) {
+            shard_clear (shard);
+        }
+        else {
+            refresh_trigrams (shard);
+        }
+    }
+    return slot;
+}
+
+static void
+remove_slot (qs_shard_t *shard, int slot)
+{
+    if (begin_change (shard) == 0) {
+        remove_content (shard, slot);
+    }
+    shard->items[slot] = NULL;
+    shard->pos[slot] = UINT32_MAX;
+    shard->live--;
+}
+
+static void
+index_clear (qs_plt_index_t *idx)
+{
+    for (int i = 0; i < idx->item_count; i++) {
+        deadbeef->pl_item_unref (idx->items[i]);
+    }
+    free (idx->items);
+    idx->items = NULL;
+    free (idx->locs);
+    idx->locs = NULL;
+    idx->item_count = 0;
+    free (idx->map_keys);
+    idx->map_keys = NULL;
+    free (idx->map_positions);
+    idx->map_positions = NULL;
+    idx->map_size = 0;
+    for (int i = 0; i < idx->shard_count; i++) {
+        shard_free (&idx->shards[i]);
+    }
+    free (idx->shards);
+    idx->shards = NULL;
+    idx->shard_count = 0;
+    idx->shard_alloc = 0;
+    qs_set_free (idx->result);
+    idx->result = NULL;
+}
+
+static uint32_t
+hash_item (DB_playItem_t *it)
+{
+    uint64_t v = (uintptr_t)it;
+    return (uint32_t)((v * 0x9e3779b97f4a7c15ull) >> 32);
+}
+
+// maps the tracks of the index to their positions
+static int
+map_build (qs_plt_index_t *idx)
+{
+    int size = 1024;
+    while (size < idx->item_count * 2) {
+        size *= 2;
+    }
+    if (size != idx->map_size) {
+        free (idx->map_keys);
+        free (idx->map_positions);
+        idx->map_keys = malloc (size * sizeof (DB_playItem_t *));
+        idx->map_positions = malloc (size * sizeof (uint32_t));
+        idx->map_size = size;
+        if (!idx->map_keys || !idx->map_positions) {
+            free (idx->map_keys);
+            idx->map_keys = NULL;
+            free (idx->map_positions);
+            idx->map_positions = NULL;
+            idx->map_size = 0;
+            return -1;
+        }
+    }
+    memset (idx->map_keys, 0, size * sizeof (DB_playItem_t *));
+    for (int i = 0; i < idx->item_count; i++) {
+        uint32_t b = hash_item (idx->items[i]) & (size - 1);
+        while (idx->map_keys[b]) {
+            b = (b + 1) & (size - 1);
+        }
+        idx->map_keys[b] = idx->items[i];
+        idx->map_positions[b] = i;
+    }
+    return 0;
+}
+
+static int
+map_find (qs_plt_index_t *idx, DB_playItem_t *it)
+{
+    if (!idx->map_size) {
+        return -1;
+    }
+    uint32_t b = hash_item (it) & (idx->map_size - 1);
+    while (idx->map_keys[b]) {
+        if (idx->map_keys[b] == it) {
+            return idx->map_positions[b];
+        }
+        b = (b + 1) & (idx->map_size - 1);
+    }
+    return -1;
+}
+
+// updates the order flags of the shards and of the index
+static void
+check_order (qs_plt_index_t *idx)
+{
+    idx->ordered = 1;
+    int64_t last = -1;
+    for (int s = 0; s < idx->shard_count; s++) {
+        qs_shard_t *shard = &idx->shards[s];
+        shard->ordered = 1;
+        int64_t prev = -1;
+        for (int i = 0; i < shard->count; i++) {
+            if (!shard->items[i]) {
+                continue;
+            }
+            if ((int64_t)shard->pos[i] < prev) {
+                shard->ordered = 0;
+            }
+            if ((int64_t)shard->pos[i] < last) {
+                idx->ordered = 0;
+            }
+            prev = shard->pos[i];
+        }
+        if (prev > last) {
+            last = prev;
+        }
+        if (!shard->ordered) {
+            idx->ordered = 0;
+        }
+    }
+}
+
+static qs_shard_t *
+add_shard (qs_plt_index_t *idx)
+{
+    if (idx->shard_count >= idx->shard_alloc) {
+        int alloc = idx->shard_alloc ? idx->shard_alloc * 2 : 4;
+        qs_shard_t *shards = realloc (idx->shards, alloc * sizeof (qs_shard_t));
+        if (!shards) {
+            return NULL;
+        }
+        idx->shards = shards;
+        idx->shard_alloc = alloc;
+    }
+    qs_shard_t *shard = &idx->shards[idx->shard_count++];
+    memset (shard, 0, sizeof (qs_shard_t));
+    shard->ordered = 1;
+    return shard;
+}
+
+// returns the tracks of the playlist, each holding a reference
+static DB_playItem_t **
+get_items (ddb_playlist_t *plt, int *count)
+{
+    *count = deadbeef->plt_get_item_count (plt, PL_MAIN);
+    DB_playItem_t **items = malloc ((*count > 0 ? *count : 1) * sizeof (DB_playItem_t *));
+    if (!items) {
+        return NULL;
+    }
+    int n = 0;
+    DB_playItem_t *it = deadbeef->plt_get_first (plt, PL_MAIN);
+    while (it && n < *count) {
+        items[n++] = it;
+        it = deadbeef->pl_get_next (it, PL_MAIN);
+    }
+    if (it) {
+        deadbeef->pl_item_unref (it);
+    }
+    *count = n;
+    return items;
+}
+
+// collects the tracks of the playlist into shards of consecutive tracks,
+// which get tokenized on demand
+static void
+index_collect (qs_plt_index_t *idx)
+{
+    index_clear (idx);
+
+    int count;
+    idx->items = get_items (idx->plt, &count);
+    idx->locs = malloc ((count > 0 ? count : 1) * sizeof (qs_loc_t));
+    if (!idx->items || !idx->locs) {
+        index_clear (idx);
+        return;
+    }
+    idx->item_count = count;
+    for (int first = 0; first < count; first += SHARD_SIZE) {
+        qs_shard_t *shard = add_shard (idx);
+        int n = count - first < SHARD_SIZE ? count - first : SHARD_SIZE;
+        if (!shard || !(shard->items = malloc (n * sizeof (DB_playItem_t *)))
+                || !(shard->pos = malloc (n * sizeof (uint32_t)))) {
+            index_clear (idx);
+            return;
+        }
+        shard->slot_alloc = n;
+        for (int i = 0; i < n; i++) {
+            shard->items[i] = idx->items[first + i];
+            shard->pos[i] = first + i;
+            idx->locs[first + i].shard = idx->shard_count - 1;
+            idx->locs[first + i].slot = i;
+        }
+        shard->count = n;
+        shard->live = n;
+    }
+    if (map_build (idx) < 0) {
+        index_clear (idx);
+        return;
+    }
+    idx->ordered = 1;
+    idx->mod_idx = deadbeef->plt_get_modification_idx (idx->plt);
+    idx->dirty = 0;
+}
+
+// brings the index up to date with the playlist after tracks got added,
+// removed or moved. Tracks which stayed keep their slots, only the added and
+// removed ones change the tokens of their shards.
+static int
+index_sync (qs_plt_index_t *idx)
+{
+    int count;
+    DB_playItem_t **items = get_items (idx->plt, &count);
+    qs_loc_t *locs = malloc ((count > 0 ? count : 1) * sizeof (qs_loc_t));
+    unsigned char *kept = calloc (idx->item_count > 0 ? idx->item_count : 1, 1);
+    if (!items || !locs || !kept) {
+        for (int i = 0; items && i < count; i++) {
+            deadbeef->pl_item_unref (items[i]);
+        }
+        free (items);
+        free (locs);
+        free (kept);
+        return -1;
+    }
+
+    int added = 0;
+    for (int i = 0; i < count; i++) {
+        int old = map_find (idx, items[i]);
+        if (old >= 0) {
+            kept[old] = 1;
+            locs[i] = idx->locs[old];
+        }
+        else {
+            locs[i].shard = UINT32_MAX;
+            added++;
+        }
+    }
+    int removed = 0;
+    for (int i = 0; i < idx->item_count; i++) {
+        if (!kept[i]) {
+            remove_slot (&idx->shards[idx->locs[i].shard], idx->locs[i].slot);
+            removed++;
+        }
+    }
+    free (kept);
+    for (int i = 0; i < count; i++) {
+        if (locs[i].shard != UINT32_MAX) {
+            idx->shards[locs[i].shard].pos[locs[i].slot] = i;
+        }
+    }
+
+    // the old positions aren't needed anymore
+    for (int i = 0; i < idx->item_count; i++) {
+        deadbeef->pl_item_unref (idx->items[i]);
+    }
+    free (idx->items);
+    free (idx->locs);
+    idx->items = items;
+    idx->locs = locs;
+    idx->item_count = count;
+
+    int res = 0;
+    for (int i = 0; i < count && added > 0; i++) {
+        if (locs[i].shard != UINT32_MAX) {
+            continue;
+        }
+        qs_shard_t *shard = idx->shard_count ? &idx->shards[idx->shard_count - 1] : NULL;
+        if (!shard || shard->count >= SHARD_SIZE) {
+            shard = add_shard (idx);
+        }
+        int slot = shard ? add_slot (shard, items[i], i) : -1;
+        if (slot < 0) {
+            res = -1;
+            break;
+        }
+        locs[i].shard = shard - idx->shards;
+        locs[i].slot = slot;
+    }
+    for (int s = 0; res == 0 && s < idx->shard_count; s++) {
+        qs_shard_t *shard = &idx->shards[s];
+        if (shard->live < shard->count / 2 || (!shard->built && shard->live < shard->count)) {
+            res = compact_slots (idx, s);
+        }
+    }
+    if (res == 0) {
+        res = map_build (idx);
+    }
+    check_order (idx);
+    idx->mod_idx = deadbeef->plt_get_modification_idx (idx->plt);
+    trace ("quick_search: synced index, %d tracks added, %d removed\n", added, removed);
+    return res;
+}
+
+qs_plt_index_t *
+qs_index_prepare (ddb_playlist_t *plt)
+{
+    if (!plt) {
+        return NULL;
+    }
+    qs_plt_index_t *idx = indexes;
+    while (idx && idx->plt != plt) {
+        idx = idx->next;
+    }
+    if (!idx) {
+        idx = calloc (1, sizeof (qs_plt_index_t));
+        if (!idx) {
+            return NULL;
+        }
+        idx->plt = plt;
+        deadbeef->plt_ref (plt);
+        idx->dirty = 1;
+        idx->next = indexes;
+        indexes = idx;
+    }
+    if (idx->readers) {
+        // can't catch up with the playlist while it's being queried
+        return NULL;
+    }
+    for (int i = 0; i < idx->shard_count; i++) {
+        qs_shard_t *shard = &idx->shards[i];
+        if (shard->outdated) {
+            shard_clear (shard);
+            shard->outdated = 0;
+            shard->modified = 1;
+        }
+    }
+    if (idx->dirty || !idx->map_size) {
+        index_collect (idx);
+    }
+    else if (idx->mod_idx != deadbeef->plt_get_modification_idx (plt) && index_sync (idx) < 0) {
+        index_collect (idx);
+    }
+    return idx->shards ? idx : NULL;
+}
+
+qs_plt_index_t *
+qs_index_get (ddb_playlist_t *plt)
+{
+    qs_plt_index_t *idx = qs_index_prepare (plt);
+    if (!idx) {
+        return NULL;
+    }
+    for (int i = 0; i < idx->shard_count; i++) {
+        if (!idx->shards[i].built && shard_build (idx, &idx->shards[i]) < 0) {
+            return NULL;
+        }
+    }
+    return idx;
+}
+
+int
+qs_index_shard_count (qs_plt_index_t *idx)
+{
+    return idx ? idx->shard_count : 0;
+}
+
+int
+qs_index_is_built (qs_plt_index_t *idx)
+{
+    for (int i = 0; idx && i < idx->shard_count; i++) {
+        if (!idx->shards[i].built) {
+            return 0;
+        }
+    }
+    return idx != NULL;
+}
+
+void
+qs_index_hold (qs_plt_index_t *idx)
+{
+    idx->readers++;
+}
+
+int
+qs_index_release (qs_plt_index_t *idx)
+{
+    int changed = idx->held_changes;
+    if (--idx->readers == 0) {
+        idx->held_changes = 0;
+    }
+    return changed;
+}
+
+int
+qs_index_build_shard (qs_plt_index_t *idx, int shard_idx, int max_tracks)
+{
+    if (!idx || shard_idx < 0 || shard_idx >= idx->shard_count) {
+        return -1;
+    }
+    qs_shard_t *shard = &idx->shards[shard_idx];
+    if (shard->built) {
+        return 1;
+    }
+    if (!shard->build_next) {
+        int res = build_begin (idx, shard);
+        if (res != 0) {
+            return res;
+        }
+    }
+    int end = shard->build_next + (max_tracks > 0 ? max_tracks : 1);
+    if (build_tracks (shard, end < shard->count ? end : shard->count) < 0) {
+        return -1;
+    }
+    if (shard->build_next < shard->count) {
+        return 0;
+    }
+    build_finish (shard);
+    return 1;
+}
+
+static int
+cmp_uint32 (const void *a, const void *b)
+{
+    uint32_t x = *(const uint32_t *)a;
+    uint32_t y = *(const uint32_t *)b;
+    return x < y ? -1 : x > y;
+}
+
+static int
+value_matches (qs_column_t *col, int slot, const char *query, int query_len)
+{
+    return col->lens[slot] && qs_match (col->text + col->starts[slot], col->lens[slot], query, query_len);
+}
+
+// checks the full query against the folded fields of the track in the slot,
+// the 0 bytes between multiple values never match
+static int
+track_matches (qs_shard_t *shard, uint32_t slot, const char *query, int query_len)
+{
+    for (int c = 0; c < shard->column_count; c++) {
+        if (value_matches (&shard->columns[c], slot, query, query_len)) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static int
+lookup (qs_shard_t *shard, const char *query, uint32_t **hits)
+{
+    int starts[MAX_QUERY_TOKENS];
+    int lens[MAX_QUERY_TOKENS];
+    int qcount = split_tokens (query, starts, lens, MAX_QUERY_TOKENS);
+    if (!qcount) {
+        // only separators, nothing the index can resolve
+        return -1;
+    }
+
+    // every query token has to be a substring of some token of a matching
+    // track, collect the vocabulary entries per query token and their cost
+    int *matched[MAX_QUERY_TOKENS];
+    int matched_count[MAX_QUERY_TOKENS];
+    long cost[MAX_QUERY_TOKENS];
+    int order[MAX_QUERY_TOKENS];
+    for (int q = 0; q < qcount; q++) {
+        matched[q] = NULL;
+        matched_count[q] = 0;
+        cost[q] = 0;
+        order[q] = q;
+    }
+    for (int q = 0; q < qcount; q++) {
+        matched[q] = malloc (shard->token_count > 0 ? shard->token_count * sizeof (int) : sizeof (int));
+        if (!matched[q]) {
+            qcount = q;
+            goto error;
+        }
+        matched_count[q] = match_tokens (shard, query + starts[q], lens[q], matched[q], &cost[q]);
+    }
+
+    // start with the most selective query token
+    for (int i = 1; i < qcount; i++) {
+        int o = order[i];
+        int j = i;
+        while (j > 0 && cost[order[j - 1]] > cost[o]) {
+            order[j] = order[j - 1];
+            j--;
+        }
+        order[j] = o;
+    }
+
+    int first = order[0];
+    uint32_t *candidates = malloc ((cost[first] > 0 ? cost[first] : 1) * sizeof (uint32_t));
+    if (!candidates) {
+        goto error;
+    }
+    int count = 0;
+    for (int i = 0; i < matched_count[first]; i++) {
+        qs_token_t *tok = &shard->tokens[matched[first][i]];
+        memcpy (candidates + count, tok->postings, tok->count * sizeof (uint32_t));
+        count += tok->count;
+    }
+    if (matched_count[first] > 1) {
+        qsort (candidates, count, sizeof (uint32_t), cmp_uint32);
+        int unique = 0;
+        for (int i = 0; i < count; i++) {
+            if (!unique || candidates[unique - 1] != candidates[i]) {
+                candidates[unique++] = candidates[i];
+            }
+        }
+        count = unique;
+    }
+
+    // intersect with the other query tokens as long as that's cheaper than
+    // verifying the candidates
+    for (int i = 1; i < qcount && count > 0; i++) {
+        int q = order[i];
+        if (cost[q] > (long)count * 8) {
+            break;
+        }
+        if (++shard->serial == 0) {
+            memset (shard->marks, 0, shard->slot_alloc * sizeof (uint32_t));
+            shard->serial = 1;
+        }
+        for (int k = 0; k < matched_count[q]; k++) {
+            qs_token_t *tok = &shard->tokens[matched[q][k]];
+            for (int p = 0; p < tok->count; p++) {
+                shard->marks[tok->postings[p]] = shard->serial;
+            }
+        }
+        int kept = 0;
+        for (int c = 0; c < count; c++) {
+            if (shard->marks[candidates[c]] == shard->serial) {
+                candidates[kept++] = candidates[c];
+            }
+        }
+        count = kept;
+    }
+
+    // a single token query is fully answered by the vocabulary lookup,
+    // anything else has to be checked against the actual field values
+    int query_len = strlen (query);
+    if (qcount > 1 || lens[0] != query_len) {
+        int kept = 0;
+        for (int c = 0; c < count; c++) {
+            if (track_matches (shard, candidates[c], query, query_len)) {
+                candidates[kept++] = candidates[c];
+            }
+        }
+        count = kept;
+    }
+
+    for (int q = 0; q < qcount; q++) {
+        free (matched[q]);
+    }
+    *hits = candidates;
+    return count;
+
+error:
+    for (int q = 0; q < qcount; q++) {
+        free (matched[q]);
+    }
+    return -1;
+}
+
+// narrows the result of the previous query down to the tracks matching
+// query, which has to contain the previous query
+static int
+refine (qs_shard_t *shard, const char *query, uint32_t **hits)
+{
+    uint32_t *candidates = malloc ((shard->last_count > 0 ? shard->last_count : 1) * sizeof (uint32_t));
+    if (!candidates) {
+        return -1;
+    }
+    int count = 0;
+    int query_len = strlen (query);
+    for (int i = 0; i < shard->last_count; i++) {
+        if (track_matches (shard, shard->last_hits[i], query, query_len)) {
+            candidates[count++] = shard->last_hits[i];
+        }
+    }
+    *hits = candidates;
+    return count;
+}
+
+// checks every track of the shard, for queries the index can't resolve. The
+// slots of removed tracks have no values left, so they never match.
+static int
+scan (qs_shard_t *shard, const char *query, uint32_t **hits)
+{
+    uint32_t *candidates = malloc ((shard->count > 0 ? shard->count : 1) * sizeof (uint32_t));
+    if (!candidates) {
+        return -1;
+    }
+    if (++shard->serial == 0) {
+        memset (shard->marks, 0, shard->slot_alloc * sizeof (uint32_t));
+        shard->serial = 1;
+    }
+    // one column after the other, skipping tracks which already matched
+    int query_len = strlen (query);
+    for (int c = 0; c < shard->column_count; c++) {
+        qs_column_t *col = &shard->columns[c];
+        for (int i = 0; i < shard->count; i++) {
+            if (shard->marks[i] != shard->serial && value_matches (col, i, query, query_len)) {
+                shard->marks[i] = shard->serial;
+            }
+        }
+    }
+    int count = 0;
+    for (int i = 0; i < shard->count; i++) {
+        if (shard->marks[i] == shard->serial) {
+            candidates[count++] = i;
+        }
+    }
+    *hits = candidates;
+    return count;
+}
+
+// returns the number of tracks an index lookup of text yields at most, or -1
+// if text has no words to look up
+static long
+estimate (qs_shard_t *shard, const char *text)
+{
+    int starts[MAX_QUERY_TOKENS];
+    int lens[MAX_QUERY_TOKENS];
+    int count = split_tokens (text, starts, lens, MAX_QUERY_TOKENS);
+    if (!count) {
+        return -1;
+    }
+    int *matched = malloc ((shard->token_count > 0 ? shard->token_count : 1) * sizeof (int));
+    if (!matched) {
+        return -1;
+    }
+    long best = -1;
+    for (int i = 0; i < count; i++) {
+        long cost;
+        match_tokens (shard, text + starts[i], lens[i], matched, &cost);
+        if (best < 0 || cost < best) {
+            best = cost;
+        }
+    }
+    free (matched);
+    return best;
+}
+
+// a predicate of a query resolved against a shard
+typedef struct {
+    const qs_pred_t *pred;
+    int keys[MAX_PRED_KEYS];
+    int key_count;
+    long estimate;
+} qs_pred_run_t;
+
+static int
+pred_matches (qs_shard_t *shard, uint32_t slot, const qs_pred_run_t *run)
+{
+    const qs_pred_t *pred = run->pred;
+    int match = 0;
+    if (!pred->fields) {
+        match = track_matches (shard, slot, pred->text, pred->text_len);
+    }
+    for (int k = 0; k < run->key_count && !match; k++) {
+        qs_column_t *col = &shard->columns[run->keys[k]];
+        if (pred->type == QS_PRED_TEXT) {
+            match = value_matches (col, slot, pred->text, pred->text_len);
+        }
+        else if (col->lens[slot]) {
+            const char *value = col->text + col->starts[slot];
+            char *end;
+            long number = strtol (value, &end, 10);
+            match = end != value && number >= pred->lo && number <= pred->hi;
+        }
+    }
+    return match != pred->negate;
+}
+
+// finds the columns of the shard the predicate refers to
+static void
+resolve_keys (qs_shard_t *shard, qs_pred_run_t *run)
+{
+    run->key_count = 0;
+    if (!run->pred->fields) {
+        return;
+    }
+    for (int c = 0; c < shard->column_count && run->key_count < MAX_PRED_KEYS; c++) {
+        for (int f = 0; run->pred->fields[f]; f++) {
+            if (!strcasecmp (shard->columns[c].key, run->pred->fields[f])) {
+                run->keys[run->key_count++] = c;
+                break;
+            }
+        }
+    }
+}
+
+// finds the tracks matching all predicates of alt. The index resolves the
+// most selective predicate, the candidates are then checked against the
+// others in the order of their selectivity, stopping at the first one that
+// doesn't match.
+static int
+run_alt (qs_shard_t *shard, const qs_alt_t *alt, uint32_t **hits)
+{
+    qs_pred_run_t *runs = malloc ((alt->pred_count > 0 ? alt->pred_count : 1) * sizeof (qs_pred_run_t));
+    if (!runs) {
+        return -1;
+    }
+    int run_count = 0;
+    int driver = -1;
+    for (int p = 0; p < alt->pred_count; p++) {
+        qs_pred_run_t *run = &runs[run_count];
+        run->pred = &alt->preds[p];
+        resolve_keys (shard, run);
+        if (run->pred->fields && !run->key_count) {
+            if (!run->pred->negate) {
+                // no track of the shard has that field
+                free (runs);
+                *hits = NULL;
+                return 0;
+            }
+            continue;
+        }
+        run->estimate = shard->live;
+        if (!run->pred->negate && run->pred->type == QS_PRED_TEXT) {
+            long e = estimate (shard, run->pred->text);
+            if (e >= 0) {
+                run->estimate = e;
+                if (driver < 0 || e < runs[driver].estimate) {
+                    driver = run_count;
+                }
+            }
+        }
+        else if (run->pred->negate) {
+            // excludes few tracks, unless it happens to be very common
+            run->estimate = shard->live + 1;
+        }
+        run_count++;
+    }
+
+    uint32_t *candidates = NULL;
+    int count;
+    if (driver >= 0) {
+        count = lookup (shard, runs[driver].pred->text, &candidates);
+        if (count < 0) {
+            free (runs);
+            return -1;
+        }
+        // the lookup covers all fields, a field predicate still has to be
+        // checked
+        if (!runs[driver].pred->fields) {
+            runs[driver] = runs[--run_count];
+        }
+    }
+    else {
+        candidates = malloc ((shard->count > 0 ? shard->count : 1) * sizeof (uint32_t));
+        if (!candidates) {
+            free (runs);
+            return -1;
+        }
+        count = 0;
+        for (int i = 0; i < shard->count; i++) {
+            if (shard->items[i]) {
+                candidates[count++] = i;
+            }
+        }
+    }
+
+    for (int i = 1; i < run_count; i++) {
+        qs_pred_run_t r = runs[i];
+        int j = i;
+        while (j > 0 && runs[j - 1].estimate > r.estimate) {
+            runs[j] = runs[j - 1];
+            j--;
+        }
+        runs[j] = r;
+    }
+
+    int kept = 0;
+    for (int c = 0; c < count; c++) {
+        int p = 0;
+        while (p < run_count && pred_matches (shard, candidates[c], &runs[p])) {
+            p++;
+        }
+        if (p == run_count) {
+            candidates[kept++] = candidates[c];
+        }
+    }
+    free (runs);
+    *hits = candidates;
+    return kept;
+}
+
+// runs a query using the query syntax, the hits of its alternatives are
+// merged in slot order
+static int
+run_query (qs_shard_t *shard, const qs_query_t *query, uint32_t **hits)
+{
+    if (query->alt_count == 1) {
+        return run_alt (shard, &query->alts[0], hits);
+    }
+    qs_set_t *result = qs_set_new ();
+    for (int a = 0; result && a < query->alt_count; a++) {
+        uint32_t *alt_hits = NULL;
+        int count = run_alt (shard, &query->alts[a], &alt_hits);
+        qs_set_t *alt = count >= 0 ? qs_set_from_sorted (alt_hits, count) : NULL;
+        free (alt_hits);
+        qs_set_t *merged = alt ? qs_set_or (result, alt) : NULL;
+        qs_set_free (alt);
+        qs_set_free (result);
+        result = merged;
+    }
+    int count = result ? qs_set_to_array (result, hits) : -1;
+    qs_set_free (result);
+    return count;
+}
+
+// the hits of a shard are slots until here, which stay the same when tracks
+// only move around
+static int
+slots_to_positions (qs_shard_t *shard, uint32_t *hits, int count)
+{
+    for (int i = 0; i < count; i++) {
+        hits[i] = shard->pos[hits[i]];
+    }
+    if (!shard->ordered) {
+        qsort (hits, count, sizeof (uint32_t), cmp_uint32);
+    }
+    return count;
+}
+
+int
+qs_index_query_shard (qs_plt_index_t *idx, int shard_idx, const qs_query_t *query, uint32_t **hits)
+{
+    *hits = NULL;
+    if (!idx || !query || shard_idx < 0 || shard_idx >= idx->shard_count) {
+        return -1;
+    }
+    qs_shard_t *shard = &idx->shards[shard_idx];
+    if (!query->alt_count && !*query->text) {
+        forget_result (shard);
+        return 0;
+    }
+    if (!shard->built && shard_build (idx, shard) < 0) {
+        return -1;
+    }
+
+    int count;
+    if (query->alt_count) {
+        // refining only works for text growing at the end
+        forget_result (shard);
+        count = run_query (shard, query, hits);
+        return count > 0 ? slots_to_positions (shard, *hits, count) : count;
+    }
+
+    // every track matching a query which contains the previous one also
+    // matched the previous one, so typing more characters only has to check
+    // the previous hits. Large results are cheaper to get from the index.
+    const char *text = query->text;
+    if (shard->last_query && strstr (text, shard->last_query)
+            && shard->last_count <= shard->count / REFINE_RATIO) {
+        count = refine (shard, text, hits);
+    }
+    else {
+        count = lookup (shard, text, hits);
+        if (count < 0) {
+            count = scan (shard, text, hits);
+        }
+    }
+    if (count >= 0) {
+        remember_result (shard, text, *hits, count);
+        slots_to_positions (shard, *hits, count);
+    }
+    else {
+        forget_result (shard);
+    }
+    return count;
+}
+
+int
+qs_index_query (qs_plt_index_t *idx, const qs_query_t *query, uint32_t **hits)
+{
+    *hits = NULL;
+    if (!idx) {
+        return -1;
+    }
+    uint32_t *result = malloc ((idx->item_count > 0 ? idx->item_count : 1) * sizeof (uint32_t));
+    if (!result) {
+        return -1;
+    }
+    int count = 0;
+    for (int i = 0; i < idx->shard_count; i++) {
+        uint32_t *shard_hits = NULL;
+        int shard_count = qs_index_query_shard (idx, i, query, &shard_hits);
+        if (shard_count < 0) {
+            free (result);
+            return -1;
+        }
+        memcpy (result + count, shard_hits, shard_count * sizeof (uint32_t));
+        count += shard_count;
+        free (shard_hits);
+    }
+    qs_index_sort_hits (idx, result, count);
+    *hits = result;
+    return count;
+}
+
+void
+qs_index_sort_hits (qs_plt_index_t *idx, uint32_t *hits, int count)
+{
+    if (!idx->ordered) {
+        qsort (hits, count, sizeof (uint32_t), cmp_uint32);
+    }
+}
+
+static void
+select_hits (qs_plt_index_t *idx, const uint32_t *hits, int count)
+{
+    for (int i = 0; i < count; i++) {
+        deadbeef->pl_set_selected (idx->items[hits[i]], 1);
+    }
+}
+
+static void
+set_result (qs_plt_index_t *idx, qs_set_t *result)
+{
+    qs_set_free (idx->result);
+    idx->result = result;
+    idx->result_mod_idx = idx->mod_idx;
+}
+
+void
+qs_index_select (qs_plt_index_t *idx, const uint32_t *hits, int count)
+{
+    // the selection is only part of a result
+    set_result (idx, NULL);
+    select_hits (idx, hits, count);
+}
+
+void
+qs_index_set_result (qs_plt_index_t *idx, const uint32_t *hits, int count)
+{
+    set_result (idx, qs_set_from_sorted (hits, count));
+}
+
+void
+qs_index_set_result_set (qs_plt_index_t *idx, const qs_set_t *hits)
+{
+    set_result (idx, qs_set_copy (hits));
+}
+
+int
+qs_index_deselect (qs_plt_index_t *idx, int from, int count)
+{
+    set_result (idx, NULL);
+    int end = from + count < idx->item_count ? from + count : idx->item_count;
+    for (int pos = from; pos < end; pos++) {
+        // most tracks aren't selected, reading is cheaper than writing
+        if (deadbeef->pl_is_selected (idx->items[pos])) {
+            deadbeef->pl_set_selected (idx->items[pos], 0);
+        }
+    }
+    return end < idx->item_count ? end : -1;
+}
+
+int
+qs_index_select_set (qs_plt_index_t *idx, const qs_set_t *hits, int from, int count)
+{
+    set_result (idx, NULL);
+    int end = from + count < idx->item_count ? from + count : idx->item_count;
+    for (int64_t pos = qs_set_next (hits, from); pos >= 0 && pos < end; pos = qs_set_next (hits, pos + 1)) {
+        deadbeef->pl_set_selected (idx->items[pos], 1);
+    }
+    return end < idx->item_count ? end : -1;
+}
+
+static void
+apply_failed (qs_plt_index_t *idx, const char *text)
+{
+    // the index failed, most likely for lack of memory
+    set_result (idx, NULL);
+    deadbeef->plt_search_process (idx->plt, text);
+    for (int s = 0; s < idx->shard_count; s++) {
+        forget_result (&idx->shards[s]);
+    }
+}
+
+void
+qs_index_apply (qs_plt_index_t *idx, const char *text, const uint32_t *hits, int count)
+{
+    if (!idx) {
+        return;
+    }
+    if (count < 0) {
+        apply_failed (idx, text);
+        return;
+    }
+    deadbeef->plt_deselect_all (idx->plt);
+    select_hits (idx, hits, count);
+    set_result (idx, qs_set_from_sorted (hits, count));
+}
+
+void
+qs_index_apply_set (qs_plt_index_t *idx, const qs_set_t *hits)
+{
+    if (!idx) {
+        return;
+    }
+    deadbeef->plt_deselect_all (idx->plt);
+    for (int64_t pos = qs_set_next (hits, 0); pos >= 0; pos = qs_set_next (hits, pos + 1)) {
+        deadbeef->pl_set_selected (idx->items[pos], 1);
+    }
+    set_result (idx, qs_set_copy (hits));
+}
+
+// returns the index of plt if its result is still valid
+static qs_plt_index_t *
+find_result (ddb_playlist_t *plt)
+{
+    qs_plt_index_t *idx = indexes;
+    while (idx && idx->plt != plt) {
+        idx = idx->next;
+    }
+    if (!idx || !idx->result || idx->dirty
+            || idx->result_mod_idx != deadbeef->plt_get_modification_idx (plt)) {
+        return NULL;
+    }
+    return idx;
+}
+
+const qs_set_t *
+qs_index_result (ddb_playlist_t *plt)
+{
+    qs_plt_index_t *idx = find_result (plt);
+    return idx ? idx->result : NULL;
+}
+
+int64_t
+qs_index_find_hit (ddb_playlist_t *plt, int from, int backward)
+{
+    qs_plt_index_t *idx = find_result (plt);
+    if (!idx) {
+        return -2;
+    }
+    if (from < 0) {
+        return backward ? -1 : qs_set_next (idx->result, 0);
+    }
+    return backward ? qs_set_prev (idx->result, from) : qs_set_next (idx->result, from);
+}
+
+int
+qs_index_result_tracks (ddb_playlist_t *plt, DB_playItem_t ***tracks)
+{
+    *tracks = NULL;
+    deadbeef->pl_lock ();
+    qs_plt_index_t *idx = find_result (plt);
+    uint32_t *hits = NULL;
+    int count = idx ? qs_set_to_array (idx->result, &hits) : -1;
+    if (count >= 0 && !(*tracks = malloc ((count > 0 ? count : 1) * sizeof (DB_playItem_t *)))) {
+        count = -1;
+    }
+    for (int i = 0; i < count; i++) {
+        (*tracks)[i] = idx->items[hits[i]];
+        deadbeef->pl_item_ref ((*tracks)[i]);
+    }
+    free (hits);
+    deadbeef->pl_unlock ();
+    return count;
+}
+
+void
+qs_index_search (ddb_playlist_t *plt, const char *text)
+{
+    deadbeef->pl_lock ();
+    qs_plt_index_t *idx = qs_index_prepare (plt);
+    qs_query_t *query = qs_query_compile (text);
+    if (idx && query) {
+        uint32_t *hits = NULL;
+        int count = qs_index_query (idx, query, &hits);
+        qs_index_apply (idx, text, hits, count);
+        free (hits);
+    }
+    else {
+        deadbeef->plt_search_process (plt, text);
+    }
+    deadbeef->pl_unlock ();
+    qs_query_free (query);
+}
+
+void
+qs_index_update (void)
+{
+    deadbeef->pl_lock ();
+    for (qs_plt_index_t *idx = indexes; idx; idx = idx->next) {
+        if (idx->dirty || !idx->map_size || idx->readers
+                || idx->mod_idx == deadbeef->plt_get_modification_idx (idx->plt)) {
+            continue;
+        }
+        if (index_sync (idx) < 0) {
+            // collected again by the next search
+            idx->dirty = 1;
+        }
+    }
+    deadbeef->pl_unlock ();
+}
+
+void
+qs_index_update_track (DB_playItem_t *it)
+{
+    deadbeef->pl_lock ();
+    for (qs_plt_index_t *idx = indexes; idx; idx = idx->next) {
+        int pos = map_find (idx, it);
+        if (pos < 0) {
+            continue;
+        }
+        qs_shard_t *shard = &idx->shards[idx->locs[pos].shard];
+        int slot = idx->locs[pos].slot;
+        if (idx->readers) {
+            shard->outdated = 1;
+            idx->held_changes = 1;
+        }
+        else if (begin_change (shard) == 0) {
+            remove_content (shard, slot);
+            if (add_content (shard, slot) < 0) {
+                shard_clear (shard);
+            }
+            else {
+                refresh_trigrams (shard);
+            }
+        }
+        // the fingerprint no longer matches the metadata either way
+        shard->modified = 1;
+    }
+    deadbeef->pl_unlock ();
+}
+
+size_t
+qs_index_memory (void)
+{
+    deadbeef->pl_lock ();
+    size_t size = 0;
+    for (qs_plt_index_t *idx = indexes; idx; idx = idx->next) {
+        size += sizeof (qs_plt_index_t) + idx->item_count * (sizeof (DB_playItem_t *) + sizeof (qs_loc_t));
+        size += idx->map_size * (sizeof (DB_playItem_t *) + sizeof (uint32_t));
+        size += qs_set_memory (idx->result);
+        for (int i = 0; i < idx->shard_count; i++) {
+            size += shard_memory (&idx->shards[i]);
+        }
+    }
+    deadbeef->pl_unlock ();
+    return size;
+}
+
+void
+qs_index_invalidate (ddb_playlist_t *plt)
+{
+    deadbeef->pl_lock ();
+    for (qs_plt_index_t *idx = indexes; idx; idx = idx->next) {
+        if (!plt || idx->plt == plt) {
+            idx->dirty = 1;
+        }
+    }
+    deadbeef->pl_unlock ();
+}
+
+static void
+index_free (qs_plt_index_t *idx)
+{
+    index_clear (idx);
+    deadbeef->plt_unref (idx->plt);
+    free (idx);
+}
+
+void
+qs_index_prune (void)
+{
+    deadbeef->pl_lock ();
+    qs_plt_index_t *prev = NULL;
+    qs_plt_index_t *idx = indexes;
+    while (idx) {
+        qs_plt_index_t *next = idx->next;
+        // a held index is dropped by a later prune
+        if (!idx->readers && deadbeef->plt_get_idx (idx->plt) < 0) {
+            if (prev) {
+                prev->next = next;
+            }
+            else {
+                indexes = next;
+            }
+            index_free (idx);
+        }
+        else {
+            prev = idx;
+        }
+        idx = next;
+    }
+    deadbeef->pl_unlock ();
+}
+
+void
+qs_index_load (const char *path)
+{
+    qs_store_open (path);
+}
+
+void
+qs_index_save (const char *path)
+{
+    if (qs_store_begin (path) < 0) {
+        return;
+    }
+    qs_buf_t buf = { NULL, 0, 0, 0 };
+    int res = 0;
+    deadbeef->pl_lock ();
+    for (qs_plt_index_t *idx = indexes; idx && res == 0; idx = idx->next) {
+        for (int i = 0; i < idx->shard_count && res == 0; i++) {
+            qs_shard_t *shard = &idx->shards[i];
+            // the tokens of changed shards are in the order of the changes,
+            // they get saved again once rebuilt
+            if (shard->built && !shard->modified) {
+                res = shard_save (shard, &buf);
+                if (res == 0) {
+                    res = qs_store_add (shard->fingerprint, buf.data, buf.size);
+                }
+            }
+        }
+    }
+    deadbeef->pl_unlock ();
+    free (buf.data);
+    if (res < 0) {
+        trace ("quick_search: failed to save the index\n");
+        qs_store_abort ();
+        return;
+    }
+    qs_store_commit ();
+}
+
+void
+qs_index_free (void)
+{
+    deadbeef->pl_lock ();
+    while (indexes) {
+        qs_plt_index_t *next = indexes->next;
+        index_free (indexes);
+        indexes = next;
+    }
+    deadbeef->pl_unlock ();
+    qs_store_close ();
+}
@@ -0,0 +1,197 @@
+/*
+    Quick Search Plugin for DeaDBeeF audio player
+    Copyright (C) 2014 Christian Boxdörfer <christian.boxdoerfer@posteo.de>
+
+    This program is free software; you can redistribute it and/or
+    modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation; either version 2
+    of the License, or (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+*/
+
+#ifndef __QS_SEARCH_INDEX_H
+#define __QS_SEARCH_INDEX_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <deadbeef/deadbeef.h>
+
+#include "query.h"
+#include "result_set.h"
+
+// Inverted token index of a single playlist. The index is split into shards
+// of initially consecutive tracks which are tokenized on demand. Within a
+// shard tracks are identified by a slot, which they keep when they move
+// around in the playlist, so changes to the playlist only touch the shards
+// of the added, removed and edited tracks. Queries return the positions of
+// the tracks in the playlist.
+// The vocabulary of each shard is indexed by trigrams, which resolves
+// queries matching the middle of a word without scanning all tokens.
+// Unless noted otherwise the functions have to be called with pl_lock held.
+typedef struct qs_plt_index_s qs_plt_index_t;
+
+// returns the index of plt after bringing it up to date if the playlist
+// changed, the shards are tokenized by the first query that needs them
+qs_plt_index_t *
+qs_index_prepare (ddb_playlist_t *plt);
+
+// like qs_index_prepare, but also tokenizes all shards
+qs_plt_index_t *
+qs_index_get (ddb_playlist_t *plt);
+
+int
+qs_index_shard_count (qs_plt_index_t *idx);
+
+// returns whether all shards are tokenized
+int
+qs_index_is_built (qs_plt_index_t *idx);
+
+// keeps the index from changing so that its built shards can be queried
+// after releasing pl_lock. Changes to the playlist and its tracks are applied
+// by the first qs_index_prepare after qs_index_release, which returns NULL
+// until then.
+void
+qs_index_hold (qs_plt_index_t *idx);
+
+// returns whether the metadata of indexed tracks changed while the index was
+// held, which makes the results of the queries in the meantime stale
+int
+qs_index_release (qs_plt_index_t *idx);
+
+// tokenizes at most max_tracks more tracks of the shard, returns 1 once it
+// is built, 0 if tracks are left and -1 on failure. Spreads the cost of
+// building over several calls, pl_lock may be released in between. The
+// shard starts over if its tracks change before it is done.
+int
+qs_index_build_shard (qs_plt_index_t *idx, int shard, int max_tracks);
+
+// resolves query against one shard of the index, stores the matching
+// positions in *hits (ascending, to be freed by the caller) and returns their
+// number, or -1 on failure. Queries without any word characters are answered
+// by scanning the tracks of the shard. Queries using the query syntax start
+// from the predicate with the fewest candidates in the index and check the
+// others on those candidates only.
+// Doesn't call into the player except for reading the track metadata when
+// the shard gets built, so different shards can be queried from several
+// threads at once while another thread holds pl_lock and keeps the playlists
+// from changing. Matching is done on a folded copy of the searchable fields,
+// so the search ignores case and diacritics.
+int
+qs_index_query_shard (qs_plt_index_t *idx, int shard, const qs_query_t *query, uint32_t **hits);
+
+// queries all shards, see qs_index_query_shard
+int
+qs_index_query (qs_plt_index_t *idx, const qs_query_t *query, uint32_t **hits);
+
+// sorts the concatenated hits of all shards, which are only in playlist
+// order as long as no tracks moved between shards
+void
+qs_index_sort_hits (qs_plt_index_t *idx, uint32_t *hits, int count);
+
+// adds the given positions to the selection of the indexed playlist
+void
+qs_index_select (qs_plt_index_t *idx, const uint32_t *hits, int count);
+
+// makes the given positions the selection of the indexed playlist and
+// remembers them as its result, or runs plt_search_process if count is
+// negative
+void
+qs_index_apply (qs_plt_index_t *idx, const char *text, const uint32_t *hits, int count);
+
+// like qs_index_apply with a set of positions
+void
+qs_index_apply_set (qs_plt_index_t *idx, const qs_set_t *hits);
+
+// remembers the count ascending positions as the result of the index after
+// they got selected with qs_index_select
+void
+qs_index_set_result (qs_plt_index_t *idx, const uint32_t *hits, int count);
+
+// like qs_index_set_result with a set of positions
+void
+qs_index_set_result_set (qs_plt_index_t *idx, const qs_set_t *hits);
+
+// deselects at most count positions of the indexed playlist starting at from,
+// returns the position to continue with or -1 once the end is reached. Lets
+// clearing the selection of a large playlist be spread over several calls.
+int
+qs_index_deselect (qs_plt_index_t *idx, int from, int count);
+
+// selects the positions in hits among at most count positions starting at
+// from, returns the position to continue with or -1 once the end is reached
+int
+qs_index_select_set (qs_plt_index_t *idx, const qs_set_t *hits, int from, int count);
+
+// returns the result of the last search in plt while the playlist didn't
+// change since, or NULL. Owned by the index.
+const qs_set_t *
+qs_index_result (ddb_playlist_t *plt);
+
+// returns the position of the first hit of the last search in plt at or
+// after from, or at or before it if backward is set. Returns -1 if there's
+// no such hit and -2 if the index doesn't have the result.
+int64_t
+qs_index_find_hit (ddb_playlist_t *plt, int from, int backward);
+
+// stores referenced tracks of the result of the last search in plt in
+// *tracks (to be freed by the caller) and returns their number, or -1 if
+// there's no such result. Takes pl_lock.
+int
+qs_index_result_tracks (ddb_playlist_t *plt, DB_playItem_t ***tracks);
+
+// searches plt for text and selects the matching tracks, falls back to
+// plt_search_process if the index can't be used. Takes pl_lock.
+void
+qs_index_search (ddb_playlist_t *plt, const char *text);
+
+// marks the index of plt (or all indexes if plt is NULL) for a rebuild.
+// Takes pl_lock, like qs_index_prune and qs_index_free.
+void
+qs_index_invalidate (ddb_playlist_t *plt);
+
+// applies the changes of the playlists since the last search to their
+// indexes: the tokens of removed tracks are dropped, added tracks are
+// appended to the last shard. Takes pl_lock.
+void
+qs_index_update (void);
+
+// makes the indexes containing it re-read its metadata. Takes pl_lock.
+void
+qs_index_update_track (DB_playItem_t *it);
+
+// returns the number of bytes used by all indexes. Takes pl_lock.
+size_t
+qs_index_memory (void);
+
+// drops the indexes of playlists which got removed
+void
+qs_index_prune (void);
+
+// maps the index file at path. Shards whose tracks and metadata didn't
+// change since it was saved are read from it instead of being tokenized.
+void
+qs_index_load (const char *path);
+
+// writes the tokenized shards to the index file at path, keeping the ones of
+// the previous file which are still likely to be used. Takes pl_lock.
+void
+qs_index_save (const char *path);
+
+// drops all indexes and unmaps the index file
+void
+qs_index_free (void);
+
+// returns whether the meta field key is looked at by plt_search_process,
+// of :URI only the file name is
+int
+qs_is_searchable_key (const char *key);
+
+#endif
@@ -0,0 +1,272 @@
+/*
+    Quick Search Plugin for DeaDBeeF audio player
+    Copyright (C) 2014 Christian Boxdörfer <christian.boxdoerfer@posteo.de>
+
+    This program is free software; you can redistribute it and/or
+    modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation; either version 2
+    of the License, or (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "quick_search.h"
+#include "search_stats.h"
+#include "trace_event.h"
+
+// samples kept per stage, older ones roll out of the histograms
+#define WINDOW 1024
+// bucket b > 0 counts the values in [2^(b-1), 2^b), bucket 0 the ones below 1
+#define BUCKETS 26
+
+typedef struct {
+    int64_t samples[WINDOW];
+    // next sample to overwrite and number of valid samples
+    int next;
+    int count;
+    // all samples ever recorded and their sum
+    int64_t total;
+    int64_t sum;
+    int buckets[BUCKETS];
+} series_t;
+
+static const char *stat_names[QS_STAT_COUNT] = {
+    "lock_wait",
+    "lock_hold",
+    "match",
+    "select",
+    "copy",
+    "title",
+    "notify",
+    "total",
+    "hits",
+    "events",
+};
+
+static const char *gauge_names[QS_GAUGE_COUNT] = {
+    "index_mem",
+};
+
+static series_t series[QS_STAT_COUNT];
+static int64_t gauges[QS_GAUGE_COUNT];
+static uintptr_t stats_mutex = 0;
+static int enabled = 0;
+
+static int
+bucket_of (int64_t value)
+{
+    int b = 0;
+    while (value > 0 && b < BUCKETS - 1) {
+        value >>= 1;
+        b++;
+    }
+    return b;
+}
+
+void
+qs_stats_enable (int enable)
+{
+    if (!stats_mutex) {
+        if (!enable) {
+            return;
+        }
+        stats_mutex = deadbeef->mutex_create ();
+    }
+    deadbeef->mutex_lock (stats_mutex);
+    enabled = enable;
+    deadbeef->mutex_unlock (stats_mutex);
+}
+
+int
+qs_stats_enabled (void)
+{
+    if (!stats_mutex) {
+        return 0;
+    }
+    deadbeef->mutex_lock (stats_mutex);
+    int res = enabled;
+    deadbeef->mutex_unlock (stats_mutex);
+    return res;
+}
+
+int64_t
+qs_clock_usec (void)
+{
+    struct timespec ts;
+    clock_gettime (CLOCK_MONOTONIC, &ts);
+    // 0 stands for disabled in qs_stats_now
+    return (int64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000 + 1;
+}
+
+int64_t
+qs_stats_now (void)
+{
+    if (!qs_stats_enabled () && !qs_trace_enabled ()) {
+        return 0;
+    }
+    return qs_clock_usec ();
+}
+
+void
+qs_stats_record (qs_stat_t stat, int64_t value)
+{
+    if (!stats_mutex || stat < 0 || stat >= QS_STAT_COUNT) {
+        return;
+    }
+    deadbeef->mutex_lock (stats_mutex);
+    if (enabled) {
+        series_t *s = &series[stat];
+        if (s->count == WINDOW) {
+            s->buckets[bucket_of (s->samples[s->next])]--;
+        }
+        else {
+            s->count++;
+        }
+        s->samples[s->next] = value;
+        s->next = (s->next + 1) % WINDOW;
+        s->buckets[bucket_of (value)]++;
+        s->total++;
+        s->sum += value;
+    }
+    deadbeef->mutex_unlock (stats_mutex);
+}
+
+void
+qs_stats_set (qs_gauge_t gauge, int64_t value)
+{
+    if (!stats_mutex || gauge < 0 || gauge >= QS_GAUGE_COUNT) {
+        return;
+    }
+    deadbeef->mutex_lock (stats_mutex);
+    if (enabled) {
+        gauges[gauge] = value;
+    }
+    deadbeef->mutex_unlock (stats_mutex);
+}
+
+void
+qs_stats_since (qs_stat_t stat, int64_t start)
+{
+    if (start) {
+        qs_stats_record (stat, qs_clock_usec () - start);
+    }
+}
+
+static int
+cmp_int64 (const void *a, const void *b)
+{
+    int64_t x = *(const int64_t *)a;
+    int64_t y = *(const int64_t *)b;
+    return x < y ? -1 : x > y;
+}
+
+static void
+write_series (FILE *out, const char *name, const series_t *s, int64_t *sorted)
+{
+    memcpy (sorted, s->samples, s->count * sizeof (int64_t));
+    qsort (sorted, s->count, sizeof (int64_t), cmp_int64);
+    int64_t p50 = s->count ? sorted[(s->count - 1) * 50 / 100] : 0;
+    int64_t p90 = s->count ? sorted[(s->count - 1) * 90 / 100] : 0;
+    int64_t p99 = s->count ? sorted[(s->count - 1) * 99 / 100] : 0;
+    int64_t max = s->count ? sorted[s->count - 1] : 0;
+    fprintf (out, "%-10s %8lld %8d %10lld %10lld %10lld %10lld\n", name, (long long)s->total, s->count,
+            (long long)p50, (long long)p90, (long long)p99, (long long)max);
+}
+
+static void
+write_buckets (FILE *out, const char *name, const series_t *s)
+{
+    fprintf (out, "%-10s", name);
+    for (int b = 0; b < BUCKETS; b++) {
+        if (s->buckets[b]) {
+            fprintf (out, " <%lld:%d", 1LL << b, s->buckets[b]);
+        }
+    }
+    fprintf (out, "\n");
+}
+
+int
+qs_stats_write (const char *path)
+{
+    if (!stats_mutex || !path) {
+        return -1;
+    }
+    int64_t *sorted = malloc (WINDOW * sizeof (int64_t));
+    char *tmp_path = malloc (strlen (path) + 5);
+    if (!sorted || !tmp_path) {
+        free (sorted);
+        free (tmp_path);
+        return -1;
+    }
+    sprintf (tmp_path, "%s.tmp", path);
+    FILE *out = fopen (tmp_path, "w");
+    if (!out) {
+        free (sorted);
+        free (tmp_path);
+        return -1;
+    }
+
+    deadbeef->mutex_lock (stats_mutex);
+    fprintf (out, "# quick search stats, percentiles over the last %d samples, times in microseconds\n", WINDOW);
+    fprintf (out, "%-10s %8s %8s %10s %10s %10s %10s\n", "stage", "samples", "window", "p50", "p90", "p99", "max");
+    for (int i = 0; i < QS_STAT_COUNT; i++) {
+        write_series (out, stat_names[i], &series[i], sorted);
+    }
+    fprintf (out, "\n# latest values, sizes in bytes\n");
+    for (int i = 0; i < QS_GAUGE_COUNT; i++) {
+        fprintf (out, "%-10s %10lld\n", gauge_names[i], (long long)gauges[i]);
+    }
+    fprintf (out, "\n# histograms of the window, <n:count counts the samples below n\n");
+    for (int i = 0; i < QS_STAT_COUNT; i++) {
+        if (series[i].count) {
+            write_buckets (out, stat_names[i], &series[i]);
+        }
+    }
+    deadbeef->mutex_unlock (stats_mutex);
+
+    int res = ferror (out) ? -1 : 0;
+    if (fclose (out) || res < 0 || rename (tmp_path, path)) {
+        unlink (tmp_path);
+        res = -1;
+    }
+    free (sorted);
+    free (tmp_path);
+    return res;
+}
+
+void
+qs_stats_reset (void)
+{
+    if (stats_mutex) {
+        deadbeef->mutex_lock (stats_mutex);
+    }
+    memset (series, 0, sizeof (series));
+    memset (gauges, 0, sizeof (gauges));
+    if (stats_mutex) {
+        deadbeef->mutex_unlock (stats_mutex);
+    }
+}
+
+void
+qs_stats_free (void)
+{
+    qs_stats_reset ();
+    if (stats_mutex) {
+        deadbeef->mutex_free (stats_mutex);
+        stats_mutex = 0;
+    }
+    enabled = 0;
+}
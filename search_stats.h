@@ -0,0 +1,93 @@
+/*
+    Quick Search Plugin for DeaDBeeF audio player
+    Copyright (C) 2014 Christian Boxdörfer <christian.boxdoerfer@posteo.de>
+
+    This program is free software; you can redistribute it and/or
+    modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation; either version 2
+    of the License, or (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+*/
+
+#ifndef __QS_SEARCH_STATS_H
+#define __QS_SEARCH_STATS_H
+
+#include <stdint.h>
+
+// Timings of the stages of a search, kept as rolling histograms over the
+// most recent samples so that slow searches can be diagnosed from a file the
+// user sends in. Nothing is recorded unless enabled. Thread safe.
+
+typedef enum {
+    // waiting for and holding pl_lock while searching
+    QS_STAT_LOCK_WAIT,
+    QS_STAT_LOCK_HOLD,
+    // matching the tracks of one playlist, summed over its shards
+    QS_STAT_MATCH,
+    // writing the selection of one playlist
+    QS_STAT_SELECT,
+    // copying the result into the search playlist
+    QS_STAT_COPY,
+    QS_STAT_TITLE,
+    // sending the playlist change events
+    QS_STAT_NOTIFY,
+    // from starting the search to publishing its result
+    QS_STAT_TOTAL,
+    // not durations: matching tracks and events sent per search
+    QS_STAT_HITS,
+    QS_STAT_EVENTS,
+    QS_STAT_COUNT,
+} qs_stat_t;
+
+// not sampled, only the latest value is written along with the histograms
+typedef enum {
+    // bytes used by the indexes of all playlists
+    QS_GAUGE_INDEX_MEMORY,
+    QS_GAUGE_COUNT,
+} qs_gauge_t;
+
+void
+qs_stats_enable (int enable);
+
+int
+qs_stats_enabled (void);
+
+// returns the monotonic time in microseconds, never 0
+int64_t
+qs_clock_usec (void);
+
+// returns qs_clock_usec, or 0 while neither the stats nor tracing (see
+// trace_event.h) are enabled, so that timing a stage costs nothing then
+int64_t
+qs_stats_now (void);
+
+void
+qs_stats_record (qs_stat_t stat, int64_t value);
+
+// records the time passed since start, which came from qs_stats_now
+void
+qs_stats_since (qs_stat_t stat, int64_t start);
+
+void
+qs_stats_set (qs_gauge_t gauge, int64_t value);
+
+// writes the histograms as text to path, returns 0 on success
+int
+qs_stats_write (const char *path);
+
+// drops all samples
+void
+qs_stats_reset (void);
+
+void
+qs_stats_free (void);
+
+#endif
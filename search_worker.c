@@ -0,0 +1,542 @@
+/*
+    Quick Search Plugin for DeaDBeeF audio player
+    Copyright (C) 2014 Christian Boxdörfer <christian.boxdoerfer@posteo.de>
+
+    This program is free software; you can redistribute it and/or
+    modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation; either version 2
+    of the License, or (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+*/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "quick_search.h"
+#include "search_worker.h"
+#include "search_index.h"
+#include "result_cache.h"
+#include "search_stats.h"
+#include "trace_event.h"
+#include "thread_pool.h"
+
+// tracks tokenized per pl_lock hold when a snapshot search builds a shard
+#define BUILD_CHUNK_TRACKS 1024
+
+typedef struct {
+    int generation;
+    char *text;
+    ddb_playlist_t **plts;
+    int plt_count;
+} qs_search_job_t;
+
+static intptr_t worker_tid = 0;
+static uintptr_t worker_mutex = 0;
+static uintptr_t worker_cond = 0;
+static int worker_stopping = 0;
+static int latest_generation = 0;
+static qs_search_job_t *pending_job = NULL;
+static qs_search_done_cb done_cb = NULL;
+static void *done_user_data = NULL;
+static qs_pool_t *pool = NULL;
+static int pool_threads = 0;
+static int wanted_threads = 0;
+static int wanted_snapshot = 1;
+// when the worker took pl_lock, for the stats
+static int64_t locked_at = 0;
+
+// one shard of one of the searched playlists
+typedef struct {
+    qs_plt_index_t *idx;
+    int shard;
+    uint32_t *hits;
+    int count;
+    int64_t start;
+    int64_t usec;
+} qs_shard_task_t;
+
+typedef struct {
+    qs_search_job_t *job;
+    qs_query_t *query;
+    qs_shard_task_t *tasks;
+} qs_search_run_t;
+
+static void
+job_free (qs_search_job_t *job)
+{
+    if (!job) {
+        return;
+    }
+    for (int i = 0; i < job->plt_count; i++) {
+        deadbeef->plt_unref (job->plts[i]);
+    }
+    free (job->plts);
+    free (job->text);
+    free (job);
+}
+
+int
+qs_worker_is_current (int generation)
+{
+    deadbeef->mutex_lock (worker_mutex);
+    int current = generation == latest_generation;
+    deadbeef->mutex_unlock (worker_mutex);
+    return current;
+}
+
+static void
+shard_task (void *ctx, int task_idx)
+{
+    qs_search_run_t *run = ctx;
+    qs_shard_task_t *task = &run->tasks[task_idx];
+    if (!qs_worker_is_current (run->job->generation)) {
+        task->count = -2;
+        return;
+    }
+    task->start = qs_stats_now ();
+    task->count = qs_index_query_shard (task->idx, task->shard, run->query, &task->hits);
+    if (task->start) {
+        task->usec = qs_clock_usec () - task->start;
+        qs_trace_span ("match shard", task->start, task->start + task->usec, NULL, "hits", task->count);
+    }
+}
+
+static void
+update_pool (void)
+{
+    deadbeef->mutex_lock (worker_mutex);
+    int threads = wanted_threads > 0 ? wanted_threads : qs_cpu_count ();
+    deadbeef->mutex_unlock (worker_mutex);
+    if (pool && threads == pool_threads) {
+        return;
+    }
+    qs_pool_free (pool);
+    pool = threads > 1 ? qs_pool_create (threads) : NULL;
+    pool_threads = threads;
+}
+
+// pl_lock wrappers measuring how long the worker waits for and holds it
+static void
+lock_playlists (void)
+{
+    int64_t start = qs_stats_now ();
+    deadbeef->pl_lock ();
+    qs_stats_since (QS_STAT_LOCK_WAIT, start);
+    qs_trace_complete ("lock wait", start, NULL, NULL, 0);
+    locked_at = qs_stats_now ();
+}
+
+static void
+unlock_playlists (void)
+{
+    qs_stats_since (QS_STAT_LOCK_HOLD, locked_at);
+    qs_trace_complete ("lock hold", locked_at, NULL, NULL, 0);
+    deadbeef->pl_unlock ();
+}
+
+// tokenizes the shards the search needs a chunk of tracks at a time and
+// lets go of pl_lock in between, so that building an index doesn't keep the
+// player waiting. Called and returns with pl_lock held.
+static int
+build_indexes (qs_search_job_t *job, qs_query_t *query)
+{
+    if (!query->alt_count && !*query->text) {
+        // nothing gets matched
+        return 0;
+    }
+    for (int i = 0; i < job->plt_count; i++) {
+        const qs_set_t *cached;
+        if (qs_cache_lookup (job->plts[i], query->key, &cached) >= 0) {
+            continue;
+        }
+        qs_plt_index_t *idx;
+        int s = 0;
+        while ((idx = qs_index_prepare (job->plts[i])) && s < qs_index_shard_count (idx)) {
+            int res = qs_index_build_shard (idx, s, BUILD_CHUNK_TRACKS);
+            if (res < 0) {
+                // searched with pl_lock held
+                break;
+            }
+            if (res > 0) {
+                s++;
+                continue;
+            }
+            unlock_playlists ();
+            int current = qs_worker_is_current (job->generation);
+            lock_playlists ();
+            if (!current) {
+                return -1;
+            }
+        }
+    }
+    return 0;
+}
+
+static int
+search_playlists (qs_search_job_t *job, qs_query_t *query, int snapshot)
+{
+    int cancelled = 0;
+    lock_playlists ();
+    if (snapshot && build_indexes (job, query) < 0) {
+        unlock_playlists ();
+        return -1;
+    }
+    int n_plts = job->plt_count > 0 ? job->plt_count : 1;
+    qs_plt_index_t **idx = calloc (n_plts, sizeof (qs_plt_index_t *));
+    const qs_set_t **cached_hits = calloc (n_plts, sizeof (qs_set_t *));
+    int *cached_count = calloc (n_plts, sizeof (int));
+    int *mod_idx = calloc (n_plts, sizeof (int));
+    int task_count = 0;
+    for (int i = 0; idx && cached_hits && cached_count && mod_idx && i < job->plt_count; i++) {
+        idx[i] = qs_index_prepare (job->plts[i]);
+        cached_count[i] = idx[i] ? qs_cache_lookup (job->plts[i], query->key, &cached_hits[i]) : -1;
+        if (cached_count[i] < 0) {
+            task_count += qs_index_shard_count (idx[i]);
+            // shards can only be built with pl_lock held
+            if (idx[i] && !qs_index_is_built (idx[i]) && (*query->text || query->alt_count)) {
+                snapshot = 0;
+            }
+        }
+    }
+    qs_shard_task_t *tasks = calloc (task_count > 0 ? task_count : 1, sizeof (qs_shard_task_t));
+    if (!idx || !cached_hits || !cached_count || !mod_idx || !tasks) {
+        free (idx);
+        free (cached_hits);
+        free (cached_count);
+        free (mod_idx);
+        free (tasks);
+        unlock_playlists ();
+        return -1;
+    }
+
+    // tasks are ordered by playlist and shard, so merging them in order gives
+    // the same result no matter which thread searched what
+    int t = 0;
+    for (int i = 0; i < job->plt_count; i++) {
+        if (cached_count[i] >= 0) {
+            continue;
+        }
+        for (int s = 0; s < qs_index_shard_count (idx[i]); s++) {
+            tasks[t].idx = idx[i];
+            tasks[t].shard = s;
+            t++;
+        }
+        if (snapshot && idx[i]) {
+            qs_index_hold (idx[i]);
+            mod_idx[i] = deadbeef->plt_get_modification_idx (job->plts[i]);
+        }
+    }
+    if (snapshot) {
+        // the held indexes don't change, the matching doesn't need the lock
+        unlock_playlists ();
+    }
+    qs_search_run_t run = { job, query, tasks };
+    qs_pool_run (pool, shard_task, &run, task_count);
+    if (snapshot) {
+        lock_playlists ();
+    }
+
+    for (int i = 0; i < task_count; i++) {
+        if (tasks[i].count == -2) {
+            cancelled = 1;
+        }
+    }
+
+    t = 0;
+    int total = 0;
+    for (int i = 0; i < job->plt_count; i++) {
+        // only the playlists which weren't cached got tasks
+        int shards = cached_count[i] < 0 ? qs_index_shard_count (idx[i]) : 0;
+        int stale = 0;
+        if (snapshot && cached_count[i] < 0 && idx[i]) {
+            // the positions are stale if the playlist changed in the meantime
+            stale = qs_index_release (idx[i])
+                || mod_idx[i] != deadbeef->plt_get_modification_idx (job->plts[i]);
+        }
+        else if (snapshot) {
+            // only the held indexes and cache entries are sure to be left
+            int had_index = idx[i] != NULL;
+            idx[i] = qs_index_prepare (job->plts[i]);
+            if (cached_count[i] >= 0) {
+                cached_count[i] = idx[i] ? qs_cache_lookup (job->plts[i], query->key, &cached_hits[i]) : -1;
+                stale = cached_count[i] < 0;
+            }
+            else if (!had_index && idx[i]) {
+                // the playlist got tracks in the meantime, it has no tasks
+                stale = 1;
+            }
+        }
+        if (cancelled) {
+            continue;
+        }
+        if (stale && idx[i]) {
+            int64_t retry_start = qs_stats_now ();
+            uint32_t *hits = NULL;
+            idx[i] = qs_index_prepare (job->plts[i]);
+            int count = qs_index_query (idx[i], query, &hits);
+            qs_index_apply (idx[i], job->text, hits, count);
+            if (count >= 0) {
+                qs_cache_store (job->plts[i], query->key, hits, count);
+                total += count;
+            }
+            free (hits);
+            qs_trace_complete ("search again", retry_start, job->text, "hits", count);
+            t += shards;
+            continue;
+        }
+        int64_t apply_start = qs_stats_now ();
+        int tracks = apply_start ? deadbeef->plt_get_item_count (job->plts[i], PL_MAIN) : 0;
+        if (!idx[i]) {
+            deadbeef->plt_search_process (job->plts[i], job->text);
+            qs_stats_since (QS_STAT_MATCH, apply_start);
+            qs_trace_complete ("plt_search_process", apply_start, job->text, "tracks", tracks);
+            continue;
+        }
+        if (cached_count[i] >= 0) {
+            qs_index_apply_set (idx[i], cached_hits[i]);
+            qs_stats_since (QS_STAT_SELECT, apply_start);
+            qs_trace_complete ("select cached result", apply_start, job->text, "tracks", tracks);
+            total += cached_count[i];
+            continue;
+        }
+        int count = 0;
+        int64_t match_usec = 0;
+        // the shards ran in parallel, the playlist took from the first start
+        // to the last end
+        int64_t first = 0;
+        int64_t last = 0;
+        for (int s = 0; s < shards; s++) {
+            qs_shard_task_t *task = &tasks[t + s];
+            match_usec += task->usec;
+            if (task->start && (!first || task->start < first)) {
+                first = task->start;
+            }
+            if (task->start + task->usec > last) {
+                last = task->start + task->usec;
+            }
+            if (task->count < 0) {
+                count = -1;
+                break;
+            }
+            count += task->count;
+        }
+        if (apply_start) {
+            qs_stats_record (QS_STAT_MATCH, match_usec);
+            qs_trace_span ("search playlist", first, last, job->text, "tracks", tracks);
+        }
+        uint32_t *hits = count > 0 ? malloc (count * sizeof (uint32_t)) : NULL;
+        if (count > 0 && !hits) {
+            count = -1;
+        }
+        if (hits) {
+            int n = 0;
+            for (int s = 0; s < shards; s++) {
+                memcpy (hits + n, tasks[t + s].hits, tasks[t + s].count * sizeof (uint32_t));
+                n += tasks[t + s].count;
+            }
+            qs_index_sort_hits (idx[i], hits, count);
+        }
+        apply_start = qs_stats_now ();
+        qs_index_apply (idx[i], job->text, hits, count);
+        qs_stats_since (QS_STAT_SELECT, apply_start);
+        qs_trace_complete ("select", apply_start, NULL, "hits", count);
+        if (count >= 0) {
+            qs_cache_store (job->plts[i], query->key, hits, count);
+            total += count;
+        }
+        free (hits);
+        t += shards;
+    }
+    unlock_playlists ();
+    if (!cancelled) {
+        qs_stats_record (QS_STAT_HITS, total);
+    }
+
+    for (int i = 0; i < task_count; i++) {
+        free (tasks[i].hits);
+    }
+    free (tasks);
+    free (cached_hits);
+    free (cached_count);
+    free (mod_idx);
+    free (idx);
+    return cancelled ? -1 : 0;
+}
+
+static void
+worker_run (qs_search_job_t *job)
+{
+    update_pool ();
+    deadbeef->mutex_lock (worker_mutex);
+    int snapshot = wanted_snapshot;
+    deadbeef->mutex_unlock (worker_mutex);
+    qs_query_t *query = qs_query_compile (job->text);
+    if (!query) {
+        trace ("quick_search: failed to compile query\n");
+        return;
+    }
+    int64_t start = qs_stats_now ();
+    int res = search_playlists (job, query, snapshot);
+    qs_trace_complete (res < 0 ? "cancelled search" : "search", start, job->text, "playlists", job->plt_count);
+    qs_query_free (query);
+    if (res < 0) {
+        trace ("quick_search: cancelled search %d\n", job->generation);
+        return;
+    }
+    if (qs_worker_is_current (job->generation) && done_cb) {
+        done_cb (job->generation, done_user_data);
+    }
+}
+
+static void
+worker_thread (void *ctx)
+{
+    for (;;) {
+        deadbeef->mutex_lock (worker_mutex);
+        while (!worker_stopping && !pending_job) {
+            deadbeef->cond_wait (worker_cond, worker_mutex);
+        }
+        if (worker_stopping) {
+            deadbeef->mutex_unlock (worker_mutex);
+            break;
+        }
+        qs_search_job_t *job = pending_job;
+        pending_job = NULL;
+        deadbeef->mutex_unlock (worker_mutex);
+
+        worker_run (job);
+        job_free (job);
+    }
+}
+
+int
+qs_worker_start (qs_search_done_cb done, void *user_data)
+{
+    if (worker_tid) {
+        return 0;
+    }
+    done_cb = done;
+    done_user_data = user_data;
+    worker_stopping = 0;
+    if (!worker_mutex) {
+        worker_mutex = deadbeef->mutex_create ();
+        worker_cond = deadbeef->cond_create ();
+    }
+    worker_tid = deadbeef->thread_start (worker_thread, NULL);
+    if (!worker_tid) {
+        // searches will run synchronously in qs_worker_submit
+        trace ("quick_search: failed to start search worker\n");
+        return -1;
+    }
+    return 0;
+}
+
+void
+qs_worker_stop (void)
+{
+    if (!worker_mutex) {
+        return;
+    }
+    if (worker_tid) {
+        deadbeef->mutex_lock (worker_mutex);
+        worker_stopping = 1;
+        deadbeef->cond_signal (worker_cond);
+        deadbeef->mutex_unlock (worker_mutex);
+        deadbeef->thread_join (worker_tid);
+        worker_tid = 0;
+    }
+
+    job_free (pending_job);
+    pending_job = NULL;
+    qs_pool_free (pool);
+    pool = NULL;
+    deadbeef->cond_free (worker_cond);
+    deadbeef->mutex_free (worker_mutex);
+    worker_cond = 0;
+    worker_mutex = 0;
+}
+
+int
+qs_worker_submit (const char *text, ddb_playlist_t **plts, int plt_count)
+{
+    qs_search_job_t *job = calloc (1, sizeof (qs_search_job_t));
+    if (!job) {
+        for (int i = 0; i < plt_count; i++) {
+            deadbeef->plt_unref (plts[i]);
+        }
+        free (plts);
+        return -1;
+    }
+    job->text = strdup (text ? text : "");
+    job->plts = plts;
+    job->plt_count = plt_count;
+    if (!job->text || !worker_mutex) {
+        job_free (job);
+        return -1;
+    }
+
+    deadbeef->mutex_lock (worker_mutex);
+    int generation = job->generation = ++latest_generation;
+    if (!worker_tid) {
+        deadbeef->mutex_unlock (worker_mutex);
+        worker_run (job);
+        job_free (job);
+        return generation;
+    }
+    // an unstarted search for older text is simply dropped
+    qs_search_job_t *old = pending_job;
+    pending_job = job;
+    deadbeef->cond_signal (worker_cond);
+    deadbeef->mutex_unlock (worker_mutex);
+
+    job_free (old);
+    return generation;
+}
+
+void
+qs_worker_cancel (void)
+{
+    if (!worker_mutex) {
+        return;
+    }
+    // the running search notices the newer generation between shards
+    deadbeef->mutex_lock (worker_mutex);
+    latest_generation++;
+    qs_search_job_t *old = pending_job;
+    pending_job = NULL;
+    deadbeef->mutex_unlock (worker_mutex);
+    job_free (old);
+}
+
+void
+qs_worker_set_threads (int threads)
+{
+    // picked up by the worker before the next search
+    if (worker_mutex) {
+        deadbeef->mutex_lock (worker_mutex);
+    }
+    wanted_threads = threads;
+    if (worker_mutex) {
+        deadbeef->mutex_unlock (worker_mutex);
+    }
+}
+
+void
+qs_worker_set_snapshot (int snapshot)
+{
+    if (worker_mutex) {
+        deadbeef->mutex_lock (worker_mutex);
+    }
+    wanted_snapshot = snapshot;
+    if (worker_mutex) {
+        deadbeef->mutex_unlock (worker_mutex);
+    }
+}
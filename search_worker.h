@@ -0,0 +1,59 @@
+/*
+    Quick Search Plugin for DeaDBeeF audio player
+    Copyright (C) 2014 Christian Boxdörfer <christian.boxdoerfer@posteo.de>
+
+    This program is free software; you can redistribute it and/or
+    modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation; either version 2
+    of the License, or (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+*/
+
+#ifndef __QS_SEARCH_WORKER_H
+#define __QS_SEARCH_WORKER_H
+
+#include <deadbeef/deadbeef.h>
+
+// called from the worker thread once the search with the given generation
+// is done, unless a newer search got submitted in the meantime
+typedef void (*qs_search_done_cb) (int generation, void *user_data);
+
+int
+qs_worker_start (qs_search_done_cb done, void *user_data);
+
+void
+qs_worker_stop (void);
+
+// queues a search for text in the given playlists (the worker takes over the
+// references) and returns its generation. A pending or running search for an
+// older generation gets cancelled.
+int
+qs_worker_submit (const char *text, ddb_playlist_t **plts, int plt_count);
+
+// cancels the pending and the running search
+void
+qs_worker_cancel (void);
+
+// returns whether generation belongs to the most recently submitted search
+int
+qs_worker_is_current (int generation);
+
+// sets the number of threads searching in parallel, 0 means one per cpu
+void
+qs_worker_set_threads (int threads);
+
+// with snapshot set, pl_lock is only held while tokenizing a chunk of tracks,
+// taking hold of the indexes and applying the result, not while matching.
+// The playlists changed in the meantime are searched again with the lock held.
+void
+qs_worker_set_snapshot (int snapshot);
+
+#endif
@@ -0,0 +1,198 @@
+/*
+    Quick Search Plugin for DeaDBeeF audio player
+    Copyright (C) 2014 Christian Boxdörfer <christian.boxdoerfer@posteo.de>
+
+    This program is free software; you can redistribute it and/or
+    modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation; either version 2
+    of the License, or (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+*/
+
+// Regression tests of the search code, run against the stub of the player
+// in bench/ by "make check".
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "../bench/stub_deadbeef.h"
+#include "../search_index.h"
+#include "../fold.h"
+#include "../query.h"
+
+DB_functions_t *deadbeef;
+
+static int failures = 0;
+
+#define CHECK(cond) \
+    do { \
+        if (!(cond)) { \
+            fprintf (stderr, "%s:%d: %s: check failed: %s\n", __FILE__, __LINE__, __func__, #cond); \
+            failures++; \
+        } \
+    } while (0)
+
+static int
+is_selected (DB_playItem_t *it)
+{
+    return deadbeef->pl_is_selected (it);
+}
+
+// every value of a tag occurring more than once is searchable, and a change
+// of any of them keeps the saved index from being used
+static void
+test_multi_value (void)
+{
+    static char artists[] = "Alice\0Bob";
+    ddb_playlist_t *plt = stub_plt_new (2);
+    DB_playItem_t *both = stub_track_new (plt, 2);
+    stub_track_add_meta_values (both, "artist", artists, sizeof (artists));
+    stub_track_add_meta (both, "title", "Duet");
+    DB_playItem_t *single = stub_track_new (plt, 2);
+    stub_track_add_meta (single, "artist", "Carol");
+    stub_track_add_meta (single, "title", "Solo");
+
+    qs_index_search (plt, "bob");
+    CHECK (is_selected (both) && !is_selected (single));
+    qs_index_search (plt, "artist:bob");
+    CHECK (is_selected (both) && !is_selected (single));
+    qs_index_search (plt, "alice");
+    CHECK (is_selected (both) && !is_selected (single));
+
+    char path[] = "/tmp/qs_test_index_XXXXXX";
+    int fd = mkstemp (path);
+    CHECK (fd >= 0);
+    close (fd);
+    qs_index_save (path);
+    qs_index_free ();
+
+    // same length, so only the fingerprint can tell the difference
+    memcpy (artists + 6, "Rob", 3);
+    qs_index_load (path);
+    qs_index_search (plt, "rob");
+    CHECK (is_selected (both) && !is_selected (single));
+    qs_index_search (plt, "bob");
+    CHECK (!is_selected (both) && !is_selected (single));
+    qs_index_free ();
+    unlink (path);
+}
+
+// like the player, the file name of a track is searchable but neither its
+// directories nor the other internal fields are
+static void
+test_uri_file_name (void)
+{
+    ddb_playlist_t *plt = stub_plt_new (2);
+    DB_playItem_t *flac = stub_track_new (plt, 2);
+    stub_track_add_meta (flac, ":URI", "/music/jazz/take_five.flac");
+    stub_track_add_meta (flac, ":FILETYPE", "FLAC");
+    DB_playItem_t *mp3 = stub_track_new (plt, 2);
+    stub_track_add_meta (mp3, ":URI", "/music/rock/paranoid.mp3");
+    stub_track_add_meta (mp3, ":FILETYPE", "MP3");
+
+    qs_index_search (plt, "take_five");
+    CHECK (is_selected (flac) && !is_selected (mp3));
+    qs_index_search (plt, ".mp3");
+    CHECK (!is_selected (flac) && is_selected (mp3));
+    qs_index_search (plt, "jazz");
+    CHECK (!is_selected (flac) && !is_selected (mp3));
+    qs_index_search (plt, "flac");
+    CHECK (is_selected (flac) && !is_selected (mp3));
+    qs_index_search (plt, "mp3");
+    CHECK (!is_selected (flac) && is_selected (mp3));
+    deadbeef->plt_search_process (plt, "jazz");
+    CHECK (!is_selected (flac) && !is_selected (mp3));
+    deadbeef->plt_search_process (plt, "take_five");
+    CHECK (is_selected (flac) && !is_selected (mp3));
+    qs_index_free ();
+}
+
+// bytes which aren't utf-8 are kept as they are, so the folded text fits
+// into a buffer of the size of the input
+static void
+test_fold_invalid_utf8 (void)
+{
+    static const char in[] = "\x80\xc3" "Ab\xff";
+    char out[sizeof (in)];
+    int len = qs_fold (in, sizeof (in) - 1, out, sizeof (out));
+    CHECK (len == sizeof (in) - 1);
+    CHECK (!memcmp (out, "\x80\xc3" "ab\xff", sizeof (in)));
+}
+
+// empty phrases don't take part in the query instead of matching every
+// track while the phrase is being typed
+static void
+test_query_empty_phrase (void)
+{
+    static const char *empty[] = { "\"", "artist:\"\"", "-\"\"" };
+    for (int i = 0; i < (int)(sizeof (empty) / sizeof (empty[0])); i++) {
+        qs_query_t *query = qs_query_compile (empty[i]);
+        CHECK (query && query->alt_count == 0);
+        qs_query_free (query);
+    }
+    qs_query_t *query = qs_query_compile ("queen -\"\" \"");
+    CHECK (query && query->alt_count == 1 && query->alts[0].pred_count == 1);
+    qs_query_free (query);
+
+    ddb_playlist_t *plt = stub_plt_new (2);
+    DB_playItem_t *queen = stub_track_new (plt, 1);
+    stub_track_add_meta (queen, "artist", "Queen");
+    DB_playItem_t *abba = stub_track_new (plt, 1);
+    stub_track_add_meta (abba, "artist", "ABBA");
+    qs_index_search (plt, "queen \"");
+    CHECK (is_selected (queen) && !is_selected (abba));
+    qs_index_search (plt, "artist:\"\"");
+    CHECK (!is_selected (queen) && !is_selected (abba));
+    qs_index_free ();
+}
+
+static int
+folds_to (const char *in, const char *expected)
+{
+    char out[64];
+    qs_fold (in, strlen (in), out, sizeof (out));
+    return !strcmp (out, expected);
+}
+
+// case and diacritics are folded outside of the ranges fold.c handles
+// itself as well
+static void
+test_fold_table (void)
+{
+    CHECK (folds_to ("\xc8\x98TEFAN", "stefan"));
+    CHECK (folds_to ("\xe1\xba\xbe", "e"));
+    CHECK (folds_to ("\xd4\xb1\xd5\x90", "\xd5\xa1\xd6\x80"));
+    CHECK (folds_to ("\xc7\x84", "dz"));
+    CHECK (folds_to ("\xf0\x9d\x90\x80", "a"));
+    // the lower case letter would take more bytes
+    CHECK (folds_to ("\xc8\xba", "a"));
+    // hangul syllables would, decomposed
+    CHECK (folds_to ("\xed\x95\x9c", "\xed\x95\x9c"));
+}
+
+int
+main (void)
+{
+    deadbeef = stub_init ();
+    test_multi_value ();
+    test_uri_file_name ();
+    test_fold_invalid_utf8 ();
+    test_fold_table ();
+    test_query_empty_phrase ();
+    if (failures) {
+        fprintf (stderr, "%d checks failed\n", failures);
+        return 1;
+    }
+    printf ("all tests passed\n");
+    return 0;
+}
@@ -0,0 +1,235 @@
+/*
+    Quick Search Plugin for DeaDBeeF audio player
+    Copyright (C) 2014 Christian Boxdörfer <christian.boxdoerfer@posteo.de>
+
+    This program is free software; you can redistribute it and/or
+    modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation; either version 2
+    of the License, or (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+*/
+
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "quick_search.h"
+#include "thread_pool.h"
+
+// range of task numbers owned by one thread, the owner takes tasks from the
+// front, other threads steal from the back
+typedef struct {
+    uintptr_t mutex;
+    int head;
+    int tail;
+} qs_deque_t;
+
+typedef struct {
+    qs_pool_t *pool;
+    int slot;
+} qs_pool_thread_t;
+
+struct qs_pool_s {
+    int thread_count;
+    int slot_count;
+    intptr_t *tids;
+    qs_pool_thread_t *threads;
+    qs_deque_t *deques;
+    uintptr_t mutex;
+    uintptr_t cond;
+    uintptr_t done_cond;
+    int batch;
+    int stopping;
+    qs_task_fn fn;
+    void *ctx;
+    // tasks of the current batch which aren't finished yet
+    int remaining;
+    // helper threads still working on the current batch
+    int active;
+};
+
+int
+qs_cpu_count (void)
+{
+    long count = sysconf (_SC_NPROCESSORS_ONLN);
+    return count > 0 ? count : 1;
+}
+
+static int
+pop_task (qs_deque_t *deque, int steal)
+{
+    int task = -1;
+    deadbeef->mutex_lock (deque->mutex);
+    if (deque->head < deque->tail) {
+        task = steal ? --deque->tail : deque->head++;
+    }
+    deadbeef->mutex_unlock (deque->mutex);
+    return task;
+}
+
+static void
+pool_work (qs_pool_t *pool, int slot)
+{
+    for (;;) {
+        int task = pop_task (&pool->deques[slot], 0);
+        for (int i = 1; task < 0 && i < pool->thread_count; i++) {
+            task = pop_task (&pool->deques[(slot + i) % pool->thread_count], 1);
+        }
+        if (task < 0) {
+            break;
+        }
+        pool->fn (pool->ctx, task);
+
+        deadbeef->mutex_lock (pool->mutex);
+        if (--pool->remaining == 0) {
+            deadbeef->cond_broadcast (pool->done_cond);
+        }
+        deadbeef->mutex_unlock (pool->mutex);
+    }
+}
+
+static void
+pool_thread (void *ctx)
+{
+    qs_pool_thread_t *thread = ctx;
+    qs_pool_t *pool = thread->pool;
+    int batch = 0;
+    for (;;) {
+        deadbeef->mutex_lock (pool->mutex);
+        while (!pool->stopping && pool->batch == batch) {
+            deadbeef->cond_wait (pool->cond, pool->mutex);
+        }
+        if (pool->stopping) {
+            deadbeef->mutex_unlock (pool->mutex);
+            break;
+        }
+        batch = pool->batch;
+        deadbeef->mutex_unlock (pool->mutex);
+
+        pool_work (pool, thread->slot);
+
+        deadbeef->mutex_lock (pool->mutex);
+        pool->active--;
+        deadbeef->cond_broadcast (pool->done_cond);
+        deadbeef->mutex_unlock (pool->mutex);
+    }
+}
+
+qs_pool_t *
+qs_pool_create (int thread_count)
+{
+    if (thread_count < 1) {
+        thread_count = 1;
+    }
+    qs_pool_t *pool = calloc (1, sizeof (qs_pool_t));
+    if (!pool) {
+        return NULL;
+    }
+    pool->tids = calloc (thread_count, sizeof (intptr_t));
+    pool->threads = calloc (thread_count, sizeof (qs_pool_thread_t));
+    pool->deques = calloc (thread_count, sizeof (qs_deque_t));
+    if (!pool->tids || !pool->threads || !pool->deques) {
+        free (pool->tids);
+        free (pool->threads);
+        free (pool->deques);
+        free (pool);
+        return NULL;
+    }
+    pool->mutex = deadbeef->mutex_create ();
+    pool->cond = deadbeef->cond_create ();
+    pool->done_cond = deadbeef->cond_create ();
+    pool->slot_count = thread_count;
+    for (int i = 0; i < thread_count; i++) {
+        pool->deques[i].mutex = deadbeef->mutex_create ();
+    }
+
+    // slot 0 belongs to the thread calling qs_pool_run
+    pool->thread_count = 1;
+    for (int i = 1; i < thread_count; i++) {
+        qs_pool_thread_t *thread = &pool->threads[pool->thread_count];
+        thread->pool = pool;
+        thread->slot = pool->thread_count;
+        pool->tids[pool->thread_count] = deadbeef->thread_start (pool_thread, thread);
+        if (!pool->tids[pool->thread_count]) {
+            break;
+        }
+        pool->thread_count++;
+    }
+    trace ("quick_search: started thread pool with %d threads\n", pool->thread_count);
+    return pool;
+}
+
+void
+qs_pool_free (qs_pool_t *pool)
+{
+    if (!pool) {
+        return;
+    }
+    deadbeef->mutex_lock (pool->mutex);
+    pool->stopping = 1;
+    deadbeef->cond_broadcast (pool->cond);
+    deadbeef->mutex_unlock (pool->mutex);
+    for (int i = 1; i < pool->thread_count; i++) {
+        deadbeef->thread_join (pool->tids[i]);
+    }
+    // the deques of threads which failed to start were created as well
+    for (int i = 0; i < pool->slot_count; i++) {
+        deadbeef->mutex_free (pool->deques[i].mutex);
+    }
+    deadbeef->cond_free (pool->done_cond);
+    deadbeef->cond_free (pool->cond);
+    deadbeef->mutex_free (pool->mutex);
+    free (pool->deques);
+    free (pool->threads);
+    free (pool->tids);
+    free (pool);
+}
+
+int
+qs_pool_thread_count (qs_pool_t *pool)
+{
+    return pool ? pool->thread_count : 1;
+}
+
+void
+qs_pool_run (qs_pool_t *pool, qs_task_fn fn, void *ctx, int count)
+{
+    if (!pool || pool->thread_count < 2 || count < 2) {
+        for (int i = 0; i < count; i++) {
+            fn (ctx, i);
+        }
+        return;
+    }
+
+    deadbeef->mutex_lock (pool->mutex);
+    for (int i = 0; i < pool->thread_count; i++) {
+        qs_deque_t *deque = &pool->deques[i];
+        deadbeef->mutex_lock (deque->mutex);
+        deque->head = (long)count * i / pool->thread_count;
+        deque->tail = (long)count * (i + 1) / pool->thread_count;
+        deadbeef->mutex_unlock (deque->mutex);
+    }
+    pool->fn = fn;
+    pool->ctx = ctx;
+    pool->remaining = count;
+    pool->active = pool->thread_count - 1;
+    pool->batch++;
+    deadbeef->cond_broadcast (pool->cond);
+    deadbeef->mutex_unlock (pool->mutex);
+
+    pool_work (pool, 0);
+
+    // the helpers must be done with the deques before the next batch
+    deadbeef->mutex_lock (pool->mutex);
+    while (pool->remaining > 0 || pool->active > 0) {
+        deadbeef->cond_wait (pool->done_cond, pool->mutex);
+    }
+    deadbeef->mutex_unlock (pool->mutex);
+}
@@ -0,0 +1,48 @@
+/*
+    Quick Search Plugin for DeaDBeeF audio player
+    Copyright (C) 2014 Christian Boxdörfer <christian.boxdoerfer@posteo.de>
+
+    This program is free software; you can redistribute it and/or
+    modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation; either version 2
+    of the License, or (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+*/
+
+#ifndef __QS_THREAD_POOL_H
+#define __QS_THREAD_POOL_H
+
+typedef struct qs_pool_s qs_pool_t;
+
+typedef void (*qs_task_fn) (void *ctx, int task);
+
+// creates a pool which runs tasks on thread_count threads, the thread calling
+// qs_pool_run being one of them
+qs_pool_t *
+qs_pool_create (int thread_count);
+
+void
+qs_pool_free (qs_pool_t *pool);
+
+int
+qs_pool_thread_count (qs_pool_t *pool);
+
+// runs fn (ctx, i) for every i in [0, count) and returns once all of them are
+// done. Each thread starts with its own consecutive range of tasks and steals
+// from the others when it runs out of work. A NULL pool runs them in order.
+void
+qs_pool_run (qs_pool_t *pool, qs_task_fn fn, void *ctx, int count);
+
+// returns the number of online cpus
+int
+qs_cpu_count (void);
+
+#endif
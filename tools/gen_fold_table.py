@@ -0,0 +1,112 @@
+#!/usr/bin/env python3
+# Generates fold_table.h, the case folding and decomposition table qs_fold
+# uses for the characters fold.c doesn't handle itself.
+#
+# usage: tools/gen_fold_table.py > fold_table.h
+#
+# A character folds to its NFKD decomposition without diacritical marks,
+# lower cased. Mappings which would make the utf-8 encoding longer are left
+# out (Hangul syllables, Arabic ligatures), so folding never makes the text
+# longer.
+
+import sys
+import unicodedata
+
+MAX_CP = 0x1ffff
+
+# blocks of combining marks which get dropped, in decompositions as well as
+# on their own
+DIACRITIC_BLOCKS = [
+    (0x300, 0x36f),
+    (0x1ab0, 0x1aff),
+    (0x1dc0, 0x1dff),
+    (0x20d0, 0x20ff),
+    (0xfe20, 0xfe2f),
+]
+
+# handled by fold.c before looking at the table
+HANDLED = [
+    (0x0, 0x17f),
+    (0x300, 0x36f),
+    (0xfb00, 0xfb06),
+    (0xff01, 0xff5e),
+]
+
+
+def in_ranges(cp, ranges):
+    return any(lo <= cp <= hi for lo, hi in ranges)
+
+
+def is_diacritic(ch):
+    return in_ranges(ord(ch), DIACRITIC_BLOCKS) and unicodedata.category(ch) == 'Mn'
+
+
+def strip(text):
+    text = unicodedata.normalize('NFKD', text)
+    return ''.join(ch for ch in text if not is_diacritic(ch))
+
+
+def fold(ch):
+    if is_diacritic(ch):
+        return ''
+    return strip(strip(ch).lower())
+
+
+def utf8_len(text):
+    return len(text.encode('utf-8'))
+
+
+def fallback(ch):
+    # letters like U+023A LATIN CAPITAL LETTER A WITH STROKE, whose lower
+    # case form takes more bytes, fold to their base letter
+    name = unicodedata.name(ch, '')
+    for prefix in ('LATIN CAPITAL LETTER ', 'LATIN SMALL LETTER '):
+        if name.startswith(prefix) and ' WITH ' in name:
+            base = name[len(prefix):].split(' WITH ')[0]
+            if len(base) == 1:
+                return base.lower()
+    lower = ch.lower()
+    return lower if len(lower) == 1 and utf8_len(lower) <= utf8_len(ch) else ch
+
+
+def c_string(text):
+    return '"' + ''.join('\\x%02x' % b for b in text.encode('utf-8')) + '"'
+
+
+def main():
+    chars = []
+    texts = []
+    for cp in range(MAX_CP + 1):
+        if in_ranges(cp, HANDLED) or 0xd800 <= cp <= 0xdfff:
+            continue
+        ch = chr(cp)
+        if unicodedata.category(ch) == 'Cn':
+            continue
+        folded = fold(ch)
+        if utf8_len(folded) > utf8_len(ch):
+            folded = fallback(ch)
+        if folded == ch:
+            continue
+        if len(folded) <= 1:
+            chars.append((cp, ord(folded) if folded else 0))
+        else:
+            texts.append((cp, folded))
+
+    out = sys.stdout
+    out.write('// generated by tools/gen_fold_table.py from the Unicode %s data, '
+              'don\'t edit\n\n' % unicodedata.unidata_version)
+    out.write('#ifndef __QS_FOLD_TABLE_H\n#define __QS_FOLD_TABLE_H\n\n')
+    out.write('// characters folding to a single character, 0 for marks which are dropped\n')
+    out.write('static const uint32_t fold_chars[][2] = {\n')
+    for cp, folded in chars:
+        out.write('    { 0x%x, 0x%x },\n' % (cp, folded))
+    out.write('};\n\n')
+    out.write('// characters folding to several characters\n')
+    out.write('static const struct {\n    uint32_t cp;\n    const char *text;\n} fold_texts[] = {\n')
+    for cp, text in texts:
+        out.write('    { 0x%x, %s },\n' % (cp, c_string(text)))
+    out.write('};\n\n#endif\n')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,201 @@
+/*
+    Quick Search Plugin for DeaDBeeF audio player
+    Copyright (C) 2014 Christian Boxdörfer <christian.boxdoerfer@posteo.de>
+
+    This program is free software; you can redistribute it and/or
+    modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation; either version 2
+    of the License, or (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+*/
+
+#include <pthread.h>
+#include <stdio.h>
+#include <unistd.h>
+
+#include "quick_search.h"
+#include "search_stats.h"
+#include "trace_event.h"
+
+// a typing session is a few megabytes, this keeps a forgotten switch from
+// filling the disk
+#define MAX_TRACE_BYTES (64 * 1024 * 1024)
+
+static uintptr_t trace_mutex = 0;
+static FILE *trace_file = NULL;
+static long trace_bytes = 0;
+static int trace_events = 0;
+static int trace_pid = 0;
+
+static void
+write_string (const char *s)
+{
+    fputc ('"', trace_file);
+    for (; *s; s++) {
+        unsigned char c = *s;
+        if (c == '"' || c == '\\') {
+            fprintf (trace_file, "\\%c", c);
+        }
+        else if (c < 0x20) {
+            fprintf (trace_file, "\\u%04x", c);
+        }
+        else {
+            fputc (c, trace_file);
+        }
+    }
+    fputc ('"', trace_file);
+}
+
+static void
+finish (void)
+{
+    fprintf (trace_file, "\n]\n");
+    fclose (trace_file);
+    trace_file = NULL;
+}
+
+// writes an event, called with trace_mutex held
+static void
+write_event (const char *name, char phase, int64_t ts, int64_t dur, const char *text, const char *arg, int64_t value)
+{
+    if (!trace_file) {
+        return;
+    }
+    long start = ftell (trace_file);
+    fprintf (trace_file, "%s{\"name\":", trace_events ? ",\n" : "");
+    write_string (name);
+    fprintf (trace_file, ",\"ph\":\"%c\",\"ts\":%lld,\"pid\":%d,\"tid\":%lu",
+            phase, (long long)ts, trace_pid, (unsigned long)pthread_self ());
+    if (phase == 'X') {
+        fprintf (trace_file, ",\"dur\":%lld", (long long)dur);
+    }
+    else if (phase == 'i') {
+        // only mark the thread, not the whole process
+        fprintf (trace_file, ",\"s\":\"t\"");
+    }
+    if (text || arg) {
+        fprintf (trace_file, ",\"args\":{");
+        if (text) {
+            fprintf (trace_file, "\"text\":");
+            write_string (text);
+        }
+        if (arg) {
+            fprintf (trace_file, "%s", text ? "," : "");
+            write_string (arg);
+            fprintf (trace_file, ":%lld", (long long)value);
+        }
+        fputc ('}', trace_file);
+    }
+    fputc ('}', trace_file);
+    trace_events++;
+    trace_bytes += ftell (trace_file) - start;
+    if (trace_bytes > MAX_TRACE_BYTES || ferror (trace_file)) {
+        trace ("quick_search: stopped tracing after %d events\n", trace_events);
+        finish ();
+    }
+}
+
+int
+qs_trace_start (const char *path)
+{
+    if (!path) {
+        return -1;
+    }
+    if (!trace_mutex) {
+        trace_mutex = deadbeef->mutex_create ();
+    }
+    deadbeef->mutex_lock (trace_mutex);
+    int res = 0;
+    if (!trace_file) {
+        trace_file = fopen (path, "w");
+        if (trace_file) {
+            trace_bytes = 0;
+            trace_events = 0;
+            trace_pid = getpid ();
+            fprintf (trace_file, "[\n");
+            // tells the main loop apart from the search threads
+            fprintf (trace_file, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%d,\"tid\":%lu,\"args\":{\"name\":\"main loop\"}}",
+                    trace_pid, (unsigned long)pthread_self ());
+            trace_events++;
+        }
+        else {
+            res = -1;
+        }
+    }
+    deadbeef->mutex_unlock (trace_mutex);
+    return res;
+}
+
+void
+qs_trace_stop (void)
+{
+    if (!trace_mutex) {
+        return;
+    }
+    deadbeef->mutex_lock (trace_mutex);
+    if (trace_file) {
+        finish ();
+    }
+    deadbeef->mutex_unlock (trace_mutex);
+}
+
+int
+qs_trace_enabled (void)
+{
+    if (!trace_mutex) {
+        return 0;
+    }
+    deadbeef->mutex_lock (trace_mutex);
+    int res = trace_file != NULL;
+    deadbeef->mutex_unlock (trace_mutex);
+    return res;
+}
+
+void
+qs_trace_free (void)
+{
+    qs_trace_stop ();
+    if (trace_mutex) {
+        deadbeef->mutex_free (trace_mutex);
+        trace_mutex = 0;
+    }
+}
+
+void
+qs_trace_span (const char *name, int64_t start, int64_t end, const char *text, const char *arg, int64_t value)
+{
+    if (!trace_mutex || !start) {
+        return;
+    }
+    deadbeef->mutex_lock (trace_mutex);
+    write_event (name, 'X', start, end - start, text, arg, value);
+    deadbeef->mutex_unlock (trace_mutex);
+}
+
+void
+qs_trace_complete (const char *name, int64_t start, const char *text, const char *arg, int64_t value)
+{
+    if (start) {
+        qs_trace_span (name, start, qs_clock_usec (), text, arg, value);
+    }
+}
+
+void
+qs_trace_instant (const char *name, const char *text, const char *arg, int64_t value)
+{
+    if (!trace_mutex) {
+        return;
+    }
+    int64_t now = qs_clock_usec ();
+    deadbeef->mutex_lock (trace_mutex);
+    write_event (name, 'i', now, 0, text, arg, value);
+    deadbeef->mutex_unlock (trace_mutex);
+}
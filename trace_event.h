@@ -0,0 +1,60 @@
+/*
+    Quick Search Plugin for DeaDBeeF audio player
+    Copyright (C) 2014 Christian Boxdörfer <christian.boxdoerfer@posteo.de>
+
+    This program is free software; you can redistribute it and/or
+    modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation; either version 2
+    of the License, or (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+*/
+
+#ifndef __QS_TRACE_EVENT_H
+#define __QS_TRACE_EVENT_H
+
+#include <stdint.h>
+
+// Writes the steps of the searches as Chrome trace_event JSON, which can be
+// opened in chrome://tracing or Perfetto to see which of them kept the main
+// loop busy. Times come from qs_clock_usec (see search_stats.h). Every event
+// carries the search text if given and one numeric argument if arg isn't
+// NULL. Thread safe.
+
+// starts writing to path, replacing the file. Returns 0 on success or if
+// tracing already is on.
+int
+qs_trace_start (const char *path);
+
+// finishes the file, tracing stops on its own once the file gets too big
+void
+qs_trace_stop (void);
+
+int
+qs_trace_enabled (void);
+
+// stops tracing, no other thread may trace any more
+void
+qs_trace_free (void);
+
+// adds an event for something that ran from start to end
+void
+qs_trace_span (const char *name, int64_t start, int64_t end, const char *text, const char *arg, int64_t value);
+
+// adds an event for something that ran from start until now, start being 0
+// means tracing was off when it began
+void
+qs_trace_complete (const char *name, int64_t start, const char *text, const char *arg, int64_t value);
+
+// adds an event for something that happened just now
+void
+qs_trace_instant (const char *name, const char *text, const char *arg, int64_t value);
+
+#endif